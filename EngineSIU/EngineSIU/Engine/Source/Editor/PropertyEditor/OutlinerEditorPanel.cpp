@@ -85,7 +85,8 @@ void OutlinerEditorPanel::Render()
 
         ImGui::SetNextItemOpen(true, ImGuiCond_Always);
 
-        bool NodeOpen = ImGui::TreeNodeEx(*Actor->GetName(), Flags);
+        TCHAR NameBuffer[NAME_SIZE];
+        bool NodeOpen = ImGui::TreeNodeEx(Actor->GetFName().ToCString(NameBuffer), Flags);
 
         if (ImGui::IsItemClicked())
         {
@@ -398,7 +398,8 @@ void PropertyEditorPanel::RenderForStaticMesh(UStaticMeshComponent* StaticMeshCo
                     continue;
                 }
                 
-                if (ImGui::Selectable(GetData(Asset.Value.AssetName.ToString()), false))
+                TCHAR NameBuffer[NAME_SIZE];
+                if (ImGui::Selectable(Asset.Value.AssetName.ToCString(NameBuffer), false))
                 {
                     FString MeshName = Asset.Value.PackagePath.ToString() + "/" + Asset.Value.AssetName.ToString();
                     UStaticMesh* StaticMesh = FObjManager::GetStaticMesh(MeshName.ToWideString());
@@ -449,7 +450,8 @@ void PropertyEditorPanel::RenderForSkeletalMesh(USkeletalMeshComponent* Skeletal
                     continue;
                 }
                 
-                if (ImGui::Selectable(GetData(Asset.Value.AssetName.ToString()), false))
+                TCHAR NameBuffer[NAME_SIZE];
+                if (ImGui::Selectable(Asset.Value.AssetName.ToCString(NameBuffer), false))
                 {
                     FString MeshName = Asset.Value.PackagePath.ToString() + "/" + Asset.Value.AssetName.ToString();
                     USkeletalMesh* SkeletalMesh = UAssetManager::Get().GetSkeletalMesh(FName(MeshName));
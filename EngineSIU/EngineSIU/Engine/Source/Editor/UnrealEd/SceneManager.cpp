@@ -1,5 +1,6 @@
 #include "SceneManager.h"
 #include <fstream>
+#include <unordered_map>
 #include "EditorViewportClient.h"
 #include "Engine/FObjLoader.h"
 #include "Engine/StaticMeshActor.h"
@@ -19,7 +20,7 @@ using json = nlohmann::json;
 [[maybe_unused]]
 static void to_json(json& Json, const FString& S)
 {
-    Json = S.GetContainerPrivate();
+    Json = S.ToAnsiString();
 }
 
 [[maybe_unused]]
@@ -27,7 +28,7 @@ static void from_json(const json& Json, FString& S)
 {
     if (Json.is_string())
     {
-        Json.get_to(S.GetContainerPrivate());
+        S = FString(Json.get_ref<const std::string&>());
     }
 }
 
@@ -51,14 +52,28 @@ template <typename KeyType, typename ValueType, typename Allocator>
 [[maybe_unused]]
 static void to_json(json& Json, const TMap<KeyType, ValueType, Allocator>& Map)
 {
-    Json = Map.GetContainerPrivate();
+    // TMap은 std 컨테이너가 아니므로, 기존 포맷과 같도록 std::unordered_map으로 변환해서 저장
+    std::unordered_map<KeyType, ValueType> StdMap;
+    StdMap.reserve(Map.Num());
+    for (const auto& [Key, Value] : Map)
+    {
+        StdMap.emplace(Key, Value);
+    }
+    Json = StdMap;
 }
 
 template <typename KeyType, typename ValueType, typename Allocator>
 [[maybe_unused]]
 static void from_json(const json& Json, TMap<KeyType, ValueType, Allocator>& Map)
 {
-    Json.get_to(Map.GetContainerPrivate());
+    std::unordered_map<KeyType, ValueType> StdMap;
+    Json.get_to(StdMap);
+
+    Map.Empty(static_cast<int32>(StdMap.size()));
+    for (auto& [Key, Value] : StdMap)
+    {
+        Map.Add(Key, Value);
+    }
 }
 #pragma endregion
 
@@ -148,7 +163,7 @@ bool SceneManager::SaveSceneToJsonFile(const std::filesystem::path& FilePath, co
 
     FString JsonData;
     SceneDataToJson(SceneData, JsonData);
-    outFile << JsonData.GetContainerPrivate();
+    outFile << JsonData.ToAnsiString();
     outFile.close();
 
     return true;
@@ -158,7 +173,7 @@ bool SceneManager::JsonToSceneData(const FString& InJsonString, FSceneData& OutS
 {
     try
     {
-        const json Json = json::parse(InJsonString.GetContainerPrivate()); // JSON 파일 읽기
+        const json Json = json::parse(*InJsonString, *InJsonString + InJsonString.Len()); // JSON 파일 읽기
         OutSceneData = Json;
     }
     catch (const std::exception& e)
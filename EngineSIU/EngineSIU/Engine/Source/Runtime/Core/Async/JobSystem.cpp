@@ -0,0 +1,397 @@
+#include "JobSystem.h"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "WindowsPlatformTime.h"
+#include "Stats/ProfilerStatsManager.h"
+
+
+class FJob
+{
+public:
+    std::function<void()> Func;
+    EJobThread Thread = EJobThread::AnyThread;
+
+    /** 완료되지 않은 선행 작업의 수, Launch가 끝날 때까지 1을 더 가지고 있습니다. */
+    std::atomic<int32> NumPendingPrerequisites = 1;
+
+    std::atomic<bool> bCompleted = false;
+
+    /** 이 Job이 끝나야 실행할 수 있는 Job들, DependentsLock으로 보호됩니다. */
+    std::mutex DependentsLock;
+    TArray<std::shared_ptr<FJob>> Dependents;
+};
+
+struct FJobSystem::FThreadContext
+{
+    std::mutex QueueLock;
+    std::deque<std::shared_ptr<FJob>> Queue;
+
+    std::thread Thread;
+
+    std::atomic<uint64> BusyCycles = 0;
+    std::atomic<uint32> NumJobs = 0;
+    std::atomic<uint32> NumStolenJobs = 0;
+};
+
+namespace
+{
+    /** 현재 Thread의 Queue Index, Main Thread는 0이고 Job System 밖의 Thread는 INDEX_NONE */
+    thread_local int32 GJobThreadIndex = INDEX_NONE;
+
+    std::mutex GWakeLock;
+    std::condition_variable GWakeCondition;
+}
+
+bool FJobHandle::IsCompleted() const
+{
+    return !Job || Job->bCompleted.load(std::memory_order_acquire);
+}
+
+FJobSystem& FJobSystem::Get()
+{
+    static FJobSystem Instance;
+    return Instance;
+}
+
+FJobSystem::~FJobSystem()
+{
+    Shutdown();
+}
+
+void FJobSystem::Initialize(int32 InNumWorkers)
+{
+    if (bInitialized)
+    {
+        return;
+    }
+
+    if (InNumWorkers < 0)
+    {
+        InNumWorkers = std::max(static_cast<int32>(std::thread::hardware_concurrency()) - 1, 0);
+    }
+    NumWorkers = InNumWorkers;
+
+    GJobThreadIndex = 0;
+    bShuttingDown = false;
+
+    MainThreadQueue = std::make_unique<FThreadContext>();
+    for (int32 Index = 0; Index <= NumWorkers; ++Index)
+    {
+        Threads.Add(std::make_unique<FThreadContext>());
+    }
+    ThreadStats.SetNum(NumWorkers + 1);
+
+    bInitialized = true;
+
+    FProfilerStatsManager::SetCurrentThreadName(TEXT("Main Thread"));
+
+    for (int32 Index = 1; Index <= NumWorkers; ++Index)
+    {
+        Threads[Index]->Thread = std::thread(&FJobSystem::WorkerMain, this, Index);
+
+        // 디버거, 프로파일러에서 구분할 수 있도록 이름 지정
+        const std::wstring ThreadName = L"Worker " + std::to_wstring(Index);
+        SetThreadDescription(Threads[Index]->Thread.native_handle(), ThreadName.c_str());
+    }
+
+    FrameStartCycles = FPlatformTime::Cycles64();
+}
+
+void FJobSystem::Shutdown()
+{
+    if (!bInitialized)
+    {
+        return;
+    }
+
+    {
+        std::lock_guard Lock(GWakeLock);
+        bShuttingDown = true;
+    }
+    GWakeCondition.notify_all();
+
+    for (int32 Index = 1; Index <= NumWorkers; ++Index)
+    {
+        Threads[Index]->Thread.join();
+    }
+
+    // Worker가 실행하지 못한 Job은 여기서 마무리
+    while (std::shared_ptr<FJob> Job = FindJob(0))
+    {
+        Execute(Job, 0);
+    }
+    ProcessMainThreadJobs();
+
+    bInitialized = false;
+    Threads.Empty();
+    MainThreadQueue.reset();
+    ThreadStats.Empty();
+    NumWorkers = 0;
+    NumQueuedJobs = 0;
+    NumSleepingWorkers = 0;
+    GJobThreadIndex = INDEX_NONE;
+}
+
+bool FJobSystem::IsInMainThread()
+{
+    return GJobThreadIndex == 0;
+}
+
+FJobHandle FJobSystem::Launch(std::function<void()> Func, EJobThread Thread)
+{
+    return Launch(std::move(Func), {}, Thread);
+}
+
+FJobHandle FJobSystem::Launch(std::function<void()> Func, const TArray<FJobHandle>& Prerequisites, EJobThread Thread)
+{
+    std::shared_ptr<FJob> Job = std::make_shared<FJob>();
+    Job->Func = std::move(Func);
+    Job->Thread = Thread;
+
+    for (const FJobHandle& Prerequisite : Prerequisites)
+    {
+        if (!Prerequisite.IsValid())
+        {
+            continue;
+        }
+
+        FJob* PrerequisiteJob = Prerequisite.Job.get();
+        std::lock_guard Lock(PrerequisiteJob->DependentsLock);
+        if (!PrerequisiteJob->bCompleted.load(std::memory_order_acquire))
+        {
+            PrerequisiteJob->Dependents.Add(Job);
+            Job->NumPendingPrerequisites.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    // Launch가 가지고 있던 1을 빼서, 선행 작업이 이미 모두 끝났다면 바로 Queue에 넣음
+    if (Job->NumPendingPrerequisites.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        Enqueue(Job);
+    }
+
+    return FJobHandle(std::move(Job));
+}
+
+void FJobSystem::Wait(const FJobHandle& Handle)
+{
+    const int32 ThreadIndex = GJobThreadIndex;
+    while (!Handle.IsCompleted())
+    {
+        std::shared_ptr<FJob> Job;
+        if (ThreadIndex == 0)
+        {
+            Job = PopMainThreadJob();
+        }
+        if (!Job && ThreadIndex != INDEX_NONE && bInitialized)
+        {
+            Job = FindJob(ThreadIndex);
+        }
+
+        if (Job)
+        {
+            Execute(Job, ThreadIndex);
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void FJobSystem::WaitAll(const TArray<FJobHandle>& Handles)
+{
+    for (const FJobHandle& Handle : Handles)
+    {
+        Wait(Handle);
+    }
+}
+
+void FJobSystem::ProcessMainThreadJobs()
+{
+    while (std::shared_ptr<FJob> Job = PopMainThreadJob())
+    {
+        Execute(Job, 0);
+    }
+}
+
+void FJobSystem::BeginFrame()
+{
+    if (!bInitialized)
+    {
+        return;
+    }
+
+    const uint64 Now = FPlatformTime::Cycles64();
+    const double FrameMs = FPlatformTime::ToMilliseconds(Now - FrameStartCycles);
+    FrameStartCycles = Now;
+
+    for (int32 Index = 0; Index < Threads.Num(); ++Index)
+    {
+        FThreadContext& Context = *Threads[Index];
+        FJobThreadStats& Stats = ThreadStats[Index];
+
+        Stats.BusyMs = FPlatformTime::ToMilliseconds(Context.BusyCycles.exchange(0, std::memory_order_relaxed));
+        Stats.Utilization = FrameMs > 0.0 ? static_cast<float>(std::min(Stats.BusyMs / FrameMs, 1.0)) : 0.f;
+        Stats.NumJobs = Context.NumJobs.exchange(0, std::memory_order_relaxed);
+        Stats.NumStolenJobs = Context.NumStolenJobs.exchange(0, std::memory_order_relaxed);
+    }
+}
+
+void FJobSystem::Enqueue(std::shared_ptr<FJob> Job)
+{
+    // Worker가 없으면 Queue를 거치지 않고 바로 실행
+    if (!bInitialized || (NumWorkers == 0 && Job->Thread == EJobThread::AnyThread))
+    {
+        Execute(Job, GJobThreadIndex);
+        return;
+    }
+
+    if (Job->Thread == EJobThread::MainThread)
+    {
+        std::lock_guard Lock(MainThreadQueue->QueueLock);
+        MainThreadQueue->Queue.push_back(std::move(Job));
+        return;
+    }
+
+    // Job System 밖의 Thread에서 추가한 Job은 Main Thread의 Queue에 넣고, Worker가 가져가도록 함
+    const int32 ThreadIndex = GJobThreadIndex != INDEX_NONE ? GJobThreadIndex : 0;
+    {
+        FThreadContext& Context = *Threads[ThreadIndex];
+        std::lock_guard Lock(Context.QueueLock);
+        Context.Queue.push_back(std::move(Job));
+    }
+    NumQueuedJobs.fetch_add(1);
+
+    if (NumSleepingWorkers.load() > 0)
+    {
+        // 잠들기 직전의 Worker가 깨우는 신호를 놓치지 않도록 Lock을 한 번 거침
+        {
+            std::lock_guard Lock(GWakeLock);
+        }
+        GWakeCondition.notify_one();
+    }
+}
+
+std::shared_ptr<FJob> FJobSystem::FindJob(int32 ThreadIndex)
+{
+    if (NumQueuedJobs.load(std::memory_order_relaxed) <= 0)
+    {
+        return nullptr;
+    }
+
+    {
+        FThreadContext& Context = *Threads[ThreadIndex];
+        std::lock_guard Lock(Context.QueueLock);
+        if (!Context.Queue.empty())
+        {
+            std::shared_ptr<FJob> Job = std::move(Context.Queue.back());
+            Context.Queue.pop_back();
+            NumQueuedJobs.fetch_sub(1);
+            return Job;
+        }
+    }
+
+    // 자기 Queue가 비어있으면 다음 Thread부터 돌아가며 가장 오래된 Job을 가져옴
+    const int32 NumThreads = Threads.Num();
+    for (int32 Offset = 1; Offset < NumThreads; ++Offset)
+    {
+        FThreadContext& Victim = *Threads[(ThreadIndex + Offset) % NumThreads];
+        std::lock_guard Lock(Victim.QueueLock);
+        if (!Victim.Queue.empty())
+        {
+            std::shared_ptr<FJob> Job = std::move(Victim.Queue.front());
+            Victim.Queue.pop_front();
+            NumQueuedJobs.fetch_sub(1);
+            Threads[ThreadIndex]->NumStolenJobs.fetch_add(1, std::memory_order_relaxed);
+            return Job;
+        }
+    }
+
+    return nullptr;
+}
+
+std::shared_ptr<FJob> FJobSystem::PopMainThreadJob()
+{
+    if (!MainThreadQueue)
+    {
+        return nullptr;
+    }
+
+    std::lock_guard Lock(MainThreadQueue->QueueLock);
+    if (MainThreadQueue->Queue.empty())
+    {
+        return nullptr;
+    }
+
+    std::shared_ptr<FJob> Job = std::move(MainThreadQueue->Queue.front());
+    MainThreadQueue->Queue.pop_front();
+    return Job;
+}
+
+void FJobSystem::Execute(const std::shared_ptr<FJob>& Job, int32 ThreadIndex)
+{
+    const uint64 StartCycles = FPlatformTime::Cycles64();
+
+    Job->Func();
+    Job->Func = nullptr; // 캡처한 값들을 바로 해제
+
+    if (ThreadIndex != INDEX_NONE && bInitialized)
+    {
+        FThreadContext& Context = *Threads[ThreadIndex];
+        Context.BusyCycles.fetch_add(FPlatformTime::Cycles64() - StartCycles, std::memory_order_relaxed);
+        Context.NumJobs.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    TArray<std::shared_ptr<FJob>> Dependents;
+    {
+        std::lock_guard Lock(Job->DependentsLock);
+        Job->bCompleted.store(true, std::memory_order_release);
+        Dependents = std::move(Job->Dependents);
+    }
+
+    for (std::shared_ptr<FJob>& Dependent : Dependents)
+    {
+        if (Dependent->NumPendingPrerequisites.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            Enqueue(std::move(Dependent));
+        }
+    }
+}
+
+void FJobSystem::WorkerMain(int32 ThreadIndex)
+{
+    GJobThreadIndex = ThreadIndex;
+    FProfilerStatsManager::SetCurrentThreadName(FString::Printf(TEXT("Worker %d"), ThreadIndex));
+
+    while (!bShuttingDown.load())
+    {
+        if (std::shared_ptr<FJob> Job = FindJob(ThreadIndex))
+        {
+            Execute(Job, ThreadIndex);
+            continue;
+        }
+
+        // 잠들기 전에 잠깐 다시 확인, 프레임 안에서 Job이 연달아 들어오는 경우 잠들고 깨어나는 비용을 줄임
+        bool bFoundJob = false;
+        for (int32 Spin = 0; Spin < 64 && !bFoundJob; ++Spin)
+        {
+            std::this_thread::yield();
+            bFoundJob = NumQueuedJobs.load(std::memory_order_relaxed) > 0;
+        }
+        if (bFoundJob)
+        {
+            continue;
+        }
+
+        std::unique_lock Lock(GWakeLock);
+        NumSleepingWorkers.fetch_add(1);
+        GWakeCondition.wait(Lock, [this]() { return bShuttingDown.load() || NumQueuedJobs.load() > 0; });
+        NumSleepingWorkers.fetch_sub(1);
+    }
+}
@@ -0,0 +1,220 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <memory>
+
+#include "CoreMiscDefines.h"
+#include "Container/Array.h"
+#include "HAL/PlatformType.h"
+
+class FJob;
+
+
+/** Job을 실행할 수 있는 Thread */
+enum class EJobThread : uint8
+{
+    /** Worker Thread나, 완료를 기다리는 Thread 어디서든 실행 */
+    AnyThread,
+
+    /** Main Thread에서만 실행, D3D11 Context, ImGui, UObject 생성처럼 Main Thread 전용인 작업 */
+    MainThread,
+};
+
+/**
+ * Launch가 반환하는 Job의 참조
+ * 완료를 기다리거나, 다른 Job의 선행 작업으로 넘길 수 있습니다.
+ */
+class FJobHandle
+{
+    friend class FJobSystem;
+
+public:
+    FJobHandle() = default;
+
+    bool IsValid() const { return Job != nullptr; }
+
+    /** 유효하지 않은 Handle은 완료된 것으로 취급합니다. */
+    bool IsCompleted() const;
+
+private:
+    explicit FJobHandle(std::shared_ptr<FJob> InJob)
+        : Job(std::move(InJob))
+    {
+    }
+
+    std::shared_ptr<FJob> Job;
+};
+
+/** Thread 하나의 지난 프레임 Job 실행 통계 */
+struct FJobThreadStats
+{
+    /** Job을 실행한 시간 */
+    double BusyMs = 0.0;
+
+    /** 프레임 길이 대비 Job을 실행한 시간의 비율 [0, 1] */
+    float Utilization = 0.f;
+
+    uint32 NumJobs = 0;
+
+    /** 다른 Thread의 Queue에서 가져온 Job의 수 */
+    uint32 NumStolenJobs = 0;
+};
+
+
+/**
+ * Work Stealing 방식의 Job System
+ *
+ * Thread마다 Job Queue를 가지며, 자기 Queue는 뒤에서부터(LIFO), 다른 Thread의 Queue는 앞에서부터(FIFO) 가져옵니다.
+ * Main Thread도 Index 0의 Queue를 가지며, Wait 중에는 다른 Job을 대신 실행합니다.
+ * Initialize 전이나 Worker가 없으면 모든 Job은 Launch한 Thread에서 바로 실행됩니다.
+ *
+ * @note 대부분의 Engine 코드(UObject 생성, Renderer)는 Main Thread 전용입니다. FName과 UE_LOG는 어느 Thread에서나 쓸 수 있습니다.
+ *       AnyThread Job에서는 자기 데이터만 읽고 써야 합니다.
+ */
+class FJobSystem
+{
+public:
+    static FJobSystem& Get();
+
+    FJobSystem(const FJobSystem&) = delete;
+    FJobSystem& operator=(const FJobSystem&) = delete;
+    FJobSystem(FJobSystem&&) = delete;
+    FJobSystem& operator=(FJobSystem&&) = delete;
+
+    /**
+     * Worker Thread를 생성합니다. Main Thread에서 호출해야 합니다.
+     * @param NumWorkers Worker Thread의 수, 음수면 논리 코어 수 - 1
+     */
+    void Initialize(int32 NumWorkers = -1);
+
+    /** 남은 Job을 모두 실행하고 Worker Thread를 종료합니다. */
+    void Shutdown();
+
+    bool IsInitialized() const { return bInitialized; }
+
+    int32 GetNumWorkers() const { return NumWorkers; }
+
+    static bool IsInMainThread();
+
+    /** 선행 작업 없이 바로 실행 가능한 Job을 추가합니다. */
+    FJobHandle Launch(std::function<void()> Func, EJobThread Thread = EJobThread::AnyThread);
+
+    /** Prerequisites가 모두 완료된 뒤에 실행되는 Job을 추가합니다. */
+    FJobHandle Launch(std::function<void()> Func, const TArray<FJobHandle>& Prerequisites, EJobThread Thread = EJobThread::AnyThread);
+
+    /**
+     * Job이 완료될 때까지 다른 Job을 대신 실행하며 기다립니다.
+     * @note Worker Thread에서 MainThread Job을 기다리면 안 됩니다.
+     */
+    void Wait(const FJobHandle& Handle);
+
+    void WaitAll(const TArray<FJobHandle>& Handles);
+
+    /** 대기 중인 MainThread Job을 모두 실행합니다. 매 프레임 Main Thread에서 호출됩니다. */
+    void ProcessMainThreadJobs();
+
+    /**
+     * [0, Num) 범위의 Index마다 Body를 호출합니다. 호출한 Thread도 같이 실행하며, 모두 끝나야 반환합니다.
+     * @param MinBatchSize Job 하나가 한 번에 가져가는 최소 Index 수
+     */
+    template <typename FuncType>
+    void ParallelFor(int32 Num, FuncType&& Body, int32 MinBatchSize = 1);
+
+    /** 지난 프레임의 통계를 계산하고 새 프레임의 집계를 시작합니다. */
+    void BeginFrame();
+
+    /** Index 0은 Main Thread, 1부터 Worker Thread */
+    const TArray<FJobThreadStats>& GetThreadStats() const { return ThreadStats; }
+
+private:
+    FJobSystem() = default;
+    ~FJobSystem();
+
+    struct FThreadContext;
+
+    /** 실행 가능한 Job을 Queue에 넣습니다. */
+    void Enqueue(std::shared_ptr<FJob> Job);
+
+    /** 자기 Queue, 다른 Thread의 Queue 순서로 Job을 찾습니다. */
+    std::shared_ptr<FJob> FindJob(int32 ThreadIndex);
+
+    std::shared_ptr<FJob> PopMainThreadJob();
+
+    void Execute(const std::shared_ptr<FJob>& Job, int32 ThreadIndex);
+
+    void WorkerMain(int32 ThreadIndex);
+
+private:
+    /** Index 0은 Main Thread, 1부터 Worker Thread */
+    TArray<std::unique_ptr<FThreadContext>> Threads;
+
+    std::unique_ptr<FThreadContext> MainThreadQueue;
+
+    int32 NumWorkers = 0;
+
+    /** AnyThread Queue에 들어있는 Job의 수, 잠든 Worker를 깨울지 판단합니다. */
+    std::atomic<int32> NumQueuedJobs = 0;
+    std::atomic<int32> NumSleepingWorkers = 0;
+
+    std::atomic<bool> bShuttingDown = false;
+    bool bInitialized = false;
+
+    uint64 FrameStartCycles = 0;
+    TArray<FJobThreadStats> ThreadStats;
+};
+
+
+template <typename FuncType>
+void FJobSystem::ParallelFor(int32 Num, FuncType&& Body, int32 MinBatchSize)
+{
+    if (Num <= 0)
+    {
+        return;
+    }
+
+    // Thread마다 Batch를 몇 개씩 가져갈 수 있을 정도로 나눠서, 먼저 끝난 Thread가 남은 Batch를 가져가도록 함
+    const int32 MaxTasks = NumWorkers + 1;
+    const int32 BatchSize = std::max(std::max(MinBatchSize, 1), Num / (MaxTasks * 4));
+    const int32 NumBatches = (Num + BatchSize - 1) / BatchSize;
+    const int32 NumTasks = std::min(NumBatches, MaxTasks);
+
+    if (NumTasks <= 1)
+    {
+        for (int32 Index = 0; Index < Num; ++Index)
+        {
+            Body(Index);
+        }
+        return;
+    }
+
+    std::atomic<int32> NextBatch = 0;
+    auto RunBatches = [&]()
+    {
+        for (int32 Batch = NextBatch.fetch_add(1, std::memory_order_relaxed); Batch < NumBatches; Batch = NextBatch.fetch_add(1, std::memory_order_relaxed))
+        {
+            const int32 End = std::min(Num, (Batch + 1) * BatchSize);
+            for (int32 Index = Batch * BatchSize; Index < End; ++Index)
+            {
+                Body(Index);
+            }
+        }
+    };
+
+    TArray<FJobHandle> Handles;
+    Handles.Reserve(NumTasks - 1);
+    for (int32 Task = 1; Task < NumTasks; ++Task)
+    {
+        Handles.Add(Launch(RunBatches));
+    }
+
+    RunBatches();
+    WaitAll(Handles);
+}
+
+/** FJobSystem::Get().ParallelFor의 축약 */
+template <typename FuncType>
+void ParallelFor(int32 Num, FuncType&& Body, int32 MinBatchSize = 1)
+{
+    FJobSystem::Get().ParallelFor(Num, std::forward<FuncType>(Body), MinBatchSize);
+}
@@ -421,7 +421,8 @@ FArchive& operator<<(FArchive& Ar, TArray<ElementType, Allocator>& Array)
 
     if (Ar.IsLoading())
     {
-        // 로드 시 배열 크기 설정
+        // 로드 시 배열 크기 설정, 원소는 최소 1 Byte로 직렬화된다고 보고 깨진 크기를 거름
+        Ar.CheckLoadedNum(ArraySize, 1);
         Array.SetNum(ArraySize);
     }
 
@@ -433,3 +434,28 @@ FArchive& operator<<(FArchive& Ar, TArray<ElementType, Allocator>& Array)
 
     return Ar;
 }
+
+/**
+ * 원소마다 operator<<를 부르지 않고 배열 메모리를 한 번에 직렬화합니다.
+ * Trivially Copyable 타입만 사용할 수 있으며, 크기 뒤에 원소를 그대로 씁니다.
+ */
+template <typename ElementType, typename Allocator>
+    requires std::is_trivially_copyable_v<ElementType>
+void BulkSerialize(FArchive& Ar, TArray<ElementType, Allocator>& Array)
+{
+    using SizeType = typename TArray<ElementType, Allocator>::SizeType;
+
+    SizeType ArraySize = Array.Num();
+    Ar << ArraySize;
+
+    if (Ar.IsLoading())
+    {
+        Ar.CheckLoadedNum(ArraySize, sizeof(ElementType));
+        Array.SetNum(ArraySize);
+    }
+
+    if (ArraySize > 0)
+    {
+        Ar.Serialize(Array.GetData(), static_cast<int64>(ArraySize) * sizeof(ElementType));
+    }
+}
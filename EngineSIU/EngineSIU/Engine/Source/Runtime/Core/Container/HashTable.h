@@ -0,0 +1,390 @@
+#pragma once
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "ContainerAllocator.h"
+#include "CoreMiscDefines.h"
+
+
+/**
+ * TSet의 기본 KeyFuncs
+ * Element 자체가 Key입니다.
+ */
+template <typename ElementType, typename Hasher>
+struct TDefaultSetKeyFuncs
+{
+    using KeyType = ElementType;
+
+    static const KeyType& GetKey(const ElementType& Element) { return Element; }
+    static size_t GetKeyHash(const KeyType& Key) { return Hasher{}(Key); }
+    static bool Matches(const KeyType& A, const KeyType& B) { return A == B; }
+};
+
+/**
+ * TMap의 기본 KeyFuncs
+ * TPair의 Key를 Key로 사용합니다.
+ */
+template <typename PairType, typename InKeyType, typename Hasher>
+struct TDefaultMapKeyFuncs
+{
+    using KeyType = InKeyType;
+
+    static const KeyType& GetKey(const PairType& Element) { return Element.Key; }
+    static size_t GetKeyHash(const KeyType& Key) { return Hasher{}(Key); }
+    static bool Matches(const KeyType& A, const KeyType& B) { return A == B; }
+};
+
+
+/**
+ * TSet, TMap이 내부적으로 사용하는 Open Addressing(Robin Hood) 해시 테이블
+ *
+ * Element는 연속된 배열(Elements)에 저장되고, Slot 배열은 (Hash, Element Index)만 가지고 있습니다.
+ * - 탐색은 Slot 배열을 선형으로 훑기 때문에, 노드 기반인 std::unordered_map처럼 포인터를 따라가지 않습니다.
+ * - 순회는 Elements 배열을 그대로 훑습니다.
+ * - 삭제는 Slot을 backward shift 하고, Elements의 마지막 요소를 빈 자리로 옮깁니다. (순회 순서가 바뀝니다)
+ *
+ * @note std::unordered_map과 달리 Add/Remove 이후에는 기존 Element의 참조, 포인터, Iterator가 유효하지 않습니다.
+ *
+ * @tparam ElementType 저장할 Element 타입
+ * @tparam KeyFuncs GetKey, GetKeyHash, Matches를 제공하는 타입
+ * @tparam Allocator 메모리 할당에 사용할 Allocator, Element/Slot 타입으로 rebind 됩니다.
+ */
+template <typename ElementType, typename KeyFuncs, typename Allocator>
+class TRobinHoodHashTable
+{
+public:
+    using KeyType = typename KeyFuncs::KeyType;
+    using SizeType = int32;
+
+private:
+    struct FSlot
+    {
+        /** Element의 Hash, 0이면 비어있는 Slot */
+        uint32 Hash = 0;
+        int32 ElementIndex = INDEX_NONE;
+    };
+
+    using ElementAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<ElementType>;
+    using SlotAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<FSlot>;
+
+    /** Slot 배열의 최소 크기 */
+    static constexpr uint32 MinNumSlots = 8;
+
+    /** Element 수가 Slot 수의 7/8을 넘으면 Slot 배열을 늘립니다. */
+    static constexpr uint32 MaxLoadNumerator = 7;
+    static constexpr uint32 MaxLoadDenominator = 8;
+
+    std::vector<ElementType, ElementAllocator> Elements;
+    std::vector<FSlot, SlotAllocator> Slots;
+
+    /** Slots.size() - 1, Slot 배열의 크기는 항상 2의 거듭제곱입니다. */
+    uint32 SlotMask = 0;
+
+public:
+    TRobinHoodHashTable() = default;
+    ~TRobinHoodHashTable() = default;
+
+    TRobinHoodHashTable(const TRobinHoodHashTable&) = default;
+    TRobinHoodHashTable& operator=(const TRobinHoodHashTable&) = default;
+
+    TRobinHoodHashTable(TRobinHoodHashTable&& Other) noexcept
+        : Elements(std::move(Other.Elements))
+        , Slots(std::move(Other.Slots))
+        , SlotMask(Other.SlotMask)
+    {
+        Other.Elements.clear();
+        Other.Slots.clear();
+        Other.SlotMask = 0;
+    }
+
+    TRobinHoodHashTable& operator=(TRobinHoodHashTable&& Other) noexcept
+    {
+        if (this != &Other)
+        {
+            Elements = std::move(Other.Elements);
+            Slots = std::move(Other.Slots);
+            SlotMask = Other.SlotMask;
+
+            Other.Elements.clear();
+            Other.Slots.clear();
+            Other.SlotMask = 0;
+        }
+        return *this;
+    }
+
+public:
+    ElementType* GetData() { return Elements.data(); }
+    const ElementType* GetData() const { return Elements.data(); }
+
+    ElementType& GetElement(SizeType Index) { return Elements[Index]; }
+    const ElementType& GetElement(SizeType Index) const { return Elements[Index]; }
+
+    SizeType Num() const { return static_cast<SizeType>(Elements.size()); }
+
+    /** 현재 Slot 배열의 크기 */
+    SizeType GetNumSlots() const { return static_cast<SizeType>(Slots.size()); }
+
+    /** Key와 일치하는 Element의 Index를 반환합니다. 없으면 INDEX_NONE */
+    SizeType FindIndex(const KeyType& Key) const
+    {
+        return FindIndexByHash(Key, HashKey(Key));
+    }
+
+    /**
+     * Key에 해당하는 Element를 찾고, 없으면 ElementFactory()로 새로 만들어 추가합니다.
+     *
+     * @param Key 찾을 Key
+     * @param ElementFactory Key가 없을 때 호출되며, 추가할 Element를 반환해야 합니다.
+     * @param bOutAlreadyExists Key가 이미 존재했는지 여부
+     * @return Element의 Index
+     */
+    template <typename FactoryType>
+    SizeType FindOrAddByKey(const KeyType& Key, FactoryType&& ElementFactory, bool& bOutAlreadyExists)
+    {
+        const uint32 Hash = HashKey(Key);
+        const SizeType ExistingIndex = FindIndexByHash(Key, Hash);
+        if (ExistingIndex != INDEX_NONE)
+        {
+            bOutAlreadyExists = true;
+            return ExistingIndex;
+        }
+
+        bOutAlreadyExists = false;
+        return AddNewElement(Hash, ElementFactory());
+    }
+
+    /**
+     * Element를 추가합니다. 같은 Key의 Element가 이미 있다면 추가하지 않습니다.
+     *
+     * @param Element 추가할 Element
+     * @param bOutAlreadyExists Key가 이미 존재했는지 여부
+     * @return 추가된 Element의 Index, 이미 존재하는 경우 기존 Element의 Index
+     */
+    SizeType AddElement(ElementType&& Element, bool& bOutAlreadyExists)
+    {
+        const KeyType& Key = KeyFuncs::GetKey(Element);
+        const uint32 Hash = HashKey(Key);
+        const SizeType ExistingIndex = FindIndexByHash(Key, Hash);
+        if (ExistingIndex != INDEX_NONE)
+        {
+            bOutAlreadyExists = true;
+            return ExistingIndex;
+        }
+
+        bOutAlreadyExists = false;
+        return AddNewElement(Hash, std::move(Element));
+    }
+
+    /**
+     * Key와 일치하는 Element를 제거합니다.
+     * @return 제거된 Element의 수 (0 또는 1)
+     */
+    SizeType RemoveByKey(const KeyType& Key)
+    {
+        if (Elements.empty())
+        {
+            return 0;
+        }
+
+        const uint32 Hash = HashKey(Key);
+        uint32 SlotIndex = Hash & SlotMask;
+        for (uint32 Distance = 0; ; ++Distance, SlotIndex = (SlotIndex + 1) & SlotMask)
+        {
+            const FSlot& Slot = Slots[SlotIndex];
+            if (Slot.Hash == 0 || GetProbeDistance(Slot.Hash, SlotIndex) < Distance)
+            {
+                return 0;
+            }
+            if (Slot.Hash == Hash && KeyFuncs::Matches(KeyFuncs::GetKey(Elements[Slot.ElementIndex]), Key))
+            {
+                break;
+            }
+        }
+
+        const SizeType RemovedIndex = Slots[SlotIndex].ElementIndex;
+        RemoveSlot(SlotIndex);
+
+        // 마지막 Element를 빈 자리로 옮기고, 해당 Element를 가리키던 Slot을 갱신
+        const SizeType LastIndex = Num() - 1;
+        if (RemovedIndex != LastIndex)
+        {
+            FSlot& MovedSlot = FindSlotOfElement(LastIndex);
+            MovedSlot.ElementIndex = RemovedIndex;
+            Elements[RemovedIndex] = std::move(Elements[LastIndex]);
+        }
+        Elements.pop_back();
+        return 1;
+    }
+
+    /** 모든 Element를 제거합니다. ExpectedNum이 0보다 크면 그 만큼 공간을 미리 확보합니다. */
+    void Empty(SizeType ExpectedNum = 0)
+    {
+        Elements.clear();
+        Slots.clear();
+        SlotMask = 0;
+        if (ExpectedNum > 0)
+        {
+            Reserve(ExpectedNum);
+        }
+    }
+
+    /** Number개의 Element를 Rehash 없이 추가할 수 있도록 공간을 확보합니다. */
+    void Reserve(SizeType Number)
+    {
+        if (Number <= 0)
+        {
+            return;
+        }
+
+        Elements.reserve(Number);
+
+        const uint32 RequiredSlots = GetRequiredNumSlots(static_cast<uint32>(Number));
+        if (RequiredSlots > Slots.size())
+        {
+            Rehash(RequiredSlots);
+        }
+    }
+
+private:
+    /**
+     * KeyFuncs의 Hash를 섞어서 32bit로 만듭니다.
+     * std::hash는 포인터나 정수를 그대로 반환하는 경우가 있어서, 하위 비트만 쓰는 Slot Index가 몰리지 않도록 합니다.
+     */
+    static uint32 HashKey(const KeyType& Key)
+    {
+        uint64 Hash = static_cast<uint64>(KeyFuncs::GetKeyHash(Key));
+        Hash ^= Hash >> 33;
+        Hash *= 0xff51afd7ed558ccdULL;
+        Hash ^= Hash >> 33;
+
+        // 0은 빈 Slot을 의미하므로 사용하지 않음
+        const uint32 Result = static_cast<uint32>(Hash);
+        return Result != 0 ? Result : 1;
+    }
+
+    static uint32 GetRequiredNumSlots(uint32 NumElements)
+    {
+        const uint64 MinSlots = static_cast<uint64>(NumElements) * MaxLoadDenominator / MaxLoadNumerator + 1;
+        uint32 NumSlots = MinNumSlots;
+        while (NumSlots < MinSlots)
+        {
+            NumSlots <<= 1;
+        }
+        return NumSlots;
+    }
+
+    /** Slot이 원래 있어야 할 위치(Hash & SlotMask)에서 얼마나 떨어져 있는지 */
+    uint32 GetProbeDistance(uint32 Hash, uint32 SlotIndex) const
+    {
+        return (SlotIndex - (Hash & SlotMask)) & SlotMask;
+    }
+
+    SizeType FindIndexByHash(const KeyType& Key, uint32 Hash) const
+    {
+        if (Elements.empty())
+        {
+            return INDEX_NONE;
+        }
+
+        uint32 SlotIndex = Hash & SlotMask;
+        for (uint32 Distance = 0; ; ++Distance, SlotIndex = (SlotIndex + 1) & SlotMask)
+        {
+            const FSlot& Slot = Slots[SlotIndex];
+
+            // Robin Hood 불변식: 찾는 Key가 있었다면 이보다 먼저 나왔어야 함
+            if (Slot.Hash == 0 || GetProbeDistance(Slot.Hash, SlotIndex) < Distance)
+            {
+                return INDEX_NONE;
+            }
+            if (Slot.Hash == Hash && KeyFuncs::Matches(KeyFuncs::GetKey(Elements[Slot.ElementIndex]), Key))
+            {
+                return Slot.ElementIndex;
+            }
+        }
+    }
+
+    FSlot& FindSlotOfElement(SizeType ElementIndex)
+    {
+        const uint32 Hash = HashKey(KeyFuncs::GetKey(Elements[ElementIndex]));
+        uint32 SlotIndex = Hash & SlotMask;
+        while (Slots[SlotIndex].ElementIndex != ElementIndex)
+        {
+            SlotIndex = (SlotIndex + 1) & SlotMask;
+        }
+        return Slots[SlotIndex];
+    }
+
+    SizeType AddNewElement(uint32 Hash, ElementType&& Element)
+    {
+        const uint32 NewNum = static_cast<uint32>(Elements.size()) + 1;
+        if (static_cast<uint64>(NewNum) * MaxLoadDenominator > static_cast<uint64>(Slots.size()) * MaxLoadNumerator)
+        {
+            Rehash(GetRequiredNumSlots(NewNum));
+        }
+
+        const SizeType NewIndex = static_cast<SizeType>(Elements.size());
+        Elements.push_back(std::move(Element));
+        InsertSlot({.Hash = Hash, .ElementIndex = NewIndex});
+        return NewIndex;
+    }
+
+    /** 부자 Slot(Probe 거리가 짧은 Slot)의 자리를 빼앗으며 삽입합니다. */
+    void InsertSlot(FSlot NewSlot)
+    {
+        uint32 SlotIndex = NewSlot.Hash & SlotMask;
+        uint32 Distance = 0;
+        while (true)
+        {
+            FSlot& Slot = Slots[SlotIndex];
+            if (Slot.Hash == 0)
+            {
+                Slot = NewSlot;
+                return;
+            }
+
+            const uint32 ExistingDistance = GetProbeDistance(Slot.Hash, SlotIndex);
+            if (ExistingDistance < Distance)
+            {
+                std::swap(Slot, NewSlot);
+                Distance = ExistingDistance;
+            }
+
+            SlotIndex = (SlotIndex + 1) & SlotMask;
+            ++Distance;
+        }
+    }
+
+    /** Slot을 비우고, 뒤따르는 Slot들을 한 칸씩 당깁니다. (Tombstone을 쓰지 않음) */
+    void RemoveSlot(uint32 SlotIndex)
+    {
+        while (true)
+        {
+            const uint32 NextIndex = (SlotIndex + 1) & SlotMask;
+            const FSlot& NextSlot = Slots[NextIndex];
+            if (NextSlot.Hash == 0 || GetProbeDistance(NextSlot.Hash, NextIndex) == 0)
+            {
+                break;
+            }
+            Slots[SlotIndex] = NextSlot;
+            SlotIndex = NextIndex;
+        }
+        Slots[SlotIndex] = FSlot{};
+    }
+
+    void Rehash(uint32 NewNumSlots)
+    {
+        std::vector<FSlot, SlotAllocator> OldSlots = std::move(Slots);
+
+        Slots.assign(NewNumSlots, FSlot{});
+        SlotMask = NewNumSlots - 1;
+
+        for (const FSlot& Slot : OldSlots)
+        {
+            if (Slot.Hash != 0)
+            {
+                InsertSlot(Slot);
+            }
+        }
+    }
+};
@@ -1,7 +1,9 @@
 ﻿#pragma once
-#include <unordered_map>
+#include <cassert>
+#include <functional>
 
 #include "ContainerAllocator.h"
+#include "HashTable.h"
 #include "Pair.h"
 #include "Serialization/Archive.h"
 
@@ -11,8 +13,10 @@ class TMap
 {
 public:
     using PairType = TPair<const KeyType, ValueType>;
-    using MapType = std::unordered_map<KeyType, ValueType, std::hash<KeyType>, std::equal_to<KeyType>, Allocator>;
-    using SizeType = typename MapType::size_type;
+    using ElementType = TPair<KeyType, ValueType>;
+    using KeyFuncs = TDefaultMapKeyFuncs<ElementType, KeyType, std::hash<KeyType>>;
+    using MapType = TRobinHoodHashTable<ElementType, KeyFuncs, Allocator>;
+    using SizeType = typename MapType::SizeType;
 
 private:
     MapType ContainerPrivate;
@@ -21,33 +25,35 @@ public:
     class Iterator
     {
     private:
-        typename MapType::iterator InnerIt;
+        ElementType* InnerIt;
     public:
-        Iterator(typename MapType::iterator it) : InnerIt(std::move(it)) {}
+        Iterator(ElementType* it) : InnerIt(it) {}
         PairType& operator*() { return reinterpret_cast<PairType&>(*InnerIt); }
-        PairType* operator->() { return reinterpret_cast<PairType*>(&(*InnerIt)); }
+        PairType* operator->() { return reinterpret_cast<PairType*>(InnerIt); }
         Iterator& operator++() { ++InnerIt; return *this; }
+        bool operator==(const Iterator& other) const { return InnerIt == other.InnerIt; }
         bool operator!=(const Iterator& other) const { return InnerIt != other.InnerIt; }
     };
 
     class ConstIterator
     {
     private:
-        typename MapType::const_iterator InnerIt;
+        const ElementType* InnerIt;
     public:
-        ConstIterator(typename MapType::const_iterator it) : InnerIt(it) {}
+        ConstIterator(const ElementType* it) : InnerIt(it) {}
         const PairType& operator*() const { return reinterpret_cast<const PairType&>(*InnerIt); }
-        const PairType* operator->() const { return reinterpret_cast<const PairType*>(&(*InnerIt)); }
+        const PairType* operator->() const { return reinterpret_cast<const PairType*>(InnerIt); }
         ConstIterator& operator++() { ++InnerIt; return *this; }
+        bool operator==(const ConstIterator& other) const { return InnerIt == other.InnerIt; }
         bool operator!=(const ConstIterator& other) const { return InnerIt != other.InnerIt; }
     };
 
 public:
-    // TPair를 반환하는 커스텀 반복자
-    Iterator begin() noexcept { return Iterator(ContainerPrivate.begin()); }
-    Iterator end() noexcept { return Iterator(ContainerPrivate.end()); }
-    ConstIterator begin() const noexcept { return ConstIterator(ContainerPrivate.begin()); }
-    ConstIterator end() const noexcept { return ConstIterator(ContainerPrivate.end()); }
+    // TPair를 반환하는 커스텀 반복자, 요소가 연속된 배열에 있으므로 포인터로 순회
+    Iterator begin() noexcept { return Iterator(ContainerPrivate.GetData()); }
+    Iterator end() noexcept { return Iterator(ContainerPrivate.GetData() + ContainerPrivate.Num()); }
+    ConstIterator begin() const noexcept { return ConstIterator(ContainerPrivate.GetData()); }
+    ConstIterator end() const noexcept { return ConstIterator(ContainerPrivate.GetData() + ContainerPrivate.Num()); }
 
     MapType& GetContainerPrivate() { return ContainerPrivate; }
     const MapType& GetContainerPrivate() const { return ContainerPrivate; }
@@ -85,98 +91,122 @@ public:
     // 요소 접근 및 수정
     ValueType& operator[](const KeyType& Key)
     {
-        return ContainerPrivate[Key];
+        return FindOrAdd(Key);
     }
 
     const ValueType& operator[](const KeyType& Key) const
     {
-        return ContainerPrivate.at(Key);
+        const ValueType* Value = Find(Key);
+        assert(Value && "TMap::operator[]: Key not found");
+        return *Value;
     }
 
     void Add(const KeyType& Key, const ValueType& Value)
     {
-        ContainerPrivate.insert_or_assign(Key, Value);
+        bool bAlreadyExists;
+        const SizeType Index = ContainerPrivate.FindOrAddByKey(
+            Key, [&] { return ElementType(Key, Value); }, bAlreadyExists
+        );
+        if (bAlreadyExists)
+        {
+            ContainerPrivate.GetElement(Index).Value = Value;
+        }
     }
 
     /**
      * Map에 새로운 Key-Value를 삽입합니다.
      * @param InKey 삽입할 키
      * @param InValue 삽입할 값
-     * @return InValue의 참조
+     * @return InValue의 참조, 이미 Key가 존재한다면 기존 값의 참조
      */
     template <typename InitKeyType = KeyType, typename InitValueType = ValueType>
     ValueType& Emplace(InitKeyType&& InKey, InitValueType&& InValue)
     {
-        auto result = ContainerPrivate.emplace(std::forward<InitKeyType>(InKey), std::forward<InitValueType>(InValue));
-        return result.first->second;
+        const KeyType& Key = InKey;
+        bool bAlreadyExists;
+        const SizeType Index = ContainerPrivate.FindOrAddByKey(
+            Key,
+            [&]
+            {
+                return ElementType(
+                    KeyType(std::forward<InitKeyType>(InKey)),
+                    ValueType(std::forward<InitValueType>(InValue))
+                );
+            },
+            bAlreadyExists
+        );
+        return ContainerPrivate.GetElement(Index).Value;
     }
 
     // Key만 넣고, Value는 기본값으로 삽입
     template <typename InitKeyType = KeyType>
     ValueType& Emplace(InitKeyType&& InKey)
     {
-        auto result = ContainerPrivate.emplace(std::forward<InitKeyType>(InKey), ValueType{});
-        return result.first->second;
+        const KeyType& Key = InKey;
+        bool bAlreadyExists;
+        const SizeType Index = ContainerPrivate.FindOrAddByKey(
+            Key, [&] { return ElementType(KeyType(std::forward<InitKeyType>(InKey)), ValueType{}); }, bAlreadyExists
+        );
+        return ContainerPrivate.GetElement(Index).Value;
     }
 
     void Remove(const KeyType& Key)
     {
-        ContainerPrivate.erase(Key);
+        ContainerPrivate.RemoveByKey(Key);
     }
 
     void Empty()
     {
-        ContainerPrivate.clear();
+        ContainerPrivate.Empty();
     }
 
     void Empty(SizeType Number)
     {
-        ContainerPrivate.clear();
-        ContainerPrivate.reserve(Number);
+        ContainerPrivate.Empty(Number);
     }
 
     // 검색 및 조회
     bool Contains(const KeyType& Key) const
     {
-        return ContainerPrivate.contains(Key);
+        return ContainerPrivate.FindIndex(Key) != INDEX_NONE;
     }
 
     const ValueType* Find(const KeyType& Key) const
     {
-        auto it = ContainerPrivate.find(Key);
-        return it != ContainerPrivate.end() ? &(it->second) : nullptr;
+        const SizeType Index = ContainerPrivate.FindIndex(Key);
+        return Index != INDEX_NONE ? &ContainerPrivate.GetElement(Index).Value : nullptr;
     }
 
     ValueType* Find(const KeyType& Key)
     {
-        auto it = ContainerPrivate.find(Key);
-        return it != ContainerPrivate.end() ? &(it->second) : nullptr;
+        const SizeType Index = ContainerPrivate.FindIndex(Key);
+        return Index != INDEX_NONE ? &ContainerPrivate.GetElement(Index).Value : nullptr;
     }
 
     ValueType& FindOrAdd(const KeyType& Key)
     {
-        if (ValueType* Value = Find(Key))
-        {
-            return *Value;
-        }
-        return Emplace(Key);
+        bool bAlreadyExists;
+        const SizeType Index = ContainerPrivate.FindOrAddByKey(
+            Key, [&] { return ElementType(KeyType(Key), ValueType{}); }, bAlreadyExists
+        );
+        return ContainerPrivate.GetElement(Index).Value;
     }
 
     // 크기 관련
     SizeType Num() const
     {
-        return ContainerPrivate.size();
+        return ContainerPrivate.Num();
     }
 
     bool IsEmpty() const
     {
-        return ContainerPrivate.empty();
+        return ContainerPrivate.Num() == 0;
     }
 
     // 용량 관련
     void Reserve(SizeType Number)
     {
-        ContainerPrivate.reserve(Number);
+        ContainerPrivate.Reserve(Number);
     }
 };
 
@@ -192,6 +222,7 @@ FArchive& operator<<(FArchive& Ar, TMap<KeyType, ValueType, Allocator>& Map)
     if (Ar.IsLoading())
     {
         // 로드 시 맵 초기화
+        Ar.CheckLoadedNum(MapSize, 1);
         Map.Empty(MapSize);
 
         for (SizeType i = 0; i < MapSize; ++i)
@@ -0,0 +1,167 @@
+#include <random>
+#include <unordered_map>
+
+#include "Container/Map.h"
+#include "Container/String.h"
+#include "Misc/Benchmark.h"
+#include "UserInterface/Console.h"
+
+namespace
+{
+    /**
+     * 같은 Key로 TMap과 std::unordered_map에 Add, Find, 순회, Remove를 해서 시간을 비교합니다.
+     * @param MissingKeys Map에 없는 Key, 실패하는 Find를 측정
+     */
+    template <typename KeyType>
+    void RunMapBenchmarkWithKeys(const FBenchmarkContext& Context, const char* KeyName, const TArray<KeyType>& Keys, const TArray<KeyType>& MissingKeys)
+    {
+        const int32 NumKeys = Keys.Num();
+
+        auto Measure = [&Context, KeyName](const char* Label, int32 NumOps, auto&& Body)
+        {
+            Context.Measure((std::string(KeyName) + ' ' + Label).c_str(), NumOps, Body);
+        };
+
+        uint64 Checksum = 0;
+        TMap<KeyType, int32> Map;
+        std::unordered_map<KeyType, int32> StdMap;
+
+        Measure("Add (TMap)", NumKeys, [&]
+        {
+            for (int32 Index = 0; Index < NumKeys; ++Index)
+            {
+                Map.Add(Keys[Index], Index);
+            }
+        });
+        Measure("Add (std)", NumKeys, [&]
+        {
+            for (int32 Index = 0; Index < NumKeys; ++Index)
+            {
+                StdMap.emplace(Keys[Index], Index);
+            }
+        });
+
+        Measure("Find hit (TMap)", NumKeys, [&]
+        {
+            for (const KeyType& Key : Keys)
+            {
+                if (const int32* Value = Map.Find(Key))
+                {
+                    Checksum += *Value;
+                }
+            }
+        });
+        Measure("Find hit (std)", NumKeys, [&]
+        {
+            for (const KeyType& Key : Keys)
+            {
+                if (const auto It = StdMap.find(Key); It != StdMap.end())
+                {
+                    Checksum += It->second;
+                }
+            }
+        });
+
+        Measure("Find miss (TMap)", MissingKeys.Num(), [&]
+        {
+            for (const KeyType& Key : MissingKeys)
+            {
+                Checksum += Map.Contains(Key);
+            }
+        });
+        Measure("Find miss (std)", MissingKeys.Num(), [&]
+        {
+            for (const KeyType& Key : MissingKeys)
+            {
+                Checksum += StdMap.contains(Key);
+            }
+        });
+
+        Measure("Iterate (TMap)", NumKeys, [&]
+        {
+            for (const auto& [Key, Value] : Map)
+            {
+                Checksum += Value;
+            }
+        });
+        Measure("Iterate (std)", NumKeys, [&]
+        {
+            for (const auto& [Key, Value] : StdMap)
+            {
+                Checksum += Value;
+            }
+        });
+
+        // 절반을 지운 뒤에도 Find가 느려지지 않는지 보기 위해 하나 걸러 하나씩 제거
+        Measure("Remove half (TMap)", NumKeys / 2, [&]
+        {
+            for (int32 Index = 0; Index < NumKeys; Index += 2)
+            {
+                Map.Remove(Keys[Index]);
+            }
+        });
+        Measure("Remove half (std)", NumKeys / 2, [&]
+        {
+            for (int32 Index = 0; Index < NumKeys; Index += 2)
+            {
+                StdMap.erase(Keys[Index]);
+            }
+        });
+
+        Measure("Find after remove (TMap)", NumKeys, [&]
+        {
+            for (const KeyType& Key : Keys)
+            {
+                Checksum += Map.Contains(Key);
+            }
+        });
+        Measure("Find after remove (std)", NumKeys, [&]
+        {
+            for (const KeyType& Key : Keys)
+            {
+                Checksum += StdMap.contains(Key);
+            }
+        });
+
+        const bool bSameSize = Map.Num() == static_cast<int32>(StdMap.size());
+        Context.Console.AddLog(
+            bSameSize ? ELogLevel::Display : ELogLevel::Error, "%-8s %d keys, %d left in TMap, %llu left in std (checksum %llu)",
+            KeyName, NumKeys, Map.Num(), static_cast<uint64>(StdMap.size()), Checksum
+        );
+    }
+
+    /**
+     * UObject 포인터처럼 흩어진 주소값 Key와, 설정 파일과 Property 이름 같은 FString Key로 TMap을 측정합니다.
+     * 같은 개수로 다시 실행하면 같은 Key가 만들어집니다.
+     */
+    void RunMapBenchmark(const FBenchmarkContext& Context)
+    {
+        const int32 NumKeys = Context.Count;
+        std::mt19937_64 Random(static_cast<uint64>(NumKeys));
+
+        TArray<uint64> AddressKeys;
+        TArray<uint64> MissingAddressKeys;
+        TArray<FString> StringKeys;
+        TArray<FString> MissingStringKeys;
+        AddressKeys.Reserve(NumKeys);
+        MissingAddressKeys.Reserve(NumKeys);
+        StringKeys.Reserve(NumKeys);
+        MissingStringKeys.Reserve(NumKeys);
+
+        for (int32 Index = 0; Index < NumKeys; ++Index)
+        {
+            // Heap 할당 주소처럼 16 Byte 정렬
+            AddressKeys.Add(Random() & ~0xFull);
+            MissingAddressKeys.Add(Random() & ~0xFull);
+            StringKeys.Add(FString::Printf(TEXT("Actor_%d.RelativeLocation"), Index));
+            MissingStringKeys.Add(FString::Printf(TEXT("Missing_%d.RelativeLocation"), Index));
+        }
+
+        RunMapBenchmarkWithKeys(Context, "Address", AddressKeys, MissingAddressKeys);
+        RunMapBenchmarkWithKeys(Context, "FString", StringKeys, MissingStringKeys);
+    }
+
+    FAutoRegisterBenchmark MapBenchmark(
+        "map bench", "[count]: Compare TMap Add, Find, iteration and Remove against std::unordered_map", 100000, &RunMapBenchmark
+    );
+}
@@ -1,23 +1,27 @@
 ﻿#pragma once
-#include <unordered_set>
+#include <functional>
 
 #include "Array.h"
 #include "ContainerAllocator.h"
+#include "HashTable.h"
 
 
 template <typename T, typename Hasher = std::hash<T>, typename Allocator = FDefaultAllocator<T>>
 class TSet
 {
 private:
-    using SetType = std::unordered_set<T, Hasher, std::equal_to<>, Allocator>;
+    using KeyFuncs = TDefaultSetKeyFuncs<T, Hasher>;
+    using SetType = TRobinHoodHashTable<T, KeyFuncs, Allocator>;
     using ElementType = T;
 
     SetType ContainerPrivate;
 
 public:
     using SizeType = typename Allocator::SizeType;
-    using Iterator = typename SetType::iterator;
-    using ConstIterator = typename SetType::const_iterator;
+
+    // Set의 요소는 Hash에 영향을 주므로 const로만 접근
+    using Iterator = const T*;
+    using ConstIterator = const T*;
 
     SetType& GetContainerPrivate() { return ContainerPrivate; }
     const SetType& GetContainerPrivate() const { return ContainerPrivate; }
@@ -25,11 +29,11 @@ public:
     // 기본 생성자
     TSet() = default;
 
-    // Iterator 관련 메서드
-    Iterator begin() noexcept { return ContainerPrivate.begin(); }
-    Iterator end() noexcept { return ContainerPrivate.end(); }
-    ConstIterator begin() const noexcept { return ContainerPrivate.begin(); }
-    ConstIterator end() const noexcept { return ContainerPrivate.end(); }
+    // Iterator 관련 메서드, 요소가 연속된 배열에 있으므로 포인터로 순회
+    Iterator begin() noexcept { return ContainerPrivate.GetData(); }
+    Iterator end() noexcept { return ContainerPrivate.GetData() + ContainerPrivate.Num(); }
+    ConstIterator begin() const noexcept { return ContainerPrivate.GetData(); }
+    ConstIterator end() const noexcept { return ContainerPrivate.GetData() + ContainerPrivate.Num(); }
 
     // Add
     int32 Add(const T& Item) { return Emplace(Item); }
@@ -44,26 +48,40 @@ public:
     template<typename ArgsType = T>
     int32 Emplace(ArgsType&& Args) 
     { 
-        auto iter = ContainerPrivate.emplace(std::forward<ArgsType>(Args));
-        return std::distance(ContainerPrivate.begin(), iter.first);
+        bool bAlreadyExists;
+        return ContainerPrivate.AddElement(T(std::forward<ArgsType>(Args)), bAlreadyExists);
     }
 
+    /**
+     * Index번째 요소를 반환합니다. (0 <= Index < Num())
+     * @note Add/Remove 이후에는 같은 Index가 다른 요소를 가리킬 수 있습니다.
+     */
+    const T& operator[](int32 Index) const { return ContainerPrivate.GetElement(Index); }
+
     // Num (개수)
-    SizeType Num() const { return static_cast<SizeType>(ContainerPrivate.size()); }
+    SizeType Num() const { return static_cast<SizeType>(ContainerPrivate.Num()); }
 
     // Find
-    Iterator Find(const T& Item) { return ContainerPrivate.find(Item); }
-    ConstIterator Find(const T& Item) const { return ContainerPrivate.find(Item); }
+    Iterator Find(const T& Item)
+    {
+        const int32 Index = ContainerPrivate.FindIndex(Item);
+        return Index != INDEX_NONE ? &ContainerPrivate.GetElement(Index) : end();
+    }
+    ConstIterator Find(const T& Item) const
+    {
+        const int32 Index = ContainerPrivate.FindIndex(Item);
+        return Index != INDEX_NONE ? &ContainerPrivate.GetElement(Index) : end();
+    }
 
     // Contains
-    bool Contains(const T& Item) const { return ContainerPrivate.contains(Item); }
+    bool Contains(const T& Item) const { return ContainerPrivate.FindIndex(Item) != INDEX_NONE; }
 
     // Array (TArray로 반환)
     TArray<T, Allocator> Array() const
     {
         TArray<T, Allocator> Result;
         Result.Reserve(Num());
-        for (const auto& Item : ContainerPrivate)
+        for (const auto& Item : *this)
         {
             Result.Add(Item);
         }
@@ -71,18 +89,17 @@ public:
     }
 
     // Remove
-    SizeType Remove(const T& Item) { return static_cast<SizeType>(ContainerPrivate.erase(Item)); }
+    SizeType Remove(const T& Item) { return static_cast<SizeType>(ContainerPrivate.RemoveByKey(Item)); }
 
     // Empty
-    void Empty() { ContainerPrivate.clear(); }
-    void Empty(SizeType Number)
-    {
-        ContainerPrivate.clear();
-        ContainerPrivate.reserve(Number);
-    }
+    void Empty() { ContainerPrivate.Empty(); }
+    void Empty(SizeType Number) { ContainerPrivate.Empty(Number); }
+
+    // Reserve
+    void Reserve(SizeType Number) { ContainerPrivate.Reserve(Number); }
 
     // IsEmpty
-    bool IsEmpty() const { return ContainerPrivate.empty(); }
+    bool IsEmpty() const { return ContainerPrivate.Num() == 0; }
 };
 
 template <typename ElementType, typename Hasher, class Allocator>
@@ -98,6 +115,7 @@ FArchive& operator<<(FArchive& Ar, TSet<ElementType, Hasher, Allocator>& Set)
     if (Ar.IsLoading())
     {
         // 로드 시 집합 초기화
+        Ar.CheckLoadedNum(SetSize, 1);
         Set.Empty(SetSize);
 
         for (SizeType i = 0; i < SetSize; ++i)
@@ -1,12 +1,169 @@
 #include "String.h"
 #include <algorithm>
-#include <vector>
+#include <cstdarg>
 #include <charconv>
 
 #include "CoreMiscDefines.h"
 #include "Math/MathUtility.h"
 
 
+FString::~FString()
+{
+    ReleaseHeap();
+}
+
+FString::FString(const FString& Other)
+    : FString(Other.GetBuffer(), Other.Length)
+{
+}
+
+FString& FString::operator=(const FString& Other)
+{
+    if (this != &Other)
+    {
+        // 용량이 충분하면 기존 버퍼를 재사용, Other가 비어 있으면 Append가 아무것도 쓰지 않으므로 먼저 비움
+        Empty();
+        Append(Other.GetBuffer(), Other.Length);
+    }
+    return *this;
+}
+
+FString::FString(FString&& Other) noexcept
+{
+    InlineData[0] = 0;
+    *this = std::move(Other);
+}
+
+FString& FString::operator=(FString&& Other) noexcept
+{
+    if (this == &Other)
+    {
+        return *this;
+    }
+
+    ReleaseHeap();
+
+    // Heap 버퍼는 포인터만 가져오고, Inline 버퍼는 복사
+    Length = Other.Length;
+    Capacity = Other.Capacity;
+    if (Other.IsInline())
+    {
+        memcpy(InlineData, Other.InlineData, sizeof(ElementType) * (Length + 1));
+    }
+    else
+    {
+        HeapData = Other.HeapData;
+        Other.Capacity = NumInlineChars;
+    }
+
+    Other.Length = 0;
+    Other.InlineData[0] = 0;
+    return *this;
+}
+
+FString::FString(const ElementType* InString, int32 InLength)
+{
+    InlineData[0] = 0;
+    Append(InString, InLength);
+}
+
+#if USE_WIDECHAR
+FString::FString(FAnsiStringView InUtf8)
+{
+    InlineData[0] = 0;
+    if (InUtf8.IsEmpty())
+    {
+        return;
+    }
+
+    const int32 Size = ::MultiByteToWideChar(CP_UTF8, 0, InUtf8.GetData(), InUtf8.Len(), nullptr, 0);
+    Resize(Size);
+    ::MultiByteToWideChar(CP_UTF8, 0, InUtf8.GetData(), InUtf8.Len(), GetBuffer(), Size);
+}
+#else
+FString::FString(FWideStringView InUtf16)
+{
+    InlineData[0] = 0;
+    if (InUtf16.IsEmpty())
+    {
+        return;
+    }
+
+    const int32 Size = ::WideCharToMultiByte(CP_UTF8, 0, InUtf16.GetData(), InUtf16.Len(), nullptr, 0, nullptr, nullptr);
+    Resize(Size);
+    ::WideCharToMultiByte(CP_UTF8, 0, InUtf16.GetData(), InUtf16.Len(), GetBuffer(), Size, nullptr, nullptr);
+}
+#endif
+
+void FString::ReleaseHeap()
+{
+    if (!IsInline())
+    {
+        FPlatformMemory::Free<EAT_Container>(HeapData, sizeof(ElementType) * (Capacity + 1));
+        Capacity = NumInlineChars;
+    }
+    Length = 0;
+    InlineData[0] = 0;
+}
+
+void FString::Grow(int32 NewCapacity)
+{
+    if (NewCapacity <= Capacity)
+    {
+        return;
+    }
+
+    // 이어 붙이기가 반복될 때 재할당 횟수를 줄이기 위해 최소 1.5배로 늘림
+    NewCapacity = FMath::Max(NewCapacity, Capacity + Capacity / 2);
+
+    ElementType* NewData = static_cast<ElementType*>(
+        FPlatformMemory::Malloc<EAT_Container>(sizeof(ElementType) * (NewCapacity + 1))
+    );
+    memcpy(NewData, GetBuffer(), sizeof(ElementType) * (Length + 1));
+
+    const int32 OldLength = Length;
+    ReleaseHeap();
+
+    HeapData = NewData;
+    Capacity = NewCapacity;
+    Length = OldLength;
+}
+
+void FString::Append(const ElementType* Str, int32 Count)
+{
+    if (Count <= 0)
+    {
+        return;
+    }
+
+    const ElementType* Buffer = GetBuffer();
+    if (Length + Count > Capacity && Str >= Buffer && Str < Buffer + Capacity + 1)
+    {
+        // 자기 자신의 일부를 붙이는데 재할당이 필요하면, 해제되기 전에 복사해 둠
+        const FString Copy(Str, Count);
+        Append(Copy.GetBuffer(), Copy.Length);
+        return;
+    }
+
+    Grow(Length + Count);
+
+    ElementType* Data = GetBuffer();
+    memmove(Data + Length, Str, sizeof(ElementType) * Count);
+    Length += Count;
+    Data[Length] = 0;
+}
+
+int32 FString::Compare(const FString& Rhs) const
+{
+    const int32 MinLength = FMath::Min(Length, Rhs.Length);
+    const int32 Result = std::char_traits<ElementType>::compare(GetBuffer(), Rhs.GetBuffer(), MinLength);
+    if (Result != 0)
+    {
+        return Result;
+    }
+    return Length == Rhs.Length ? 0 : (Length < Rhs.Length ? -1 : 1);
+}
+
 FString FString::SanitizeFloat(float InFloat)
 {
 #if USE_WIDECHAR
@@ -16,14 +173,14 @@ FString FString::SanitizeFloat(float InFloat)
 #endif
 }
 
-float FString::ToFloat(const FString& InString)
+float FString::ToFloat(FStringView InString)
 {
     if (InString.IsEmpty())
     {
         return 0.0f;
     }
 
-    const ElementType* const Ptr = *InString;
+    const ElementType* const Ptr = InString.GetData();
     const ElementType* const EndPtr = Ptr + InString.Len();
     float Value = 0.0f;
     auto Result = std::from_chars(Ptr, EndPtr, Value); // TCHAR가 char 또는 wchar_t일 때 작동
@@ -43,14 +200,14 @@ float FString::ToFloat(const FString& InString)
     }
 }
 
-int FString::ToInt(const FString& InString)
+int FString::ToInt(FStringView InString)
 {
     if (InString.IsEmpty())
     {
         return 0;
     }
 
-    const ElementType* const Ptr = *InString;
+    const ElementType* const Ptr = InString.GetData();
     const ElementType* const EndPtr = Ptr + InString.Len();
     int Value = 0;
 
@@ -122,139 +279,36 @@ FString FString::RightChop(int32 Count) const
         return FString{}; // 기본 생성된 빈 FString 반환
     }
 
-    // std::basic_string::substr(pos)는 위치 pos부터 끝까지의 부분 문자열을 반환합니다.
     // Count는 제거할 문자의 개수이므로, 부분 문자열은 Count 인덱스부터 시작합니다.
-    // static_cast<size_t>는 substr이 size_t를 인자로 받기 때문에 필요합니다.
-    BaseStringType Substring = PrivateString.substr(Count);
-
-    // 추출된 부분 문자열로 새로운 FString 객체를 생성하여 반환
-    // std::move를 사용하면 불필요한 복사를 피할 수 있습니다 (C++11 이상).
-    return FString{std::move(Substring)};
+    return FString{GetBuffer() + Count, MyLen - Count};
 }
 
 void FString::Empty()
 {
-    PrivateString.clear();
+    // std::string::clear와 같이 용량은 유지
+    Length = 0;
+    GetBuffer()[0] = 0;
 }
 
-bool FString::Equals(const FString& Other, ESearchCase::Type SearchCase) const
+bool FString::Equals(FStringView Other, ESearchCase::Type SearchCase) const
 {
-    const int32 Num = Len();
-    const int32 OtherNum = Other.Len();
-
-    // 길이가 다르면 무조건 false
-    if (Num != OtherNum)
-    {
-        return false;
-    }
-
-    // 길이가 0이면 무조건 true (위에서 길이가 같다고 확인됨)
-    if (Num == 0)
-    {
-        return true;
-    }
-
-    // 길이가 1 이상이면 내용을 비교
-    if (SearchCase == ESearchCase::CaseSensitive)
-    {
-        return FCString::Strcmp(**this, *Other) == 0;
-    }
-    else // ESearchCase::IgnoreCase
-    {
-        return FCString::Stricmp(**this, *Other) == 0;
-    }
+    return FStringView(*this).Equals(Other, SearchCase);
 }
 
-bool FString::Contains(const FString& SubStr, ESearchCase::Type SearchCase, ESearchDir::Type SearchDir) const
+bool FString::Contains(FStringView SubStr, ESearchCase::Type SearchCase, ESearchDir::Type SearchDir) const
 {
     return Find(SubStr, SearchCase, SearchDir, 0) != INDEX_NONE;
 }
 
 int32 FString::Find(
-    const FString& SubStr, ESearchCase::Type SearchCase, ESearchDir::Type SearchDir, int32 StartPosition
+    FStringView SubStr, ESearchCase::Type SearchCase, ESearchDir::Type SearchDir, int32 StartPosition
 ) const
 {
-    if (SubStr.IsEmpty() || IsEmpty())
-    {
-        return INDEX_NONE; // -1
-    }
-
-    const int32 StrLen = Len();
-    const int32 SubStrLen = SubStr.Len();
-
-    // 찾으려는 부분 문자열이 원본보다 길면 절대 찾을 수 없음
-    if (SubStrLen > StrLen)
+    if (IsEmpty())
     {
         return INDEX_NONE;
     }
-
-    const ElementType* const StrPtr = **this;
-    const ElementType* const SubStrPtr = *SubStr;
-
-    // 대소문자 비교 함수 (FCString 사용 권장)
-    auto CompareFunc = [SearchCase](ElementType A, ElementType B) -> bool
-    {
-        if (SearchCase == ESearchCase::IgnoreCase)
-        {
-            return FCString::ToLower(A) == FCString::ToLower(B);
-        }
-        else
-        {
-            return A == B;
-        }
-    };
-
-    // 부분 문자열을 찾는 내부 람다 함수
-    // [SearchStartIndex, SearchEndIndex) 범위에서 Step 방향으로 검색
-    auto FindSubString = [&](int32 SearchStartIndex, int32 SearchEndIndex, int32 Step) -> int32
-    {
-        for (int32 i = SearchStartIndex; i != SearchEndIndex; i += Step)
-        {
-            // 현재 위치 'i'에서 시작하는 부분 문자열이 SubStr과 일치하는지 확인
-            bool Found = true;
-            for (int32 j = 0; j < SubStrLen; ++j)
-            {
-                // 경계 검사: i + j 가 StrLen을 넘지 않도록 확인 (특히 FromEnd 검색 시 중요)
-                // 이 로직에서는 외부에서 시작/종료 인덱스를 잘 설정하여 불필요할 수 있으나, 안전하게 추가 가능
-                // if (i + j >= StrLen) { Found = false; break; }
-                if (!CompareFunc(StrPtr[i + j], SubStrPtr[j]))
-                {
-                    Found = false;
-                    break;
-                }
-            }
-            if (Found)
-            {
-                return i; // 일치하는 부분 문자열의 시작 인덱스 반환
-            }
-        }
-        return INDEX_NONE; // 찾지 못함
-    };
-
-    if (SearchDir == ESearchDir::FromStart)
-    {
-        // 시작 위치 보정: 0 이상, (문자열 길이 - 부분 문자열 길이) 이하
-        const int32 EffectiveStartPosition = FMath::Clamp(StartPosition, 0, StrLen - SubStrLen);
-        // 검색 범위: [EffectiveStartPosition, StrLen - SubStrLen + 1)
-        // 마지막 가능한 시작 위치는 StrLen - SubStrLen
-        return FindSubString(EffectiveStartPosition, StrLen - SubStrLen + 1, 1);
-    }
-    else // ESearchDir::FromEnd
-    {
-        // 검색을 시작할 최대 인덱스 계산
-        const int32 MaxStartIndex = (StartPosition == INDEX_NONE)
-                               ? (StrLen - SubStrLen) // 지정 안되면 마지막 가능한 위치부터
-                               : FMath::Min(StartPosition, StrLen - SubStrLen); // 지정되면 그 위치까지만
-
-        // 시작 위치가 음수면 검색 불가
-        if (MaxStartIndex < 0)
-        {
-            return INDEX_NONE;
-        }
-
-        // 검색 범위: [MaxStartIndex, -1) 즉, MaxStartIndex 부터 0 까지 역방향 검색
-        return FindSubString(MaxStartIndex, -1, -1);
-    }
+    return FStringView(*this).Find(SubStr, SearchCase, SearchDir, StartPosition);
 }
 
 int32 FString::FindChar(
@@ -276,7 +330,7 @@ int32 FString::FindChar(
     {
         for (int32 i = StartPosition; i < MyLen; ++i)
         {
-            ElementType CurrentChar = PrivateString[i];
+            ElementType CurrentChar = GetBuffer()[i];
             ElementType CurrentCharCompare = (SearchCase == ESearchCase::IgnoreCase) ? FCString::ToLower(CurrentChar) : CurrentChar;
             if (CurrentCharCompare == CharToFindLower)
             {
@@ -294,7 +348,7 @@ int32 FString::FindChar(
 
         for (int32 i = ActualStartPosition; i >= 0; --i)
         {
-            ElementType CurrentChar = PrivateString[i];
+            ElementType CurrentChar = GetBuffer()[i];
             ElementType CurrentCharCompare = (SearchCase == ESearchCase::IgnoreCase) ? FCString::ToLower(CurrentChar) : CurrentChar;
             if (CurrentCharCompare == CharToFindLower)
             {
@@ -308,70 +362,67 @@ int32 FString::FindChar(
 
 void FString::Reserve(int32 CharacterCount)
 {
-    PrivateString.reserve(CharacterCount);
+    Grow(CharacterCount);
 }
 
 void FString::Resize(int32 CharacterCount)
 {
-    PrivateString.resize(CharacterCount);
+    CharacterCount = FMath::Max(CharacterCount, 0);
+    Grow(CharacterCount);
+
+    ElementType* Data = GetBuffer();
+    if (CharacterCount > Length)
+    {
+        memset(Data + Length, 0, sizeof(ElementType) * (CharacterCount - Length));
+    }
+    Length = CharacterCount;
+    Data[Length] = 0;
 }
 
 FString FString::ToUpper() const &
 {
-    BaseStringType UpperCaseString = PrivateString;
-    std::ranges::transform(
-        UpperCaseString,
-        UpperCaseString.begin(),
-        [](ElementType Char) { return FCString::ToUpper(Char); }
-    );
-    return FString{std::move(UpperCaseString)};
+    FString UpperCaseString = *this;
+    UpperCaseString.ToUpperInline();
+    return UpperCaseString;
 }
 
 FString FString::ToUpper() &&
 {
-    std::ranges::transform(
-        PrivateString,
-        PrivateString.begin(),
-        [](ElementType Char) { return FCString::ToUpper(Char); }
-    );
+    ToUpperInline();
     return std::move(*this);
 }
 
 void FString::ToUpperInline()
 {
-    std::ranges::transform(
-        PrivateString,
-        PrivateString.begin(),
+    ElementType* Data = GetBuffer();
+    std::transform(
+        Data,
+        Data + Length,
+        Data,
         [](ElementType Char) { return FCString::ToUpper(Char); }
     );
 }
 
 FString FString::ToLower() const &
 {
-    BaseStringType LowerCaseString = PrivateString;
-    std::ranges::transform(
-        LowerCaseString,
-        LowerCaseString.begin(),
-        [](ElementType Char) { return FCString::ToLower(Char); }
-    );
-    return FString{std::move(LowerCaseString)};
+    FString LowerCaseString = *this;
+    LowerCaseString.ToLowerInline();
+    return LowerCaseString;
 }
 
 FString FString::ToLower() &&
 {
-    std::ranges::transform(
-        PrivateString,
-        PrivateString.begin(),
-        [](ElementType Char) { return FCString::ToLower(Char); }
-    );
+    ToLowerInline();
     return std::move(*this);
 }
 
 void FString::ToLowerInline()
 {
-    std::ranges::transform(
-        PrivateString,
-        PrivateString.begin(),
+    ElementType* Data = GetBuffer();
+    std::transform(
+        Data,
+        Data + Length,
+        Data,
         [](ElementType Char) { return FCString::ToLower(Char); }
     );
 }
@@ -394,10 +445,7 @@ FString FString::Mid(int32 Start, int32 Count) const
         return FString{};
     }
 
-    // Use std::basic_string::substr
-    // substr(pos, count)
-    BaseStringType Sub = PrivateString.substr(Start, Count);
-    return FString{std::move(Sub)};
+    return FString{GetBuffer() + Start, Count};
 }
 
 FString FString::Left(int32 Count) const
@@ -411,48 +459,45 @@ FString FString::Left(int32 Count) const
         return FString{};
     }
 
-    // Use std::basic_string::substr
-    // substr(pos, count) - starting from pos 0
-    BaseStringType Sub = PrivateString.substr(0, static_cast<size_t>(Count));
-    return FString{std::move(Sub)};
+    return FString{GetBuffer(), Count};
 }
 
-bool FString::RemoveFromStart(const FString& InPrefix, ESearchCase::Type SearchCase)
+bool FString::RemoveFromStart(FStringView InPrefix, ESearchCase::Type SearchCase)
 {
     const int32 PrefixLen = InPrefix.Len();
-    const int32 MyLen = Len();
-
-    if (PrefixLen == 0 || PrefixLen > MyLen)
+    if (PrefixLen == 0 || !FStringView(*this).StartsWith(InPrefix, SearchCase))
     {
-        return false; // Cannot remove an empty or longer prefix
+        return false;
     }
 
-    // Check if the string actually starts with the prefix
-    bool bStartsWithPrefix = false;
-    if (SearchCase == ESearchCase::CaseSensitive)
-    {
-        // Use std::basic_string::compare for case-sensitive comparison
-        bStartsWithPrefix = (PrivateString.compare(0, PrefixLen, *InPrefix) == 0);
-    }
-    else // ESearchCase::IgnoreCase
+    // InPrefix가 자기 자신을 가리킬 수도 있으므로 비교가 끝난 뒤에 옮김
+    ElementType* Data = GetBuffer();
+    Length -= PrefixLen;
+    memmove(Data, Data + PrefixLen, sizeof(ElementType) * (Length + 1));
+    return true;
+}
+
+namespace
+{
+    /** 성공 시 필요한 문자 수(널 제외)를, Buffer가 부족하면 필요한 문자 수 또는 -1을 반환 */
+    int32 FormatString(FString::ElementType* Buffer, size_t BufferSize, const FString::ElementType* Format, va_list ArgPtr)
     {
-        // Perform case-insensitive comparison manually or using ranges::equal
-        bStartsWithPrefix = std::ranges::equal(
-            PrivateString.begin(), PrivateString.begin() + PrefixLen,
-            InPrefix.PrivateString.begin(), InPrefix.PrivateString.end(),
-            [](ElementType a, ElementType b) { return FCString::ToLower(a) == FCString::ToLower(b); }
-        );
+#if USE_WIDECHAR
+        // vswprintf는 Buffer가 부족하면 필요한 크기 대신 -1을 반환
+        return vswprintf(Buffer, BufferSize, Format, ArgPtr);
+#else
+        return vsnprintf(Buffer, BufferSize, Format, ArgPtr);
+#endif
     }
 
-    if (bStartsWithPrefix)
+    int32 GetFormattedLength(const FString::ElementType* Format, va_list ArgPtr)
     {
-        // If it starts with the prefix, remove it using erase or assign with substr
-        // erase(pos, count)
-        PrivateString.erase(0, PrefixLen);
-        return true;
+#if USE_WIDECHAR
+        return _vscwprintf(Format, ArgPtr);
+#else
+        return vsnprintf(nullptr, 0, Format, ArgPtr);
+#endif
     }
-
-    return false; // Prefix not found at the start
 }
 
 // Printf 함수 구현
@@ -463,62 +508,40 @@ FString FString::Printf(const ElementType* Format, ...)
         return FString{};
     }
 
+    // 대부분의 문자열은 Stack Buffer 한 번으로 끝나고, 결과 FString만 할당함
+    constexpr int32 StackBufferSize = 512;
+    ElementType StackBuffer[StackBufferSize];
+
     va_list ArgPtr;
-    int32 Result = -1;
-    std::vector<ElementType> Buffer; // 동적 버퍼 사용
+    va_start(ArgPtr, Format);
+    int32 Result = FormatString(StackBuffer, StackBufferSize, Format, ArgPtr);
+    va_end(ArgPtr);
 
-    // 필요한 버퍼 크기를 추정하며 반복
-    int32 BufferSize = 512; // 초기 시도 크기
-    while (true)
+    if (Result >= 0 && Result < StackBufferSize)
     {
-        Buffer.resize(BufferSize); // 버퍼 크기 조정
+        return FString{StackBuffer, Result};
+    }
 
-        va_start(ArgPtr, Format); // 각 시도마다 va_list 재시작 필요
-#if USE_WIDECHAR
-    #ifdef _WIN32
-        // _vsnwprintf는 널 종료를 보장하지 않을 수 있으며, 성공 시 문자 수(널 제외) 또는 버퍼가 작으면 -1 반환
-        // _TRUNCATE 플래그를 사용하면 버퍼에 맞게 잘라주고 널 종료를 보장하며 성공 시 문자 수(널 미포함), 잘렸으면 -1 반환
-        Result = _vsnwprintf_s(Buffer.data(), Buffer.size(), _TRUNCATE, Format, ArgPtr);
-        // _vsnwprintf_s는 성공해도 버퍼가 꽉 찼으면 -1 반환 가능. 필요한 크기를 알려주지 않음.
-        // 따라서 아래 C99 표준 vsnprintf/vswprintf 방식 사용이 더 효과적일 수 있음 (Windows에서도 사용 가능).
-        // 여기서는 일단 C99 표준 함수를 우선 사용하도록 수정
-    #endif
-    // C99 vswprintf (대부분의 현대 컴파일러에서 지원, Windows 포함)
-    // 성공 시: 필요한 문자 수 (널 제외) 반환. 버퍼 크기보다 작으면 버퍼에 쓰여짐.
-    // 버퍼 부족 시: 필요한 문자 수 (널 제외) 반환. 버퍼 내용은 미정의.
-    // 오류 시: 음수 반환.
-    Result = vswprintf(Buffer.data(), Buffer.size(), Format, ArgPtr);
-
-#else // TCHAR == char
-        // C99 vsnprintf
-        // 성공 시: 필요한 문자 수 (널 제외) 반환. 버퍼 크기보다 작으면 버퍼에 쓰여짐.
-        // 버퍼 부족 시: 필요한 문자 수 (널 제외) 반환. 버퍼 내용은 미정의.
-        // 오류 시: 음수 반환.
-        Result = vsnprintf(Buffer.data(), Buffer.size(), Format, ArgPtr);
-#endif
+    // Buffer가 부족하면 필요한 길이를 구해서 결과 FString에 바로 씀
+    if (Result < 0)
+    {
+        va_start(ArgPtr, Format);
+        Result = GetFormattedLength(Format, ArgPtr);
         va_end(ArgPtr);
 
-        // 결과 확인
         if (Result < 0)
         {
-            // 포맷팅 오류 발생
-            // 오류 로그 출력 가능
-            return FString{}; // 빈 문자열 반환
-        }
-        else if (Result < BufferSize)
-        {
-            // 성공: 버퍼가 충분했음. Result는 쓰여진 문자 수 (널 제외).
-            // Buffer.data()는 이미 널 종료된 상태(vsnprintf/vswprintf가 보장).
-            // 필요한 경우 Buffer.resize(Result); 로 정확한 크기로 줄일 수 있음.
-            return FString{BaseStringType(Buffer.data())};
-        }
-        else // Result >= BufferSize
-        {
-            // 버퍼 부족: Result는 필요한 버퍼 크기 (널 포함).
-            // 필요한 크기 + 1 (널 문자 공간)으로 버퍼 재할당 후 재시도.
-            BufferSize = Result + 1;
-            // 무한 루프 방지 (매우 큰 문자열 등) - 필요시 최대 크기 제한 추가 가능
-            // if (BufferSize > SOME_MAX_LIMIT) { return FString{}; }
+            // 포맷팅 오류
+            return FString{};
         }
     }
+
+    FString Formatted;
+    Formatted.Resize(Result);
+
+    va_start(ArgPtr, Format);
+    FormatString(Formatted.GetBuffer(), static_cast<size_t>(Result) + 1, Format, ArgPtr);
+    va_end(ArgPtr);
+
+    return Formatted;
 }
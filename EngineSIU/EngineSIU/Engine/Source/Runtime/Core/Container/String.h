@@ -1,9 +1,11 @@
 #pragma once
 
+#include <charconv>
 #include <string>
 #include "CString.h"
 #include "ContainerAllocator.h"
 #include "StringConv.h"
+#include "StringView.h"
 #include "Core/HAL/PlatformType.h"
 #include "Math/NumericLimits.h"
 
@@ -19,100 +21,85 @@
 3. std::string에서 FString 생성
 */
 
-/** Determines case sensitivity options for string comparisons. */
-namespace ESearchCase
-{
-enum Type : uint8
-{
-    /** Case sensitive. Upper/lower casing must match for strings to be considered equal. */
-    CaseSensitive,
-
-    /** Ignore case. Upper/lower casing does not matter when making a comparison. */
-    IgnoreCase,
-};
-}
-
-/** Determines search direction for string operations. */
-namespace ESearchDir
-{
-enum Type : uint8
-{
-    /** Search from the start, moving forward through the string. */
-    FromStart,
-
-    /** Search from the end, moving backward through the string. */
-    FromEnd,
-};
-}
-
 class FString
 {
 public:
     using ElementType = TCHAR;
 
+    /**
+     * 이 길이(null 문자 제외)까지는 Heap 할당 없이 FString 안의 버퍼에 저장합니다.
+     * Actor 이름, Property Key, 짧은 경로 같은 대부분의 Engine 문자열이 여기에 들어갑니다.
+     */
+    static constexpr int32 NumInlineChars = 40 / sizeof(ElementType) - 1;
+
 private:
-    using BaseStringType = std::basic_string<
-        ElementType,
-        std::char_traits<ElementType>,
-        FDefaultAllocator<ElementType>
-    >;
+    union
+    {
+        ElementType InlineData[NumInlineChars + 1];
+        ElementType* HeapData;
+    };
 
-    using SizeType = FDefaultAllocator<ElementType>::SizeType;
+    int32 Length = 0;
 
-    BaseStringType PrivateString;
+    // null 문자를 제외한 용량, NumInlineChars보다 크면 HeapData를 사용
+    int32 Capacity = NumInlineChars;
 
-	friend struct std::hash<FString>;
     friend ElementType* GetData(FString&);
     friend const ElementType* GetData(const FString&);
 
 public:
-    BaseStringType& GetContainerPrivate() { return PrivateString; }
-    const BaseStringType& GetContainerPrivate() const { return PrivateString; }
-
 #if USE_WIDECHAR
-    explicit operator std::wstring() const { return std::wstring(PrivateString); }
+    explicit operator std::wstring() const { return std::wstring(GetBuffer(), Length); }
 #else
-    explicit operator std::string() const { return std::string(PrivateString); }
+    explicit operator std::string() const { return std::string(GetBuffer(), Length); }
 #endif
 
-    FString() = default;
-    ~FString() = default;
+    /** 복사 없이 이 문자열을 가리키는 View, FString보다 오래 쓰면 안 됨 */
+    FORCEINLINE operator FStringView() const { return {GetBuffer(), Length}; }
+
+    FString() { InlineData[0] = 0; }
+    ~FString();
 
-    FString(const FString&) = default;
-    FString& operator=(const FString&) = default;
-    FString(FString&&) = default;
-    FString& operator=(FString&&) = default;
+    FString(const FString& Other);
+    FString& operator=(const FString& Other);
+    FString(FString&& Other) noexcept;
+    FString& operator=(FString&& Other) noexcept;
 
-    FString(BaseStringType InString) : PrivateString(std::move(InString)) {}
+    FString(const ElementType* InString, int32 InLength);
+    explicit FString(FStringView InView) : FString(InView.GetData(), InView.Len()) {}
 
 public:
 #if USE_WIDECHAR
-    FString(const std::wstring& InString) : PrivateString(InString) {}
-    FString(const WIDECHAR* InString) : PrivateString(InString) {}
-    FString(const std::string& InString) : PrivateString(StringToWString(InString)) {}
-    FString(const ANSICHAR* InString) : PrivateString(StringToWString(InString)) {}
+    FString(const std::wstring& InString) : FString(InString.data(), static_cast<int32>(InString.size())) {}
+    FString(const WIDECHAR* InString) : FString(FStringView(InString)) {}
+    FString(const std::string& InString) : FString(FAnsiStringView(InString.data(), static_cast<int32>(InString.size()))) {}
+    FString(const ANSICHAR* InString) : FString(FAnsiStringView(InString)) {}
+    /** UTF-8 문자열을 임시 std::wstring 없이 바로 변환 */
+    explicit FString(FAnsiStringView InUtf8);
 #else
-    FString(const std::string& InString) : PrivateString(InString) {}
-    FString(const ANSICHAR* InString) : PrivateString(InString) {}
-    FString(const std::wstring& InString) : FString(WStringToString(InString)) {}
-    FString(const WIDECHAR* InString) : FString(WStringToString(InString)) {}
+    FString(const std::string& InString) : FString(InString.data(), static_cast<int32>(InString.size())) {}
+    FString(const ANSICHAR* InString) : FString(FStringView(InString)) {}
+    FString(const std::wstring& InString) : FString(FWideStringView(InString.data(), static_cast<int32>(InString.size()))) {}
+    FString(const WIDECHAR* InString) : FString(FWideStringView(InString)) {}
+    /** UTF-16 문자열을 임시 std::string 없이 바로 UTF-8로 변환 */
+    explicit FString(FWideStringView InUtf16);
 #endif
 
 	FORCEINLINE std::string ToAnsiString() const
 	{
 #if USE_WIDECHAR
-		return WStringToString(std::wstring(PrivateString));
+		return WStringToString(std::wstring(GetBuffer(), Length));
 #else
-        return std::string(PrivateString);
+        return std::string(GetBuffer(), Length);
 #endif
 	}
 
 	FORCEINLINE std::wstring ToWideString() const
 	{
 #if USE_WIDECHAR
-		return std::wstring(PrivateString);
+		return std::wstring(GetBuffer(), Length);
 #else
-        return StringToWString(std::string(PrivateString));
+        return StringToWString(std::string(GetBuffer(), Length));
 #endif
 	}
 
@@ -122,9 +109,9 @@ public:
 
     static FString SanitizeFloat(float InFloat);
 
-	static float ToFloat(const FString& InString);
+	static float ToFloat(FStringView InString);
     
-    static int ToInt(const FString& InString);
+    static int ToInt(FStringView InString);
 
     /**
      * 문자열 내용을 기반으로 bool 값을 반환합니다.
@@ -152,7 +139,7 @@ public:
      * @param SearchCase 대소문자 구분
      * @return 같은지 여부
      */
-    bool Equals(const FString& Other, ESearchCase::Type SearchCase = ESearchCase::CaseSensitive) const;
+    bool Equals(FStringView Other, ESearchCase::Type SearchCase = ESearchCase::CaseSensitive) const;
 
     /**
      * 문자열이 겹치는지 확인합니다.
@@ -162,7 +149,7 @@ public:
      * @return 문자열 겹침 여부
      */
     bool Contains(
-        const FString& SubStr, ESearchCase::Type SearchCase = ESearchCase::IgnoreCase,
+        FStringView SubStr, ESearchCase::Type SearchCase = ESearchCase::IgnoreCase,
         ESearchDir::Type SearchDir = ESearchDir::FromStart
     ) const;
 
@@ -175,7 +162,7 @@ public:
      * @return 찾은 문자열의 Index를 반환합니다. 찾지 못하면 -1
      */
     int32 Find(
-        const FString& SubStr, ESearchCase::Type SearchCase = ESearchCase::IgnoreCase,
+        FStringView SubStr, ESearchCase::Type SearchCase = ESearchCase::IgnoreCase,
         ESearchDir::Type SearchDir = ESearchDir::FromStart, int32 StartPosition = -1
     ) const;
 
@@ -213,11 +200,16 @@ public:
      * @param SearchCase 대소문자 구분 설정.
      * @return 접두사가 성공적으로 제거되었으면 true, 아니면 false를 반환합니다.
      */
-    bool RemoveFromStart(const FString& InPrefix, ESearchCase::Type SearchCase = ESearchCase::IgnoreCase);
+    bool RemoveFromStart(FStringView InPrefix, ESearchCase::Type SearchCase = ESearchCase::IgnoreCase);
 
     void Reserve(int32 CharacterCount);
+
+    /** 길이를 바꿉니다. 늘어난 부분은 0으로 채움 */
     void Resize(int32 CharacterCount);
 
+    /** 문자열 뒤에 Count개의 문자를 붙입니다. */
+    void Append(const ElementType* Str, int32 Count);
+
     [[nodiscard]] FString ToUpper() const &;
     [[nodiscard]] FString ToUpper() &&;
     void ToUpperInline();
@@ -231,28 +223,30 @@ public:
     FORCEINLINE const ElementType* operator*() const;
 
     FORCEINLINE FString& operator+=(const FString& SubStr);
+    FORCEINLINE FString& operator+=(const ElementType* SubStr);
+    FORCEINLINE FString& operator+=(ElementType Char);
     FORCEINLINE friend FString operator+(const FString& Lhs, const FString& Rhs);
 
     FORCEINLINE bool operator==(const FString& Rhs) const;
     FORCEINLINE bool operator==(const ElementType* Rhs) const;
     FORCEINLINE ElementType& operator[](int32 Index)
     {
-        return PrivateString[Index];
+        return GetBuffer()[Index];
     }
 
     FORCEINLINE const ElementType& operator[](int32 Index) const
     {
-        return PrivateString[Index];
+        return GetBuffer()[Index];
     }
     
     FORCEINLINE bool operator<(const FString& Rhs) const
     {
-        return GetContainerPrivate() < Rhs.GetContainerPrivate();
+        return Compare(Rhs) < 0;
     }
 
     FORCEINLINE bool operator>(const FString& Rhs) const
     {
-        return GetContainerPrivate() > Rhs.GetContainerPrivate();
+        return Compare(Rhs) > 0;
     }
 public:
     // --- Printf 함수 ---
@@ -263,32 +257,49 @@ public:
      * @return 포맷팅된 새로운 FString 객체.
      */
     static FString Printf(const ElementType* Format, ...);
+
+private:
+    FORCEINLINE bool IsInline() const { return Capacity <= NumInlineChars; }
+    FORCEINLINE ElementType* GetBuffer() { return IsInline() ? InlineData : HeapData; }
+    FORCEINLINE const ElementType* GetBuffer() const { return IsInline() ? InlineData : HeapData; }
+
+    /** 대소문자를 구분한 사전순 비교 */
+    int32 Compare(const FString& Rhs) const;
+
+    /** 용량을 NewCapacity 이상으로 늘립니다. 기존 내용은 유지 */
+    void Grow(int32 NewCapacity);
+
+    /** Heap 버퍼를 해제하고 빈 Inline 상태로 되돌립니다. */
+    void ReleaseHeap();
 };
 
 template <typename Number>
 	requires std::is_integral_v<Number>
 FString FString::FromInt(Number Num)
 {
-#if USE_WIDECHAR
-    return FString{std::to_wstring(Num)};
-#else
-    return FString{std::to_string(Num)};
-#endif
+    // 부호와 null 문자까지 들어가는 Stack Buffer에 바로 변환
+    char Buffer[24];
+    const std::to_chars_result Result = std::to_chars(Buffer, Buffer + sizeof(Buffer), Num);
+
+    FString String;
+    String.Resize(static_cast<int32>(Result.ptr - Buffer));
+    std::copy(Buffer, Result.ptr, String.GetBuffer());
+    return String;
 }
 
 FORCEINLINE int32 FString::Len() const
 {
-    return static_cast<int32>(PrivateString.length());
+    return Length;
 }
 
 FORCEINLINE bool FString::IsEmpty() const
 {
-    return PrivateString.empty();
+    return Length == 0;
 }
 
 FORCEINLINE const FString::ElementType* FString::operator*() const
 {
-    return PrivateString.c_str();
+    return GetBuffer();
 }
 
 FString operator+(const FString& Lhs, const FString& Rhs)
@@ -309,18 +320,31 @@ FORCEINLINE bool FString::operator==(const ElementType* Rhs) const
 
 FORCEINLINE FString& FString::operator+=(const FString& SubStr)
 {
-    this->PrivateString += SubStr.PrivateString;
+    Append(SubStr.GetBuffer(), SubStr.Length);
+    return *this;
+}
+
+FORCEINLINE FString& FString::operator+=(const ElementType* SubStr)
+{
+    const FStringView View(SubStr);
+    Append(View.GetData(), View.Len());
+    return *this;
+}
+
+FORCEINLINE FString& FString::operator+=(ElementType Char)
+{
+    Append(&Char, 1);
     return *this;
 }
 
 FORCEINLINE FString::ElementType* GetData(FString& String)
 {
-    return String.PrivateString.data();
+    return String.GetBuffer();
 }
 
 FORCEINLINE const FString::ElementType* GetData(const FString& String)
 {
-    return String.PrivateString.data();
+    return String.GetBuffer();
 }
 
 template<>
@@ -328,6 +352,6 @@ struct std::hash<FString>
 {
     size_t operator()(const FString& Key) const noexcept
     {
-        return hash<FString::BaseStringType>()(Key.PrivateString);
+        return hash<basic_string_view<FString::ElementType>>()({*Key, static_cast<size_t>(Key.Len())});
     }
 };
@@ -0,0 +1,100 @@
+#include <cstdio>
+#include <string>
+
+#include "Container/String.h"
+#include "Misc/Benchmark.h"
+#include "UserInterface/Console.h"
+
+namespace
+{
+    /**
+     * Actor 이름, Property Key, Log 한 줄 같은 Engine 문자열로 FString 생성, 복사, 검색, Printf 시간을 측정합니다.
+     * 같은 작업을 std::string으로도 측정해서 비교합니다.
+     */
+    void RunStringBenchmark(const FBenchmarkContext& Context)
+    {
+        static const char* PropertyKeys[] = {
+            "RelativeLocation", "RelativeRotation", "RelativeScale3D", "StaticMeshPath", "Intensity", "AttenuationRadius",
+        };
+        constexpr int32 NumPropertyKeys = static_cast<int32>(std::size(PropertyKeys));
+
+        const int32 NumStrings = Context.Count;
+
+        TArray<std::string> Labels;
+        Labels.SetNum(NumStrings);
+        for (int32 Index = 0; Index < NumStrings; ++Index)
+        {
+            Labels[Index] = "StaticMeshActor_" + std::to_string(Index);
+        }
+
+        TArray<FString> Strings;
+        Strings.SetNum(NumStrings);
+        TArray<std::string> StdStrings;
+        StdStrings.SetNum(NumStrings);
+
+        auto Measure = [&Context, NumStrings](const char* Label, auto&& Body)
+        {
+            Context.Measure(Label, NumStrings, [&]
+            {
+                for (int32 Index = 0; Index < NumStrings; ++Index)
+                {
+                    Body(Index);
+                }
+            });
+        };
+
+        uint64 Checksum = 0;
+        Measure("Label (FString)", [&](int32 Index) { Strings[Index] = FString(Labels[Index].c_str()); });
+        Measure("Label (std::string)", [&](int32 Index) { StdStrings[Index] = Labels[Index].c_str(); });
+
+        Measure("Copy (FString)", [&](int32 Index)
+        {
+            const FString Copy = Strings[Index];
+            Checksum += Copy.Len();
+        });
+        Measure("Copy (std::string)", [&](int32 Index)
+        {
+            const std::string Copy = StdStrings[Index];
+            Checksum += Copy.size();
+        });
+
+        Measure("Property key", [&](int32 Index)
+        {
+            const FString Key = FString(PropertyKeys[Index % NumPropertyKeys]) + Strings[Index].Mid(15);
+            Checksum += Key.Len();
+        });
+
+        Measure("Find", [&](int32 Index) { Checksum += Strings[Index].Find(TEXT("actor_")); });
+        Measure("Find (view)", [&](int32 Index)
+        {
+            const FStringView View = Strings[Index];
+            Checksum += View.RightChop(5).Find(TEXT("_"), ESearchCase::CaseSensitive);
+        });
+
+        Measure("Printf (log line)", [&](int32 Index)
+        {
+            const FString Line = FString::Printf(
+                TEXT("[%s] Spawned %s at (%.2f, %.2f, %.2f)"), TEXT("LogLevel"), *Strings[Index], Index * 0.5f, 1.0f, 2.0f
+            );
+            Checksum += Line.Len();
+        });
+        Measure("snprintf (std::string)", [&](int32 Index)
+        {
+            char Buffer[256];
+            const int Length = snprintf(
+                Buffer, sizeof(Buffer), "[%s] Spawned %s at (%.2f, %.2f, %.2f)", "LogLevel", StdStrings[Index].c_str(), Index * 0.5f, 1.0f, 2.0f
+            );
+            const std::string Line(Buffer, Length);
+            Checksum += Line.size();
+        });
+
+        Context.Console.AddLog(
+            ELogLevel::Display, "String bench: %d strings, inline up to %d chars (checksum %llu)",
+            NumStrings, FString::NumInlineChars, Checksum
+        );
+    }
+
+    FAutoRegisterBenchmark StringBenchmark(
+        "string bench", "[count]: Measure FString create, copy, find and Printf against std::string", 100000, &RunStringBenchmark
+    );
+}
@@ -0,0 +1,189 @@
+#pragma once
+#include <string>
+
+#include "CString.h"
+#include "CoreMiscDefines.h"
+#include "HAL/PlatformType.h"
+#include "Math/MathUtility.h"
+#include "Math/NumericLimits.h"
+
+/** Determines case sensitivity options for string comparisons. */
+namespace ESearchCase
+{
+enum Type : uint8
+{
+    /** Case sensitive. Upper/lower casing must match for strings to be considered equal. */
+    CaseSensitive,
+
+    /** Ignore case. Upper/lower casing does not matter when making a comparison. */
+    IgnoreCase,
+};
+}
+
+/** Determines search direction for string operations. */
+namespace ESearchDir
+{
+enum Type : uint8
+{
+    /** Search from the start, moving forward through the string. */
+    FromStart,
+
+    /** Search from the end, moving backward through the string. */
+    FromEnd,
+};
+}
+
+
+/**
+ * 문자열을 복사하지 않고 가리키는 View
+ *
+ * null 종료를 보장하지 않으므로, null 종료 문자열이 필요한 C API에는 그대로 넘기면 안 됩니다.
+ * 가리키는 문자열보다 오래 살아있으면 안 됩니다.
+ */
+template <typename CharType>
+class TStringView
+{
+public:
+    using ElementType = CharType;
+
+    constexpr TStringView() = default;
+
+    constexpr TStringView(const ElementType* InData)
+        : DataPtr(InData)
+        , Size(InData ? static_cast<int32>(std::char_traits<ElementType>::length(InData)) : 0)
+    {
+    }
+
+    constexpr TStringView(const ElementType* InData, int32 InSize)
+        : DataPtr(InData)
+        , Size(InSize)
+    {
+    }
+
+    constexpr const ElementType* GetData() const { return DataPtr; }
+    constexpr int32 Len() const { return Size; }
+    constexpr bool IsEmpty() const { return Size == 0; }
+
+    constexpr const ElementType& operator[](int32 Index) const { return DataPtr[Index]; }
+
+    // Iterator를 사용하기 위함
+    constexpr const ElementType* begin() const { return DataPtr; }
+    constexpr const ElementType* end() const { return DataPtr + Size; }
+
+    TStringView Left(int32 Count) const
+    {
+        return {DataPtr, FMath::Clamp(Count, 0, Size)};
+    }
+
+    TStringView Mid(int32 Start, int32 Count = MAX_int32) const
+    {
+        Start = FMath::Clamp(Start, 0, Size);
+        Count = FMath::Clamp(Count, 0, Size - Start);
+        return {DataPtr + Start, Count};
+    }
+
+    TStringView RightChop(int32 Count) const
+    {
+        return Mid(Count);
+    }
+
+    bool Equals(TStringView Other, ESearchCase::Type SearchCase = ESearchCase::CaseSensitive) const
+    {
+        return Size == Other.Size && CompareChars(DataPtr, Other.DataPtr, Size, SearchCase);
+    }
+
+    bool StartsWith(TStringView Prefix, ESearchCase::Type SearchCase = ESearchCase::IgnoreCase) const
+    {
+        return Prefix.Size <= Size && CompareChars(DataPtr, Prefix.DataPtr, Prefix.Size, SearchCase);
+    }
+
+    bool EndsWith(TStringView Suffix, ESearchCase::Type SearchCase = ESearchCase::IgnoreCase) const
+    {
+        return Suffix.Size <= Size && CompareChars(DataPtr + Size - Suffix.Size, Suffix.DataPtr, Suffix.Size, SearchCase);
+    }
+
+    /**
+     * 문자열을 찾아 Index를 반환합니다.
+     * @param StartPosition FromStart면 여기부터 뒤로, FromEnd면 여기부터 앞으로 찾음. INDEX_NONE이면 끝에서부터
+     * @return 찾지 못하면 INDEX_NONE
+     */
+    int32 Find(
+        TStringView SubStr, ESearchCase::Type SearchCase = ESearchCase::IgnoreCase,
+        ESearchDir::Type SearchDir = ESearchDir::FromStart, int32 StartPosition = INDEX_NONE
+    ) const
+    {
+        if (SubStr.IsEmpty() || SubStr.Size > Size)
+        {
+            return INDEX_NONE;
+        }
+
+        const int32 LastStart = Size - SubStr.Size;
+        if (SearchDir == ESearchDir::FromStart)
+        {
+            for (int32 Index = FMath::Clamp(StartPosition, 0, LastStart); Index <= LastStart; ++Index)
+            {
+                if (CompareChars(DataPtr + Index, SubStr.DataPtr, SubStr.Size, SearchCase))
+                {
+                    return Index;
+                }
+            }
+        }
+        else
+        {
+            const int32 FirstStart = StartPosition == INDEX_NONE ? LastStart : FMath::Min(StartPosition, LastStart);
+            for (int32 Index = FirstStart; Index >= 0; --Index)
+            {
+                if (CompareChars(DataPtr + Index, SubStr.DataPtr, SubStr.Size, SearchCase))
+                {
+                    return Index;
+                }
+            }
+        }
+        return INDEX_NONE;
+    }
+
+    bool Contains(TStringView SubStr, ESearchCase::Type SearchCase = ESearchCase::IgnoreCase) const
+    {
+        return Find(SubStr, SearchCase) != INDEX_NONE;
+    }
+
+    int32 FindChar(ElementType Char) const
+    {
+        for (int32 Index = 0; Index < Size; ++Index)
+        {
+            if (DataPtr[Index] == Char)
+            {
+                return Index;
+            }
+        }
+        return INDEX_NONE;
+    }
+
+    bool operator==(TStringView Other) const { return Equals(Other); }
+    bool operator!=(TStringView Other) const { return !Equals(Other); }
+
+private:
+    static bool CompareChars(const ElementType* A, const ElementType* B, int32 Count, ESearchCase::Type SearchCase)
+    {
+        if (SearchCase == ESearchCase::CaseSensitive)
+        {
+            return std::char_traits<ElementType>::compare(A, B, Count) == 0;
+        }
+
+        for (int32 Index = 0; Index < Count; ++Index)
+        {
+            if (TCString<ElementType>::ToLower(A[Index]) != TCString<ElementType>::ToLower(B[Index]))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    const ElementType* DataPtr = nullptr;
+    int32 Size = 0;
+};
+
+using FStringView = TStringView<TCHAR>;
+using FAnsiStringView = TStringView<ANSICHAR>;
+using FWideStringView = TStringView<WIDECHAR>;
@@ -1,6 +1,6 @@
 #pragma once
-#include <functional>
-#include "Core/Container/Map.h"
+#include "Core/Container/Array.h"
+#include "Templates/Function.h"
 #include "UObject/WeakObjectPtr.h"
 #include "UserInterface/Console.h"
 
@@ -69,67 +69,63 @@ class TDelegate;
 template <typename ReturnType, typename... ParamTypes>
 class TDelegate<ReturnType(ParamTypes...)>
 {
-    // TODO: std::function 사용 안하고 직접 TFunction 구현하기
-	using FuncType = std::function<ReturnType(ParamTypes...)>;
+	using FuncType = TFunction<ReturnType(ParamTypes...)>;
 	FuncType Func;
 
+    /** BindUObject, BindWeakLambda로 바인딩했을 때 Func를 호출하기 전에 유효성을 검사할 Object */
+    FWeakObjectPtr BoundObject;
+    bool bHasBoundObject = false;
+
 public:
 	template <typename FunctorType>
 	void BindLambda(FunctorType&& InFunctor)
 	{
-	    Func = [Func = std::forward<FunctorType>(InFunctor)](ParamTypes... Params) mutable
-	    {
-	        return Func(std::forward<ParamTypes>(Params)...);
-	    };
+	    Func = std::forward<FunctorType>(InFunctor);
+	    BoundObject.Reset();
+	    bHasBoundObject = false;
 	}
 
     template <typename UserClass, typename FunctorType>
         requires std::derived_from<UserClass, UObject>
     void BindWeakLambda(UserClass* InUserObject, FunctorType&& InFunctor)
     {
-        Func = [
-            SafeObject = TWeakObjectPtr<UserClass>(InUserObject),
-            Func = std::forward<FunctorType>(InFunctor)
-        ](ParamTypes... Params) mutable
-        {
-            if (SafeObject.IsValid())
-            {
-                return Func(std::forward<ParamTypes>(Params)...);
-            }
-
-            UE_LOG(ELogLevel::Warning, "TDelegate executing on invalid object. Returning default value.");
-            return ReturnType{};
-        };
+        Func = std::forward<FunctorType>(InFunctor);
+        BoundObject = InUserObject;
+        bHasBoundObject = true;
     }
 
     template <typename UserClass, typename MethodType>
         requires std::derived_from<UserClass, UObject> && std::is_member_function_pointer_v<MethodType>
     void BindUObject(UserClass* Obj, MethodType InMethod)
     {
-        Func = [SafeObj = TWeakObjectPtr<UserClass>(Obj), InMethod](ParamTypes... Params) mutable
+        // Object의 유효성은 Execute에서 BoundObject로 검사하므로 Raw Pointer를 캡처해도 됨
+        Func = [Obj, InMethod](ParamTypes... Params)
         {
-            if (SafeObj.IsValid())
-            {
-                return (SafeObj->*InMethod)(std::forward<ParamTypes>(Params)...);
-            }
-
-            UE_LOG(ELogLevel::Warning, "TDelegate executing on invalid object. Returning default value.");
-            return ReturnType{};
+            return (Obj->*InMethod)(std::forward<ParamTypes>(Params)...);
         };
+        BoundObject = Obj;
+        bHasBoundObject = true;
     }
 
     void UnBind()
 	{
 		Func = nullptr;
+		BoundObject.Reset();
+		bHasBoundObject = false;
 	}
 
 	bool IsBound() const
 	{
-	    return static_cast<bool>(Func);
+	    return Func.IsSet();
 	}
 
 	ReturnType Execute(ParamTypes... InArgs) const
 	{
+	    if (bHasBoundObject && !BoundObject.IsValid())
+	    {
+	        UE_LOG(ELogLevel::Warning, "TDelegate executing on invalid object. Returning default value.");
+	        return ReturnType();
+	    }
 		return Func(std::forward<ParamTypes>(InArgs)...);
 	}
 
@@ -147,94 +143,225 @@ public:
 template <typename Signature>
 class TMulticastDelegate;
 
+/**
+ * 여러 개의 Callback을 등록해두고 한번에 호출하는 Delegate
+ *
+ * Callback은 등록한 순서대로 연속된 배열에 저장하고, Handle로 찾아서 제거합니다.
+ * Broadcast 중에 Add나 Remove를 해도 되며, Add한 Callback은 다음 Broadcast부터 호출됩니다.
+ *
+ * @note Broadcast 중에 Delegate 자체를 소멸시키면 안 됩니다.
+ */
 template <typename ReturnType, typename... ParamTypes>
 class TMulticastDelegate<ReturnType(ParamTypes...)>
 {
-    // TODO: std::function 사용 안하고 직접 TFunction 구현하기
-	using FuncType = std::function<ReturnType(ParamTypes...)>;
-    TMap<FDelegateHandle, FuncType> DelegateHandles;
+	using FuncType = TFunction<ReturnType(ParamTypes...)>;
+
+    struct FEntry
+    {
+        /** Remove되면 Invalidate 되고, Broadcast가 끝난 뒤 배열에서 제거됨 */
+        FDelegateHandle Handle;
+
+        /** AddUObject, AddWeakLambda로 등록했을 때 유효성을 검사할 Object, 사라지면 Entry도 제거 */
+        FWeakObjectPtr Object;
+        bool bHasObject;
+
+        FuncType Func;
+    };
+
+    // Broadcast는 const지만, 그 안에서 사라진 Object의 Entry를 제거하고 배열을 정리해야 하므로 mutable
+    mutable TArray<FEntry> Entries;
+
+    /** Broadcast 중에 Add한 Entry, 가장 바깥의 Broadcast가 끝나면 Entries로 옮김 */
+    mutable TArray<FEntry> PendingEntries;
+
+    mutable int32 BroadcastDepth = 0;
+    mutable bool bNeedsCompaction = false;
 
 public:
+    TMulticastDelegate() = default;
+
+    // Broadcast 상태는 복사하지 않음
+    TMulticastDelegate(const TMulticastDelegate& Other)
+    {
+        CopyEntriesFrom(Other);
+    }
+
+    TMulticastDelegate& operator=(const TMulticastDelegate& Other)
+    {
+        if (this != &Other)
+        {
+            assert(BroadcastDepth == 0 && "Broadcast 중인 Delegate에 대입할 수 없습니다.");
+            Entries.Empty();
+            PendingEntries.Empty();
+            CopyEntriesFrom(Other);
+        }
+        return *this;
+    }
+
     template <typename FunctorType>
     FDelegateHandle AddLambda(FunctorType&& InFunctor)
     {
-        FDelegateHandle Handle = FDelegateHandle::CreateHandle();
-        DelegateHandles.Add(
-            Handle,
-            [Func = std::forward<FunctorType>(InFunctor)](ParamTypes... Params) mutable
-            {
-                Func(std::forward<ParamTypes>(Params)...);
-            }
-        );
-        return Handle;
+        return AddEntry(nullptr, FuncType(std::forward<FunctorType>(InFunctor)));
     }
 
     template <typename UserClass, typename FunctorType>
         requires std::derived_from<UserClass, UObject>
     FDelegateHandle AddWeakLambda(UserClass* InUserObject, FunctorType&& InFunctor)
     {
-        FDelegateHandle Handle = FDelegateHandle::CreateHandle();
-        DelegateHandles.Add(
-            Handle,
-            [
-                this, Handle,
-                SafeObject = TWeakObjectPtr<UserClass>(InUserObject),
-                Func = std::forward<FunctorType>(InFunctor)
-            ](ParamTypes... Params) mutable
-            {
-                if (SafeObject.IsValid())
-                {
-                    return Func(std::forward<ParamTypes>(Params)...);
-                }
-
-                Remove(Handle); // 유효한 포인터가 사라지면 델리게이트에서 제거
-                return ReturnType{};
-            }
-        );
-        return Handle;
+        return AddEntry(InUserObject, FuncType(std::forward<FunctorType>(InFunctor)));
     }
 
     template <typename UserClass, typename MethodType>
         requires std::derived_from<UserClass, UObject> && std::is_member_function_pointer_v<MethodType>
     FDelegateHandle AddUObject(UserClass* InUserObject, MethodType InMethod)
     {
-        FDelegateHandle Handle = FDelegateHandle::CreateHandle();
-        DelegateHandles.Add(
-            Handle,
-            [
-                this, Handle,
-                SafeObj = TWeakObjectPtr<UserClass>(InUserObject),
-                InMethod
-            ](ParamTypes... Params)
+        // Object의 유효성은 Broadcast에서 Entry의 Object로 검사하므로 Raw Pointer를 캡처해도 됨
+        return AddEntry(
+            InUserObject,
+            FuncType([InUserObject, InMethod](ParamTypes... Params)
             {
-                if (SafeObj.IsValid())
-                {
-                    return (SafeObj->*InMethod)(std::forward<ParamTypes>(Params)...);
-                }
-    
-                Remove(Handle); // 유효한 포인터가 사라지면 델리게이트에서 제거
-                return ReturnType{};
-            }
+                return (InUserObject->*InMethod)(std::forward<ParamTypes>(Params)...);
+            })
         );
-        return Handle;
     }
 
+    /** @return Handle에 해당하는 Callback을 찾아서 제거했으면 true */
 	bool Remove(FDelegateHandle Handle)
 	{
-	    if (Handle.IsValid())
+	    if (!Handle.IsValid())
+	    {
+	        return false;
+	    }
+
+	    for (FEntry& Entry : Entries)
 	    {
-	        DelegateHandles.Remove(Handle);
+	        if (Entry.Handle == Handle)
+	        {
+	            Entry.Handle.Invalidate();
+	            bNeedsCompaction = true;
+	            if (BroadcastDepth == 0)
+	            {
+	                FinishBroadcast();
+	            }
+	            return true;
+	        }
+	    }
+
+	    const int32 PendingIndex = PendingEntries.IndexOfByPredicate(
+	        [&Handle](const FEntry& Entry) { return Entry.Handle == Handle; }
+	    );
+	    if (PendingIndex != INDEX_NONE)
+	    {
+	        PendingEntries.RemoveAt(PendingIndex);
 	        return true;
 	    }
+
 	    return false;
 	}
 
+    /** 등록된 모든 Callback을 제거합니다. */
+    void Clear()
+    {
+        for (FEntry& Entry : Entries)
+        {
+            Entry.Handle.Invalidate();
+        }
+        bNeedsCompaction = true;
+        PendingEntries.Empty();
+
+        if (BroadcastDepth == 0)
+        {
+            FinishBroadcast();
+        }
+    }
+
+    bool IsBound() const
+    {
+        for (const FEntry& Entry : Entries)
+        {
+            if (Entry.Handle.IsValid())
+            {
+                return true;
+            }
+        }
+        return !PendingEntries.IsEmpty();
+    }
+
 	void Broadcast(ParamTypes... Params) const
 	{
-		auto CopyDelegates = DelegateHandles;
-		for (const auto& [Handle, Delegate] : CopyDelegates)
-		{
-			Delegate(Params...);
-		}
+	    ++BroadcastDepth;
+
+	    // Broadcast 중에는 Entries의 크기가 바뀌지 않으므로 Index로 순회해도 안전함
+	    const int32 NumEntries = Entries.Num();
+	    for (int32 Index = 0; Index < NumEntries; ++Index)
+	    {
+	        FEntry& Entry = Entries[Index];
+	        if (!Entry.Handle.IsValid())
+	        {
+	            continue;
+	        }
+
+	        if (Entry.bHasObject && !Entry.Object.IsValid())
+	        {
+	            // 유효한 포인터가 사라지면 델리게이트에서 제거
+	            Entry.Handle.Invalidate();
+	            bNeedsCompaction = true;
+	            continue;
+	        }
+
+	        Entry.Func(Params...);
+	    }
+
+	    if (--BroadcastDepth == 0)
+	    {
+	        FinishBroadcast();
+	    }
 	}
+
+private:
+    FDelegateHandle AddEntry(const UObject* InObject, FuncType&& InFunc)
+    {
+        FDelegateHandle Handle = FDelegateHandle::CreateHandle();
+        TArray<FEntry>& Target = BroadcastDepth > 0 ? PendingEntries : Entries;
+        Target.Emplace(FEntry{Handle, FWeakObjectPtr(InObject), InObject != nullptr, std::move(InFunc)});
+        return Handle;
+    }
+
+    /**
+     * 제거 표시된 Entry를 지우고, Broadcast 중에 Add한 Entry를 뒤에 붙입니다.
+     * 순회 중인 Entry의 Func가 소멸되지 않도록 Broadcast 중에는 호출하지 않습니다.
+     */
+    void FinishBroadcast() const
+    {
+        if (bNeedsCompaction)
+        {
+            Entries.RemoveAll([](const FEntry& Entry) { return !Entry.Handle.IsValid(); });
+            bNeedsCompaction = false;
+        }
+
+        if (!PendingEntries.IsEmpty())
+        {
+            for (FEntry& Entry : PendingEntries)
+            {
+                Entries.Emplace(std::move(Entry));
+            }
+            PendingEntries.Empty();
+        }
+    }
+
+    void CopyEntriesFrom(const TMulticastDelegate& Other)
+    {
+        Entries.Reserve(Other.Entries.Num() + Other.PendingEntries.Num());
+        for (const FEntry& Entry : Other.Entries)
+        {
+            if (Entry.Handle.IsValid())
+            {
+                Entries.Add(Entry);
+            }
+        }
+        for (const FEntry& Entry : Other.PendingEntries)
+        {
+            Entries.Add(Entry);
+        }
+    }
 };
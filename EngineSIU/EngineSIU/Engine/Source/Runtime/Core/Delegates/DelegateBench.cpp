@@ -0,0 +1,80 @@
+#include <functional>
+
+#include "Delegate.h"
+#include "Container/Map.h"
+#include "Math/MathUtility.h"
+#include "Misc/Benchmark.h"
+#include "UserInterface/Console.h"
+
+namespace
+{
+    /**
+     * Listener 수를 1, 10, 100, 1000으로 늘려가며 TMulticastDelegate의 Broadcast 시간을 측정합니다.
+     * std::function 배열과, 이전 구현처럼 TMap을 복사한 뒤 호출하는 방식도 같이 측정해서 비교합니다.
+     * Listener 호출 횟수의 합이 Count가 되도록 Broadcast 횟수를 정합니다.
+     */
+    void RunDelegateBenchmark(const FBenchmarkContext& Context)
+    {
+        using FStdFunction = std::function<void(int32, int32)>;
+
+        const int32 NumCalls = Context.Count;
+
+        uint64 Checksum = 0;
+        for (const int32 NumListeners : {1, 10, 100, 1000})
+        {
+            TMulticastDelegate<void(int32, int32)> Delegate;
+            TArray<FStdFunction> StdFunctions;
+            TMap<FDelegateHandle, FStdFunction> StdFunctionMap;
+            for (int32 Index = 0; Index < NumListeners; ++Index)
+            {
+                // Component에 바인딩하는 Lambda처럼 포인터 하나와 값 하나를 캡처
+                auto Listener = [&Checksum, Index](int32 Current, int32 Max) { Checksum += Current * Index + Max; };
+                Delegate.AddLambda(Listener);
+                StdFunctions.Add(Listener);
+                StdFunctionMap.Add(FDelegateHandle::CreateHandle(), Listener);
+            }
+
+            const int32 NumBroadcasts = FMath::Max(NumCalls / NumListeners, 1);
+            auto Measure = [&Context, NumListeners, NumBroadcasts](const char* Label, auto&& Body)
+            {
+                const double ElapsedMs = MeasureMilliseconds([&]
+                {
+                    for (int32 Index = 0; Index < NumBroadcasts; ++Index)
+                    {
+                        Body(Index);
+                    }
+                });
+                Context.Console.AddLog(
+                    ELogLevel::Display, "%4d %-22s %8.2f ms (%.1f ns/broadcast, %.2f ns/listener)",
+                    NumListeners, Label, ElapsedMs, ElapsedMs * 1e6 / NumBroadcasts, ElapsedMs * 1e6 / NumBroadcasts / NumListeners
+                );
+            };
+
+            Measure("TMulticastDelegate", [&](int32 Index) { Delegate.Broadcast(Index, 100); });
+            Measure("TArray<std::function>", [&](int32 Index)
+            {
+                for (const FStdFunction& Function : StdFunctions)
+                {
+                    Function(Index, 100);
+                }
+            });
+            Measure("TMap copy (old)", [&](int32 Index)
+            {
+                const TMap<FDelegateHandle, FStdFunction> Copy = StdFunctionMap;
+                for (const auto& [Handle, Function] : Copy)
+                {
+                    Function(Index, 100);
+                }
+            });
+        }
+
+        Context.Console.AddLog(
+            ELogLevel::Display, "Delegate bench: %d calls, TFunction inline up to %llu Byte (checksum %llu)",
+            NumCalls, static_cast<uint64>(FunctionPrivate::InlineSize), Checksum
+        );
+    }
+
+    FAutoRegisterBenchmark DelegateBenchmark(
+        "delegate bench", "[count]: Measure multicast delegate broadcast with 1 to 1000 listeners", 1000000, &RunDelegateBenchmark
+    );
+}
@@ -23,6 +23,10 @@ private:
     static std::atomic<uint64> ContainerAllocationBytes;
     static std::atomic<uint64> ContainerAllocationCount;
 
+    // 해제되어도 줄어들지 않는 누적 할당 횟수
+    static std::atomic<uint64> ObjectTotalAllocationCount;
+    static std::atomic<uint64> ContainerTotalAllocationCount;
+
     template <EAllocationType AllocType>
     static void IncrementStats(size_t Size);
 
@@ -55,6 +59,10 @@ public:
 
     template <EAllocationType AllocType>
     static uint64 GetAllocationCount();
+
+    /** 시작 이후의 누적 할당 횟수, 두 시점의 차이로 구간 안에서 일어난 할당 횟수를 셀 수 있습니다. */
+    template <EAllocationType AllocType>
+    static uint64 GetTotalAllocationCount();
 };
 
 
@@ -68,11 +76,13 @@ void FPlatformMemory::IncrementStats(size_t Size)
     {
         ContainerAllocationBytes.fetch_add(Size, std::memory_order_relaxed);
         ContainerAllocationCount.fetch_add(1, std::memory_order_relaxed);
+        ContainerTotalAllocationCount.fetch_add(1, std::memory_order_relaxed);
     }
     else if constexpr (AllocType == EAT_Object)
     {
         ObjectAllocationBytes.fetch_add(Size, std::memory_order_relaxed);
         ObjectAllocationCount.fetch_add(1, std::memory_order_relaxed);
+        ObjectTotalAllocationCount.fetch_add(1, std::memory_order_relaxed);
     }
     else
     {
@@ -187,3 +197,20 @@ uint64 FPlatformMemory::GetAllocationCount()
     }
 }
 
+template <EAllocationType AllocType>
+uint64 FPlatformMemory::GetTotalAllocationCount()
+{
+    if constexpr (AllocType == EAT_Container)
+    {
+        return ContainerTotalAllocationCount;
+    }
+    else if constexpr (AllocType == EAT_Object)
+    {
+        return ObjectTotalAllocationCount;
+    }
+    else
+    {
+        //static_assert(false, "Unknown AllocationType");
+        return -1;
+    }
+}
@@ -0,0 +1,455 @@
+#include "Log.h"
+
+#include <condition_variable>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "Container/Array.h"
+#include "Math/MathUtility.h"
+#include "WindowsPlatformTime.h"
+
+DEFINE_LOG_CATEGORY(LogTemp, ELogLevel::Display)
+
+// UObject의 생성/삭제 로그, 할당마다 남으므로 기본으로는 끔
+DEFINE_LOG_CATEGORY(LogObject, ELogLevel::Warning)
+
+namespace
+{
+    // 정적 초기화 중에 생성되는 Category가 등록되므로 상수 초기화되는 포인터여야 함
+    constinit FLogCategory* GFirstCategory = nullptr;
+
+    struct alignas(64) FLogSlot
+    {
+        std::atomic<uint64> Sequence;
+        FLogRecord Record;
+    };
+    static_assert(sizeof(FLogSlot) == 256);
+
+    /**
+     * 여러 Producer, Consumer 하나인 고정 크기 Ring Buffer
+     * Slot의 Sequence가 Position과 같으면 비어 있고, Position + 1이면 쓰기가 끝난 상태입니다.
+     */
+    struct FLogRing
+    {
+        static constexpr uint64 Capacity = 1 << 12;
+
+        FLogSlot Slots[Capacity];
+
+        alignas(64) std::atomic<uint64> EnqueuePosition = 0;
+        alignas(64) std::atomic<uint64> DequeuePosition = 0;
+        std::atomic<uint64> NumDropped = 0;
+
+        FLogRing()
+        {
+            for (uint64 Index = 0; Index < Capacity; ++Index)
+            {
+                Slots[Index].Sequence.store(Index, std::memory_order_relaxed);
+            }
+        }
+    };
+
+    FLogRing& GetRing()
+    {
+        // 정적 초기화 중의 UE_LOG도 받을 수 있도록 처음 사용할 때 생성
+        static FLogRing* Ring = new FLogRing;
+        return *Ring;
+    }
+
+    struct FLogSinkThread
+    {
+        std::thread Thread;
+        std::atomic<bool> bRunning = false;
+        std::atomic<bool> bStopRequested = false;
+
+        // Sink Thread가 할 일이 없어 잠들었는지, Producer는 이때만 깨움
+        std::atomic<bool> bSleeping = false;
+        std::mutex WakeMutex;
+        std::condition_variable WakeCondition;
+
+        // Sink Thread에서만 사용, AddSink는 SinkMutex를 잡고 추가
+        std::mutex SinkMutex;
+        TArray<FLogSink> Sinks;
+        FILE* LogFile = nullptr;
+        uint64 StartCycles = 0;
+        uint64 NumReportedDropped = 0;
+        std::string LineBuffer;
+        std::string MessageBuffer;
+    };
+
+    FLogSinkThread GSinkThread;
+
+    const char* GetLevelName(ELogLevel Level)
+    {
+        switch (Level)
+        {
+        case ELogLevel::Display:
+            return "Display";
+        case ELogLevel::Warning:
+            return "Warning";
+        case ELogLevel::Error:
+            return "Error";
+        }
+        return "";
+    }
+
+    void WakeSinkThread()
+    {
+        std::lock_guard Lock(GSinkThread.WakeMutex);
+        GSinkThread.bSleeping.store(false, std::memory_order_relaxed);
+        GSinkThread.WakeCondition.notify_one();
+    }
+
+    void WriteMessage(const FLogMessage& Message)
+    {
+        std::string& Line = GSinkThread.LineBuffer;
+        Line.clear();
+
+        char Prefix[96];
+        const int32 PrefixLen = snprintf(
+            Prefix, sizeof(Prefix), "[%9.3f][%s][%s] ",
+            Message.TimeSeconds, Message.Category->GetName(), GetLevelName(Message.Level)
+        );
+        Line.append(Prefix, PrefixLen);
+        Line.append(Message.Text, Message.Len);
+        Line.push_back('\n');
+
+        fwrite(Line.data(), 1, Line.size(), stdout);
+        if (GSinkThread.LogFile)
+        {
+            fwrite(Line.data(), 1, Line.size(), GSinkThread.LogFile);
+        }
+
+        std::lock_guard Lock(GSinkThread.SinkMutex);
+        for (const FLogSink& Sink : GSinkThread.Sinks)
+        {
+            Sink(Message);
+        }
+    }
+
+    void ProcessRecord(const FLogRecord& Record)
+    {
+        FLogMessage Message;
+        Message.Category = Record.Category;
+        Message.Level = Record.Level;
+        Message.ThreadId = Record.ThreadId;
+        // Initialize 전에 남긴 로그는 0초로 표시
+        const uint64 Cycles = FMath::Max(Record.Cycles, GSinkThread.StartCycles);
+        Message.TimeSeconds = FPlatformTime::ToMilliseconds(Cycles - GSinkThread.StartCycles) / 1000.0;
+
+        if (Record.FormatFunc)
+        {
+            std::string& Buffer = GSinkThread.MessageBuffer;
+            if (Buffer.size() < 1024)
+            {
+                Buffer.resize(1024);
+            }
+
+            int32 Len = Record.FormatFunc(Record.Format, Record.Payload, Buffer.data(), Buffer.size());
+            if (Len >= static_cast<int32>(Buffer.size()))
+            {
+                Buffer.resize(static_cast<size_t>(Len) + 1);
+                Len = Record.FormatFunc(Record.Format, Record.Payload, Buffer.data(), Buffer.size());
+            }
+
+            Message.Text = Buffer.data();
+            Message.Len = FMath::Max(Len, 0);
+        }
+        else if (Record.LongMessage)
+        {
+            Message.Text = Record.LongMessage;
+            Message.Len = static_cast<int32>(strlen(Record.LongMessage));
+        }
+        else
+        {
+            Message.Text = reinterpret_cast<const char*>(Record.Payload);
+            Message.Len = static_cast<int32>(strlen(Message.Text));
+        }
+
+        WriteMessage(Message);
+
+        free(Record.LongMessage);
+    }
+
+    /** Ring에 쌓인 로그를 모두 출력합니다. 하나라도 출력했으면 true */
+    bool DrainRing()
+    {
+        FLogRing& Ring = GetRing();
+
+        bool bProcessed = false;
+        uint64 Position = Ring.DequeuePosition.load(std::memory_order_relaxed);
+        while (true)
+        {
+            FLogSlot& Slot = Ring.Slots[Position % FLogRing::Capacity];
+            if (Slot.Sequence.load(std::memory_order_acquire) != Position + 1)
+            {
+                break;
+            }
+
+            ProcessRecord(Slot.Record);
+
+            Slot.Sequence.store(Position + FLogRing::Capacity, std::memory_order_release);
+            Ring.DequeuePosition.store(++Position, std::memory_order_release);
+            bProcessed = true;
+        }
+
+        const uint64 NumDropped = Ring.NumDropped.load(std::memory_order_relaxed);
+        if (NumDropped != GSinkThread.NumReportedDropped)
+        {
+            char Text[96];
+            FLogMessage Message;
+            Message.Category = &LogTemp;
+            Message.Level = ELogLevel::Warning;
+            Message.ThreadId = GetCurrentThreadId();
+            Message.TimeSeconds = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - GSinkThread.StartCycles) / 1000.0;
+            Message.Text = Text;
+            Message.Len = snprintf(Text, sizeof(Text), "Log ring was full, dropped %llu messages", NumDropped - GSinkThread.NumReportedDropped);
+            WriteMessage(Message);
+
+            GSinkThread.NumReportedDropped = NumDropped;
+        }
+
+        if (bProcessed && GSinkThread.LogFile)
+        {
+            fflush(GSinkThread.LogFile);
+        }
+        return bProcessed;
+    }
+
+    void SinkThreadMain()
+    {
+        while (true)
+        {
+            if (DrainRing())
+            {
+                continue;
+            }
+
+            if (GSinkThread.bStopRequested.load(std::memory_order_acquire))
+            {
+                // 종료 요청 전에 Commit된 로그까지 모두 출력했음
+                DrainRing();
+                break;
+            }
+
+            std::unique_lock Lock(GSinkThread.WakeMutex);
+            GSinkThread.bSleeping.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            // 잠들기 직전에 Commit된 로그를 놓치지 않도록 다시 확인
+            const FLogRing& Ring = GetRing();
+            const uint64 Position = Ring.DequeuePosition.load(std::memory_order_relaxed);
+            if (Ring.Slots[Position % FLogRing::Capacity].Sequence.load(std::memory_order_acquire) == Position + 1)
+            {
+                GSinkThread.bSleeping.store(false, std::memory_order_relaxed);
+                continue;
+            }
+
+            // 놓친 깨우기가 있어도 오래 멈추지 않도록 시간 제한을 둠
+            GSinkThread.WakeCondition.wait_for(Lock, std::chrono::milliseconds(100), []
+            {
+                return !GSinkThread.bSleeping.load(std::memory_order_relaxed) || GSinkThread.bStopRequested.load(std::memory_order_relaxed);
+            });
+            GSinkThread.bSleeping.store(false, std::memory_order_relaxed);
+        }
+    }
+}
+
+FLogCategory::FLogCategory(const char* InName, ELogLevel InDefaultLevel)
+    : Name(InName)
+    , MinLevel(InDefaultLevel)
+    , Next(GFirstCategory)
+{
+    GFirstCategory = this;
+}
+
+FLogCategory* FLogCategory::GetFirst()
+{
+    return GFirstCategory;
+}
+
+FLogCategory* FLogCategory::Find(const char* InName)
+{
+    for (FLogCategory* Category = GFirstCategory; Category; Category = Category->Next)
+    {
+        if (_stricmp(Category->Name, InName) == 0)
+        {
+            return Category;
+        }
+    }
+    return nullptr;
+}
+
+void FLog::Initialize(const char* LogFilePath)
+{
+    if (GSinkThread.bRunning.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    GSinkThread.StartCycles = FPlatformTime::Cycles64();
+
+    if (LogFilePath)
+    {
+        std::error_code ErrorCode;
+        std::filesystem::create_directories(std::filesystem::path(LogFilePath).parent_path(), ErrorCode);
+        fopen_s(&GSinkThread.LogFile, LogFilePath, "w");
+    }
+
+    GSinkThread.bStopRequested.store(false, std::memory_order_relaxed);
+    GSinkThread.bRunning.store(true, std::memory_order_release);
+    GSinkThread.Thread = std::thread(&SinkThreadMain);
+}
+
+void FLog::Shutdown()
+{
+    if (!GSinkThread.bRunning.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    {
+        std::lock_guard Lock(GSinkThread.WakeMutex);
+        GSinkThread.bStopRequested.store(true, std::memory_order_release);
+        GSinkThread.WakeCondition.notify_one();
+    }
+    GSinkThread.Thread.join();
+    GSinkThread.bRunning.store(false, std::memory_order_relaxed);
+
+    if (GSinkThread.LogFile)
+    {
+        fclose(GSinkThread.LogFile);
+        GSinkThread.LogFile = nullptr;
+    }
+
+    std::lock_guard Lock(GSinkThread.SinkMutex);
+    GSinkThread.Sinks.Empty();
+}
+
+void FLog::Flush()
+{
+    if (!GSinkThread.bRunning.load(std::memory_order_acquire))
+    {
+        return;
+    }
+
+    const FLogRing& Ring = GetRing();
+    const uint64 Target = Ring.EnqueuePosition.load(std::memory_order_acquire);
+    while (Ring.DequeuePosition.load(std::memory_order_acquire) < Target)
+    {
+        WakeSinkThread();
+        std::this_thread::yield();
+    }
+}
+
+void FLog::AddSink(FLogSink Sink)
+{
+    std::lock_guard Lock(GSinkThread.SinkMutex);
+    GSinkThread.Sinks.Add(std::move(Sink));
+}
+
+uint64 FLog::GetNumDropped()
+{
+    return GetRing().NumDropped.load(std::memory_order_relaxed);
+}
+
+void FLog::LogString(const FLogCategory& Category, ELogLevel Level, const char* Message, int32 Len)
+{
+    FLogRecord* Record = BeginRecord(Category, Level);
+    if (!Record)
+    {
+        return;
+    }
+
+    char* Text = reinterpret_cast<char*>(Record->Payload);
+    if (Len >= FLogRecord::PayloadSize)
+    {
+        Text = Record->LongMessage = static_cast<char*>(malloc(static_cast<size_t>(Len) + 1));
+    }
+    memcpy(Text, Message, Len);
+    Text[Len] = '\0';
+
+    CommitRecord(Record);
+}
+
+void FLog::LogV(const FLogCategory& Category, ELogLevel Level, const char* Format, va_list Args)
+{
+    FLogRecord* Record = BeginRecord(Category, Level);
+    if (!Record)
+    {
+        return;
+    }
+
+    va_list ArgsCopy;
+    va_copy(ArgsCopy, Args);
+
+    const int32 Len = vsnprintf(reinterpret_cast<char*>(Record->Payload), FLogRecord::PayloadSize, Format, Args);
+    if (Len >= FLogRecord::PayloadSize)
+    {
+        Record->LongMessage = static_cast<char*>(malloc(static_cast<size_t>(Len) + 1));
+        vsnprintf(Record->LongMessage, static_cast<size_t>(Len) + 1, Format, ArgsCopy);
+    }
+    va_end(ArgsCopy);
+
+    CommitRecord(Record);
+}
+
+FLogRecord* FLog::BeginRecord(const FLogCategory& Category, ELogLevel Level)
+{
+    FLogRing& Ring = GetRing();
+
+    uint64 Position = Ring.EnqueuePosition.load(std::memory_order_relaxed);
+    while (true)
+    {
+        FLogSlot& Slot = Ring.Slots[Position % FLogRing::Capacity];
+        const int64 Diff = static_cast<int64>(Slot.Sequence.load(std::memory_order_acquire)) - static_cast<int64>(Position);
+        if (Diff == 0)
+        {
+            if (Ring.EnqueuePosition.compare_exchange_weak(Position, Position + 1, std::memory_order_relaxed))
+            {
+                FLogRecord& Record = Slot.Record;
+                Record.Category = &Category;
+                Record.Format = nullptr;
+                Record.FormatFunc = nullptr;
+                Record.LongMessage = nullptr;
+                Record.Cycles = FPlatformTime::Cycles64();
+                Record.ThreadId = GetCurrentThreadId();
+                Record.Level = Level;
+                return &Record;
+            }
+        }
+        else if (Diff < 0)
+        {
+            // Ring이 가득 참, Error는 Sink Thread가 비워줄 때까지 기다림
+            if (Level != ELogLevel::Error || !GSinkThread.bRunning.load(std::memory_order_relaxed))
+            {
+                Ring.NumDropped.fetch_add(1, std::memory_order_relaxed);
+                return nullptr;
+            }
+            WakeSinkThread();
+            std::this_thread::yield();
+            Position = Ring.EnqueuePosition.load(std::memory_order_relaxed);
+        }
+        else
+        {
+            Position = Ring.EnqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+void FLog::CommitRecord(FLogRecord* Record)
+{
+    FLogSlot* Slot = reinterpret_cast<FLogSlot*>(reinterpret_cast<uint8*>(Record) - offsetof(FLogSlot, Record));
+
+    // Slot의 위치는 Sequence가 Position일 때 예약했으므로 Position + 1로 쓰기 완료를 알림
+    const uint64 Position = Slot->Sequence.load(std::memory_order_relaxed);
+    Slot->Sequence.store(Position + 1, std::memory_order_release);
+
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (GSinkThread.bSleeping.load(std::memory_order_relaxed))
+    {
+        WakeSinkThread();
+    }
+}
@@ -0,0 +1,332 @@
+#pragma once
+#include <atomic>
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <cwchar>
+#include <functional>
+#include <tuple>
+#include <type_traits>
+
+#include "HAL/PlatformType.h"
+
+
+enum class ELogLevel : uint8
+{
+    Display,
+    Warning,
+    Error
+};
+
+/**
+ * 이 Level보다 낮은 UE_LOG는 인자 평가와 FLog::Log 호출까지 통째로 컴파일에서 빠집니다.
+ * 0: Display, 1: Warning, 2: Error
+ */
+#ifndef UE_LOG_COMPILE_MIN_LEVEL
+    #define UE_LOG_COMPILE_MIN_LEVEL 0
+#endif
+
+#if UE_LOG_COMPILE_MIN_LEVEL > 0
+    // 걸러진 Level은 if constexpr의 버려진 문장이 되어 코드가 생성되지 않음, 이때 UE_LOG의 Level은 상수식이어야 함
+    #define UE_LOG_PRIVATE_IF_COMPILED_IN(Level) if constexpr (static_cast<uint8>(Level) >= UE_LOG_COMPILE_MIN_LEVEL)
+#else
+    // 모든 Level을 남기므로 검사 자체를 넣지 않음
+    #define UE_LOG_PRIVATE_IF_COMPILED_IN(Level)
+#endif
+
+static consteval const char* GetFileName(const char* Path)
+{
+    const char* Name = Path;
+    while (*Path)
+    {
+        if (*Path == '/' || *Path == '\\')
+        {
+            Name = Path + 1;
+        }
+        Path++;
+    }
+    return Name;
+}
+
+#define FILENAME GetFileName(__FILE__)
+
+/** Category를 지정해서 로그를 남깁니다. Category의 Runtime Level보다 낮으면 인자를 평가하지 않습니다. */
+#define UE_LOG_CATEGORY(Category, Level, Fmt, ...) \
+    do \
+    { \
+        UE_LOG_PRIVATE_IF_COMPILED_IN(Level) \
+        { \
+            if ((Category).IsEnabled(Level)) \
+            { \
+                FLog::Log(Category, Level, "[%s:%d] " Fmt, FILENAME, __LINE__, ##__VA_ARGS__); \
+            } \
+        } \
+    } while (0)
+
+#define UE_LOG(Level, Fmt, ...) UE_LOG_CATEGORY(LogTemp, Level, Fmt, ##__VA_ARGS__)
+
+#define DECLARE_LOG_CATEGORY_EXTERN(CategoryName) extern FLogCategory CategoryName;
+#define DEFINE_LOG_CATEGORY(CategoryName, DefaultLevel) FLogCategory CategoryName(#CategoryName, DefaultLevel);
+
+
+/**
+ * 로그의 분류
+ * 전역 변수로만 만들어야 하며, 생성될 때 전역 목록에 등록되어 콘솔의 'log' 명령으로 Level을 바꿀 수 있습니다.
+ */
+class FLogCategory
+{
+public:
+    FLogCategory(const char* InName, ELogLevel InDefaultLevel);
+
+    FLogCategory(const FLogCategory&) = delete;
+    FLogCategory& operator=(const FLogCategory&) = delete;
+
+    const char* GetName() const { return Name; }
+
+    FORCEINLINE bool IsEnabled(ELogLevel Level) const
+    {
+        return Level >= MinLevel.load(std::memory_order_relaxed);
+    }
+
+    ELogLevel GetMinLevel() const { return MinLevel.load(std::memory_order_relaxed); }
+    void SetMinLevel(ELogLevel Level) { MinLevel.store(Level, std::memory_order_relaxed); }
+
+    const FLogCategory* GetNext() const { return Next; }
+
+    static FLogCategory* GetFirst();
+
+    /** 대소문자를 구분하지 않고 이름으로 찾습니다. 없으면 nullptr */
+    static FLogCategory* Find(const char* InName);
+
+private:
+    const char* Name;
+    std::atomic<ELogLevel> MinLevel;
+    FLogCategory* Next = nullptr;
+};
+
+DECLARE_LOG_CATEGORY_EXTERN(LogTemp)
+DECLARE_LOG_CATEGORY_EXTERN(LogObject)
+
+
+/** Sink Thread가 Sink에 넘기는 포맷이 끝난 로그 한 줄 */
+struct FLogMessage
+{
+    const FLogCategory* Category;
+    ELogLevel Level;
+    uint32 ThreadId;
+
+    /** FLog::Initialize 이후 경과 시간 */
+    double TimeSeconds;
+
+    /** null 종료 문자열, Sink 호출이 끝나면 무효 */
+    const char* Text;
+    int32 Len;
+};
+
+using FLogSink = std::function<void(const FLogMessage&)>;
+
+/** Ring Buffer의 Slot 하나에 들어가는 로그, 인자는 포맷하지 않은 채로 Payload에 복사해 둡니다. */
+struct FLogRecord
+{
+    // Sequence까지 합쳐서 Slot 하나가 256 Byte가 되도록 맞춤
+    static constexpr int32 PayloadSize = 200;
+
+    /** Payload에 복사한 인자를 꺼내서 Format으로 포맷합니다. snprintf와 같은 값을 반환 */
+    using FFormatFunc = int32(*)(const char* Format, const uint8* Payload, char* Out, size_t OutSize);
+
+    const FLogCategory* Category;
+    const char* Format;
+
+    /** nullptr이면 이미 포맷된 문자열이 LongMessage 또는 Payload에 있음 */
+    FFormatFunc FormatFunc;
+
+    /** Payload에 들어가지 않는 포맷된 문자열, Sink Thread가 해제 */
+    char* LongMessage;
+
+    uint64 Cycles;
+    uint32 ThreadId;
+    ELogLevel Level;
+
+    alignas(8) uint8 Payload[PayloadSize];
+};
+
+namespace LogPrivate
+{
+    template <typename T>
+    constexpr bool IsNarrowString = std::is_same_v<std::decay_t<T>, char*> || std::is_same_v<std::decay_t<T>, const char*>;
+
+    template <typename T>
+    constexpr bool IsWideString = std::is_same_v<std::decay_t<T>, wchar_t*> || std::is_same_v<std::decay_t<T>, const wchar_t*>;
+
+    /** Payload에 저장되는 타입, 문자열은 포인터가 아니라 내용을 복사하고 꺼낼 때 Payload 안을 가리킴 */
+    template <typename T>
+    using TStoredType = std::conditional_t<
+        IsNarrowString<T>, const char*,
+        std::conditional_t<IsWideString<T>, const wchar_t*, std::decay_t<T>>
+    >;
+
+    template <typename CharType, typename PointerType>
+    FORCEINLINE void AlignCursor(PointerType& Cursor)
+    {
+        const uintptr_t Misalignment = reinterpret_cast<uintptr_t>(Cursor) % alignof(CharType);
+        Cursor += Misalignment ? alignof(CharType) - Misalignment : 0;
+    }
+
+    template <typename CharType>
+    FORCEINLINE bool EncodeString(uint8*& Cursor, const uint8* End, const CharType* Str)
+    {
+        if (!Str)
+        {
+            // printf의 %s는 nullptr을 받을 수 없음
+            static constexpr CharType Null[] = {'(', 'n', 'u', 'l', 'l', ')', 0};
+            Str = Null;
+        }
+
+        const size_t Len = std::char_traits<CharType>::length(Str) + 1;
+        AlignCursor<CharType>(Cursor);
+        if (Cursor + Len * sizeof(CharType) > End)
+        {
+            return false;
+        }
+        memcpy(Cursor, Str, Len * sizeof(CharType));
+        Cursor += Len * sizeof(CharType);
+        return true;
+    }
+
+    template <typename T>
+    FORCEINLINE bool EncodeArg(uint8*& Cursor, const uint8* End, const T& Arg)
+    {
+        if constexpr (IsNarrowString<T> || IsWideString<T>)
+        {
+            return EncodeString(Cursor, End, static_cast<TStoredType<T>>(Arg));
+        }
+        else
+        {
+            using StoredType = TStoredType<T>;
+            static_assert(std::is_trivially_copyable_v<StoredType>, "UE_LOG의 인자는 printf에 넘길 수 있는 값이어야 합니다.");
+
+            if (Cursor + sizeof(StoredType) > End)
+            {
+                return false;
+            }
+            const StoredType Value = Arg;
+            memcpy(Cursor, &Value, sizeof(StoredType));
+            Cursor += sizeof(StoredType);
+            return true;
+        }
+    }
+
+    template <typename T>
+    FORCEINLINE TStoredType<T> DecodeArg(const uint8*& Cursor)
+    {
+        using StoredType = TStoredType<T>;
+        if constexpr (IsNarrowString<T> || IsWideString<T>)
+        {
+            using CharType = std::remove_const_t<std::remove_pointer_t<StoredType>>;
+            AlignCursor<CharType>(Cursor);
+            const StoredType Str = reinterpret_cast<StoredType>(Cursor);
+            Cursor += (std::char_traits<CharType>::length(Str) + 1) * sizeof(CharType);
+            return Str;
+        }
+        else
+        {
+            StoredType Value;
+            memcpy(&Value, Cursor, sizeof(StoredType));
+            Cursor += sizeof(StoredType);
+            return Value;
+        }
+    }
+
+    template <typename... ArgTypes>
+    int32 FormatPayload(const char* Format, const uint8* Payload, char* Out, size_t OutSize)
+    {
+        const uint8* Cursor = Payload;
+
+        // 중괄호 초기화는 왼쪽부터 순서대로 평가되므로 Encode한 순서대로 꺼내짐
+        const std::tuple<TStoredType<ArgTypes>...> Args{DecodeArg<ArgTypes>(Cursor)...};
+        return std::apply(
+            [Format, Out, OutSize](const auto&... Values) { return snprintf(Out, OutSize, Format, Values...); },
+            Args
+        );
+    }
+}
+
+
+/**
+ * 비동기 로그 Backend
+ *
+ * UE_LOG는 포맷하지 않고 Format 포인터와 인자만 여러 Thread가 공유하는 Lock-free Ring Buffer에 복사합니다.
+ * 포맷과 파일, stdout, 콘솔 출력은 Sink Thread 하나가 순서대로 처리합니다.
+ * Ring이 가득 차면 Display/Warning은 버리고 개수만 세며, Error는 자리가 날 때까지 기다립니다.
+ *
+ * @note Format은 문자열 리터럴처럼 로그가 출력될 때까지 살아있어야 합니다.
+ *       문자열 인자(%s, %ls)는 내용을 복사하므로 임시 문자열을 넘겨도 됩니다.
+ */
+class FLog
+{
+public:
+    /**
+     * Sink Thread를 시작합니다. 그 전에 남긴 로그는 Ring에 쌓여 있다가 시작하면 출력됩니다.
+     * @param LogFilePath 로그 파일 경로, nullptr이면 파일에 쓰지 않음
+     */
+    static void Initialize(const char* LogFilePath = "Saved/Logs/Engine.log");
+
+    /** 남은 로그를 모두 출력하고 Sink Thread를 종료합니다. */
+    static void Shutdown();
+
+    /** 지금까지 남긴 로그가 모두 Sink에 전달될 때까지 기다립니다. */
+    static void Flush();
+
+    /** Sink Thread에서 호출될 Sink를 추가합니다. */
+    static void AddSink(FLogSink Sink);
+
+    /** Ring이 가득 차서 버린 로그의 수 */
+    static uint64 GetNumDropped();
+
+    template <typename... ArgTypes>
+    static void Log(const FLogCategory& Category, ELogLevel Level, const char* Format, const ArgTypes&... Args);
+
+    /** 이미 포맷된 문자열을 남깁니다. */
+    static void LogString(const FLogCategory& Category, ELogLevel Level, const char* Message, int32 Len);
+
+    /** 지금 포맷해서 남깁니다. Format의 수명을 보장할 수 없을 때 사용 */
+    static void LogV(const FLogCategory& Category, ELogLevel Level, const char* Format, va_list Args);
+
+private:
+    /** 빈 Slot을 예약합니다. Ring이 가득 차서 버려야 하면 nullptr */
+    static FLogRecord* BeginRecord(const FLogCategory& Category, ELogLevel Level);
+
+    /** 예약한 Slot을 Sink Thread에 넘깁니다. */
+    static void CommitRecord(FLogRecord* Record);
+};
+
+template <typename... ArgTypes>
+void FLog::Log(const FLogCategory& Category, ELogLevel Level, const char* Format, const ArgTypes&... Args)
+{
+    FLogRecord* Record = BeginRecord(Category, Level);
+    if (!Record)
+    {
+        return;
+    }
+
+    uint8* Cursor = Record->Payload;
+    const uint8* End = Record->Payload + FLogRecord::PayloadSize;
+    if ((LogPrivate::EncodeArg(Cursor, End, Args) && ...))
+    {
+        Record->Format = Format;
+        Record->FormatFunc = &LogPrivate::FormatPayload<ArgTypes...>;
+    }
+    else
+    {
+        // 인자가 Payload에 들어가지 않으면 지금 포맷
+        char* Text = reinterpret_cast<char*>(Record->Payload);
+        const int32 Len = snprintf(Text, FLogRecord::PayloadSize, Format, Args...);
+        if (Len >= FLogRecord::PayloadSize)
+        {
+            Record->LongMessage = static_cast<char*>(malloc(static_cast<size_t>(Len) + 1));
+            snprintf(Record->LongMessage, static_cast<size_t>(Len) + 1, Format, Args...);
+        }
+    }
+
+    CommitRecord(Record);
+}
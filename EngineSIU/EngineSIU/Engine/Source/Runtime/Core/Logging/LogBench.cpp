@@ -0,0 +1,40 @@
+#include "Log.h"
+#include "Misc/Benchmark.h"
+#include "UserInterface/Console.h"
+
+// 평소에는 꺼져 있고, 'log bench'가 측정하는 동안만 켬
+DEFINE_LOG_CATEGORY(LogBench, ELogLevel::Warning)
+
+namespace
+{
+    /**
+     * UE_LOG가 호출한 Thread에서 걸리는 시간을 측정합니다.
+     * 출력은 Sink Thread가 하므로, 남은 로그를 Flush하는 데 걸린 시간을 따로 보여줍니다.
+     */
+    void RunLogBenchmark(const FBenchmarkContext& Context)
+    {
+        const int32 NumLogs = Context.Count;
+        const uint64 DroppedBefore = FLog::GetNumDropped();
+
+        auto LogAll = [NumLogs]
+        {
+            for (int32 Index = 0; Index < NumLogs; ++Index)
+            {
+                UE_LOG_CATEGORY(LogBench, ELogLevel::Display, "Spawned %s_%d at (%.2f, %.2f, %.2f)", "StaticMeshActor", Index, Index * 0.5f, 1.0f, 2.0f);
+            }
+        };
+
+        Context.Measure("UE_LOG (filtered)", NumLogs, LogAll);
+
+        LogBench.SetMinLevel(ELogLevel::Display);
+        Context.Measure("UE_LOG (enqueue)", NumLogs, LogAll);
+        Context.Measure("Flush", NumLogs, [] { FLog::Flush(); });
+        LogBench.SetMinLevel(ELogLevel::Warning);
+
+        Context.Console.AddLog(ELogLevel::Display, "Log bench: %d logs, %llu dropped", NumLogs, FLog::GetNumDropped() - DroppedBefore);
+    }
+
+    FAutoRegisterBenchmark LogBenchmark(
+        "log bench", "[count]: Measure UE_LOG cost on the calling thread and the sink flush", 100000, &RunLogBenchmark
+    );
+}
@@ -54,6 +54,137 @@ FORCEINLINE VectorRegister4Float VectorMultiplyAdd(
     return VectorAdd(VectorMultiply(Vec1, Vec2), Vec3);
 }
 
+FORCEINLINE VectorRegister4Float VectorSubtract(const VectorRegister4Float& Vec1, const VectorRegister4Float& Vec2)
+{
+    return _mm_sub_ps(Vec1, Vec2);
+}
+
+FORCEINLINE VectorRegister4Float VectorDivide(const VectorRegister4Float& Vec1, const VectorRegister4Float& Vec2)
+{
+    return _mm_div_ps(Vec1, Vec2);
+}
+
+/** 모든 요소가 0인 레지스터 */
+FORCEINLINE VectorRegister4Float VectorZero()
+{
+    return _mm_setzero_ps();
+}
+
+/** 모든 요소를 F로 채운 레지스터 */
+FORCEINLINE VectorRegister4Float VectorSetFloat1(float F)
+{
+    return _mm_set1_ps(F);
+}
+
+/** 순서대로 X, Y, Z, W에 값을 넣은 레지스터 */
+FORCEINLINE VectorRegister4Float VectorSet(float X, float Y, float Z, float W)
+{
+    return _mm_setr_ps(X, Y, Z, W);
+}
+
+FORCEINLINE VectorRegister4Float VectorMin(const VectorRegister4Float& Vec1, const VectorRegister4Float& Vec2)
+{
+    return _mm_min_ps(Vec1, Vec2);
+}
+
+FORCEINLINE VectorRegister4Float VectorMax(const VectorRegister4Float& Vec1, const VectorRegister4Float& Vec2)
+{
+    return _mm_max_ps(Vec1, Vec2);
+}
+
+/** 각 요소를 [Min, Max] 범위로 제한합니다. */
+FORCEINLINE VectorRegister4Float VectorClamp(const VectorRegister4Float& Vec, const VectorRegister4Float& Min, const VectorRegister4Float& Max)
+{
+    return VectorMin(VectorMax(Vec, Min), Max);
+}
+
+FORCEINLINE VectorRegister4Float VectorAbs(const VectorRegister4Float& Vec)
+{
+    return _mm_andnot_ps(_mm_set1_ps(-0.0f), Vec);
+}
+
+FORCEINLINE VectorRegister4Float VectorNegate(const VectorRegister4Float& Vec)
+{
+    return _mm_xor_ps(Vec, _mm_set1_ps(-0.0f));
+}
+
+/** 비교 결과가 참인 요소는 모든 bit가 1, 거짓이면 0 */
+FORCEINLINE VectorRegister4Float VectorCompareGT(const VectorRegister4Float& Vec1, const VectorRegister4Float& Vec2)
+{
+    return _mm_cmpgt_ps(Vec1, Vec2);
+}
+
+FORCEINLINE VectorRegister4Float VectorCompareGE(const VectorRegister4Float& Vec1, const VectorRegister4Float& Vec2)
+{
+    return _mm_cmpge_ps(Vec1, Vec2);
+}
+
+FORCEINLINE VectorRegister4Float VectorCompareLT(const VectorRegister4Float& Vec1, const VectorRegister4Float& Vec2)
+{
+    return _mm_cmplt_ps(Vec1, Vec2);
+}
+
+FORCEINLINE VectorRegister4Float VectorCompareLE(const VectorRegister4Float& Vec1, const VectorRegister4Float& Vec2)
+{
+    return _mm_cmple_ps(Vec1, Vec2);
+}
+
+FORCEINLINE VectorRegister4Float VectorBitwiseAnd(const VectorRegister4Float& Vec1, const VectorRegister4Float& Vec2)
+{
+    return _mm_and_ps(Vec1, Vec2);
+}
+
+FORCEINLINE VectorRegister4Float VectorBitwiseOr(const VectorRegister4Float& Vec1, const VectorRegister4Float& Vec2)
+{
+    return _mm_or_ps(Vec1, Vec2);
+}
+
+/** Mask의 bit가 1인 요소는 Vec1, 0인 요소는 Vec2에서 가져옵니다. */
+FORCEINLINE VectorRegister4Float VectorSelect(const VectorRegister4Float& Mask, const VectorRegister4Float& Vec1, const VectorRegister4Float& Vec2)
+{
+    return _mm_or_ps(_mm_and_ps(Mask, Vec1), _mm_andnot_ps(Mask, Vec2));
+}
+
+/** 각 요소의 부호 bit를 모은 4bit 값, 비교 결과를 정수로 꺼낼 때 사용합니다. */
+FORCEINLINE int32 VectorMaskBits(const VectorRegister4Float& Vec)
+{
+    return _mm_movemask_ps(Vec);
+}
+
+/** XYZ 외적, W 요소는 0 */
+FORCEINLINE VectorRegister4Float VectorCross(const VectorRegister4Float& Vec1, const VectorRegister4Float& Vec2)
+{
+    const VectorRegister4Float A_YZX = _mm_shuffle_ps(Vec1, Vec1, SHUFFLEMASK(1, 2, 0, 3));
+    const VectorRegister4Float B_YZX = _mm_shuffle_ps(Vec2, Vec2, SHUFFLEMASK(1, 2, 0, 3));
+    const VectorRegister4Float Cross = VectorSubtract(VectorMultiply(Vec1, B_YZX), VectorMultiply(A_YZX, Vec2));
+    return _mm_shuffle_ps(Cross, Cross, SHUFFLEMASK(1, 2, 0, 3));
+}
+
+/**
+ * 쿼터니언 곱 (X, Y, Z, W 순서), FQuat::operator*와 같은 결과입니다.
+ * Quat2로 회전한 뒤 Quat1로 회전하는 쿼터니언을 반환합니다.
+ */
+FORCEINLINE VectorRegister4Float VectorQuaternionMultiply(const VectorRegister4Float& Quat1, const VectorRegister4Float& Quat2)
+{
+    const VectorRegister4Float SignX = _mm_setr_ps(1.f, -1.f, 1.f, -1.f);
+    const VectorRegister4Float SignY = _mm_setr_ps(1.f, 1.f, -1.f, -1.f);
+    const VectorRegister4Float SignZ = _mm_setr_ps(-1.f, 1.f, 1.f, -1.f);
+
+    VectorRegister4Float Result = VectorMultiply(VectorReplicate(Quat1, 3), Quat2);
+    Result = VectorMultiplyAdd(VectorMultiply(VectorReplicate(Quat1, 0), _mm_shuffle_ps(Quat2, Quat2, SHUFFLEMASK(3, 2, 1, 0))), SignX, Result);
+    Result = VectorMultiplyAdd(VectorMultiply(VectorReplicate(Quat1, 1), _mm_shuffle_ps(Quat2, Quat2, SHUFFLEMASK(2, 3, 0, 1))), SignY, Result);
+    Result = VectorMultiplyAdd(VectorMultiply(VectorReplicate(Quat1, 2), _mm_shuffle_ps(Quat2, Quat2, SHUFFLEMASK(1, 0, 3, 2))), SignZ, Result);
+    return Result;
+}
+
+/** 단위 쿼터니언으로 벡터를 회전합니다. Vec의 W 요소는 0이어야 합니다. */
+FORCEINLINE VectorRegister4Float VectorQuaternionRotateVector(const VectorRegister4Float& Quat, const VectorRegister4Float& Vec)
+{
+    // V' = V + W * T + Q x T (T = 2 * (Q x V))
+    const VectorRegister4Float T = VectorAdd(VectorCross(Quat, Vec), VectorCross(Quat, Vec));
+    return VectorAdd(VectorMultiplyAdd(VectorReplicate(Quat, 3), T, Vec), VectorCross(Quat, T));
+}
+
 inline void VectorMatrixMultiply(FMatrix* Result, const FMatrix* Matrix1, const FMatrix* Matrix2)
 {
     // 레지스터에 값 로드
@@ -0,0 +1,53 @@
+#include "Benchmark.h"
+#include <cstdlib>
+
+#include "Math/MathUtility.h"
+#include "UserInterface/Console.h"
+
+
+void FBenchmarkContext::Report(const char* Label, double ElapsedMs, double NumOps, const char* OpName) const
+{
+    Console.AddLog(
+        ELogLevel::Display, "%-32s %8.2f ms (%.1f ns/%s)",
+        Label, ElapsedMs, ElapsedMs * 1e6 / FMath::Max(NumOps, 1.0), OpName
+    );
+}
+
+void FBenchmarkRegistry::Register(const FBenchmarkCommand& Command)
+{
+    GetMutableCommands().Add(Command);
+}
+
+const TArray<FBenchmarkCommand>& FBenchmarkRegistry::GetCommands()
+{
+    return GetMutableCommands();
+}
+
+bool FBenchmarkRegistry::Execute(FConsole& Console, const std::string& CommandLine)
+{
+    for (const FBenchmarkCommand& Command : GetCommands())
+    {
+        const std::string_view Name = Command.Name;
+        if (!CommandLine.starts_with(Name) || (CommandLine.size() > Name.size() && CommandLine[Name.size()] != ' '))
+        {
+            continue;
+        }
+
+        // 숫자가 없거나 잘못되면 기본값
+        const char* Arguments = CommandLine.c_str() + Name.size();
+        char* End = nullptr;
+        const long Count = std::strtol(Arguments, &End, 10);
+
+        const FBenchmarkContext Context{ Console, End != Arguments ? FMath::Max(static_cast<int32>(Count), 1) : Command.DefaultCount };
+        Command.Function(Context);
+        return true;
+    }
+    return false;
+}
+
+TArray<FBenchmarkCommand>& FBenchmarkRegistry::GetMutableCommands()
+{
+    // 다른 파일의 FAutoRegisterBenchmark 전역 변수보다 먼저 초기화되도록 함수 안의 static
+    static TArray<FBenchmarkCommand> Commands;
+    return Commands;
+}
@@ -0,0 +1,91 @@
+#pragma once
+#include <string>
+
+#include "Container/Array.h"
+#include "HAL/PlatformType.h"
+#include "Windows/WindowsPlatformTime.h"
+
+class FConsole;
+
+/** Body를 한 번 실행하는 데 걸린 시간 (ms) */
+template <typename FuncType>
+double MeasureMilliseconds(FuncType&& Body)
+{
+    const uint64 StartCycles = FPlatformTime::Cycles64();
+    Body();
+    return FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+}
+
+/**
+ * 콘솔 벤치마크 명령 한 번의 실행 정보
+ * 벤치마크는 결과를 Console에 한 줄씩 출력합니다.
+ */
+struct FBenchmarkContext
+{
+    FConsole& Console;
+
+    // 명령 뒤에 준 숫자, 없으면 벤치마크의 기본값 (항상 1 이상)
+    int32 Count;
+
+    /**
+     * Body를 한 번 실행한 시간을 재서 Report로 출력합니다.
+     * @param NumOps Body 안에서 반복한 작업 수, OpName 하나당 시간을 계산
+     * @return 걸린 시간 (ms)
+     */
+    template <typename FuncType>
+    double Measure(const char* Label, double NumOps, FuncType&& Body, const char* OpName = "op") const
+    {
+        const double ElapsedMs = MeasureMilliseconds(Body);
+        Report(Label, ElapsedMs, NumOps, OpName);
+        return ElapsedMs;
+    }
+
+    /** "Label    12.34 ms (5.6 ns/op)" 형식으로 한 줄 출력합니다. */
+    void Report(const char* Label, double ElapsedMs, double NumOps, const char* OpName = "op") const;
+};
+
+using FBenchmarkFunction = void(*)(const FBenchmarkContext& Context);
+
+/** "map bench [count]" 같은 벤치마크 콘솔 명령 하나 */
+struct FBenchmarkCommand
+{
+    // 콘솔에 입력하는 이름, 예: "map bench"
+    const char* Name;
+
+    // help에 이름 뒤로 출력하는 인자와 설명, 예: "[count]: Compare ..."
+    const char* Usage;
+
+    int32 DefaultCount;
+
+    FBenchmarkFunction Function;
+};
+
+/**
+ * 각 모듈의 *Bench.cpp가 등록한 벤치마크 명령 목록
+ * FConsole::ExecuteCommand가 다른 명령보다 먼저 여기에 넘깁니다.
+ */
+class FBenchmarkRegistry
+{
+public:
+    static void Register(const FBenchmarkCommand& Command);
+
+    static const TArray<FBenchmarkCommand>& GetCommands();
+
+    /**
+     * CommandLine이 "<Name>" 또는 "<Name> <Count>"이면 해당 벤치마크를 실행합니다.
+     * @return 등록된 벤치마크 명령이 아니면 false
+     */
+    static bool Execute(FConsole& Console, const std::string& CommandLine);
+
+private:
+    static TArray<FBenchmarkCommand>& GetMutableCommands();
+};
+
+/** 전역 변수로 선언하면 프로그램 시작 시 벤치마크 명령을 등록합니다. */
+struct FAutoRegisterBenchmark
+{
+    FAutoRegisterBenchmark(const char* Name, const char* Usage, int32 DefaultCount, FBenchmarkFunction Function)
+    {
+        FBenchmarkRegistry::Register({ Name, Usage, DefaultCount, Function });
+    }
+};
@@ -0,0 +1,24 @@
+#pragma once
+#include "HAL/PlatformType.h"
+
+
+struct FHash
+{
+    static constexpr uint64 Fnv1a64Offset = 14695981039346656037ull;
+    static constexpr uint64 Fnv1a64Prime = 1099511628211ull;
+
+    /**
+     * FNV-1a 64bit Hash, 파일 내용 비교나 Checksum용
+     * @param Hash 이전 결과를 넘기면 이어서 계산
+     */
+    static uint64 Fnv1a64(const void* Data, uint64 Length, uint64 Hash = Fnv1a64Offset)
+    {
+        const uint8* Bytes = static_cast<const uint8*>(Data);
+        for (uint64 Index = 0; Index < Length; ++Index)
+        {
+            Hash ^= Bytes[Index];
+            Hash *= Fnv1a64Prime;
+        }
+        return Hash;
+    }
+};
@@ -1,4 +1,6 @@
 ﻿#pragma once
+#include <stdexcept>
+
 #include "CoreMiscDefines.h"
 #include "Container/String.h"
 #include "HAL/PlatformType.h"
@@ -70,6 +72,7 @@ public:
 
         if (Ar.IsLoading())
         {
+            Ar.CheckLoadedNum(Length, sizeof(TCHAR));
             Value.Resize(Length);
         }
         Ar.Serialize(GetData(Value), Length * sizeof(TCHAR));
@@ -77,6 +80,21 @@ public:
         return Ar;
     }
 
+    FORCEINLINE friend FArchive& operator<<(FArchive& Ar, FWString& Value)
+    {
+        int32 Length = static_cast<int32>(Value.length());
+        Ar << Length;
+
+        if (Ar.IsLoading())
+        {
+            Ar.CheckLoadedNum(Length, sizeof(wchar_t));
+            Value.resize(Length);
+        }
+        Ar.Serialize(Value.data(), Length * sizeof(wchar_t));
+
+        return Ar;
+    }
+
     virtual void Serialize(void* V, int64 Length)
     {
         if (IsLoading())
@@ -100,6 +118,34 @@ public:
     virtual void Seek(int64 InPos) {}
     virtual int64 Tell() { return INDEX_NONE; }
 
+    /** 전체 데이터 크기, 알 수 없으면 INDEX_NONE */
+    virtual int64 TotalSize() { return INDEX_NONE; }
+
+    /**
+     * 로드할 때 읽은 원소 수를 남은 데이터 크기와 비교합니다.
+     * 깨진 파일의 원소 수로 SetNum 하기 전에 불러서, 거대한 할당 대신 예외로 실패하게 합니다.
+     *
+     * @param Num 읽은 원소 수
+     * @param MinElementSize 원소 하나가 차지하는 최소 Byte 수
+     */
+    void CheckLoadedNum(int64 Num, int64 MinElementSize)
+    {
+        if (!IsLoading())
+        {
+            return;
+        }
+        if (Num < 0)
+        {
+            throw std::runtime_error("Negative element count in archive.");
+        }
+
+        const int64 Size = TotalSize();
+        if (Size != INDEX_NONE && Num * MinElementSize > Size - Tell())
+        {
+            throw std::runtime_error("Element count exceeds the remaining archive data.");
+        }
+    }
+
 
     virtual void SaveData(const void* Data, uint64 Length) {}
     virtual void LoadData(void* Data, uint64 Length) {}
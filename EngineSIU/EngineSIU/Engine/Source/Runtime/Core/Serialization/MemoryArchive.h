@@ -23,16 +23,34 @@ protected:
     virtual FArchive& operator<<(FName& N) override
     {
         // Serialize the FName as a string
+        // FString과 같은 형식(길이 + TCHAR 배열)이지만, 임시 FString 없이 Pool의 문자열을 바로 읽고 씀
         if (IsLoading())
         {
-            FString StringName;
-            *this << StringName;
-            N = FName(*StringName);
+            int32 Length = 0;
+            *this << Length;
+            CheckLoadedNum(Length, sizeof(TCHAR));
+
+            if (Length >= NAME_SIZE)
+            {
+                FString StringName;
+                StringName.Resize(Length);
+                Serialize(GetData(StringName), static_cast<int64>(Length) * sizeof(TCHAR));
+                N = FName(StringName);
+            }
+            else
+            {
+                TCHAR Buffer[NAME_SIZE];
+                Serialize(Buffer, static_cast<int64>(Length) * sizeof(TCHAR));
+                N = FName(Buffer, static_cast<uint32>(Length));
+            }
         }
         else
         {
-            FString StringName = N.ToString();
-            *this << StringName;
+            TCHAR Buffer[NAME_SIZE];
+            const TCHAR* StringName = N.ToCString(Buffer);
+            int32 Length = static_cast<int32>(std::char_traits<TCHAR>::length(StringName));
+            *this << Length;
+            Serialize(const_cast<TCHAR*>(StringName), static_cast<int64>(Length) * sizeof(TCHAR));
         }
         return *this;
     }
@@ -78,6 +96,11 @@ public:
         }
     }
 
+    virtual int64 TotalSize() override
+    {
+        return Data.Num();
+    }
+
 private:
     TArray<uint8>& Data;
 };
@@ -115,6 +138,53 @@ public:
         Offset = InPos;
     }
 
+    virtual int64 TotalSize() override
+    {
+        return Data.Num();
+    }
+
 private:
     const TArray<uint8>& Data;
 };
+
+/** 복사하지 않고 외부 메모리(Memory-mapped File 등)를 읽는 FMemoryReader */
+class FMemoryReaderView : public FMemoryArchive
+{
+public:
+    FMemoryReaderView(const uint8* InData, int64 InSize)
+        : Data(InData)
+        , Size(InSize)
+    {
+        bIsSaving = false;
+        bIsLoading = true;
+    }
+
+    virtual void LoadData(void* OutData, uint64 Length) override
+    {
+        if (Offset + Length > static_cast<uint64>(Size))
+        {
+            throw std::runtime_error("Attempted to read beyond the end of the view.");
+        }
+
+        FPlatformMemory::Memcpy(OutData, Data + Offset, Length);
+        Offset += Length;
+    }
+
+    virtual void Seek(int64 InPos) override
+    {
+        if (InPos > Size)
+        {
+            throw std::runtime_error("Attempted to seek beyond the end of the view.");
+        }
+        Offset = InPos;
+    }
+
+    virtual int64 TotalSize() override
+    {
+        return Size;
+    }
+
+private:
+    const uint8* Data;
+    int64 Size;
+};
@@ -1,4 +1,403 @@
 #include "ProfilerStatsManager.h"
 
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+
+#include "WindowsPlatformTime.h"
+
 // Initialize static members
 TMap<FName, double> FProfilerStatsManager::CPUStatsMS;
+TArray<FProfilerThreadTree> FProfilerStatsManager::ThreadTrees;
+bool FProfilerStatsManager::bTracing = false;
+
+namespace
+{
+    struct FProfilerEvent
+    {
+        uint64 Cycles;
+        FName StatName;
+        bool bBegin;
+    };
+
+    // Single producer (the owning thread), single consumer (the main thread in BeginFrame)
+    struct FProfilerEventBuffer
+    {
+        static constexpr uint64 Capacity = 1 << 14;
+
+        FProfilerEvent Events[Capacity];
+
+        std::atomic<uint64> WriteIndex = 0;
+        std::atomic<uint64> ReadIndex = 0;
+        std::atomic<uint64> NumDropped = 0;
+
+        // Producer only: scopes whose begin was written and whose end still needs a reserved slot
+        uint32 OpenDepth = 0;
+
+        // Producer only: nesting depth inside a scope whose begin was dropped
+        uint32 SkipDepth = 0;
+
+        uint32 ThreadId = 0;
+
+        // Guarded by GBufferLock
+        FString ThreadName;
+
+        // Consumer only: currently open scopes as (node index, begin cycles)
+        TArray<std::pair<int32, uint64>> OpenScopes;
+        int32 TreeIndex = INDEX_NONE;
+    };
+
+    struct FTraceEvent
+    {
+        FName StatName;
+        uint32 ThreadId;
+        uint64 BeginCycles;
+        uint64 EndCycles;
+    };
+
+    std::mutex GBufferLock;
+    TArray<std::unique_ptr<FProfilerEventBuffer>> GBuffers;
+
+    thread_local FProfilerEventBuffer* GThreadBuffer = nullptr;
+
+    // Main thread only
+    TArray<FTraceEvent> GTraceEvents;
+    TArray<uint64> GTraceFrameCycles;
+    uint64 GTraceStartCycles = 0;
+
+    FProfilerEventBuffer& GetThreadBuffer()
+    {
+        if (!GThreadBuffer)
+        {
+            std::unique_ptr<FProfilerEventBuffer> NewBuffer = std::make_unique<FProfilerEventBuffer>();
+            NewBuffer->ThreadId = GetCurrentThreadId();
+
+            std::lock_guard Lock(GBufferLock);
+            NewBuffer->ThreadName = FString::Printf(TEXT("Thread %u"), NewBuffer->ThreadId);
+            GThreadBuffer = NewBuffer.get();
+            GBuffers.Add(std::move(NewBuffer));
+        }
+        return *GThreadBuffer;
+    }
+
+    void PushEvent(const FName& StatName, bool bBegin)
+    {
+        FProfilerEventBuffer& Buffer = GetThreadBuffer();
+
+        if (Buffer.SkipDepth > 0)
+        {
+            bBegin ? ++Buffer.SkipDepth : --Buffer.SkipDepth;
+            return;
+        }
+
+        const uint64 Write = Buffer.WriteIndex.load(std::memory_order_relaxed);
+        if (bBegin)
+        {
+            // Keep one slot for the end of every open scope, so nesting is never broken by a full buffer
+            const uint64 Used = Write - Buffer.ReadIndex.load(std::memory_order_acquire);
+            if (Used + Buffer.OpenDepth + 2 > FProfilerEventBuffer::Capacity)
+            {
+                Buffer.SkipDepth = 1;
+                Buffer.NumDropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            ++Buffer.OpenDepth;
+        }
+        else
+        {
+            if (Buffer.OpenDepth == 0)
+            {
+                return;
+            }
+            --Buffer.OpenDepth;
+        }
+
+        FProfilerEvent& Event = Buffer.Events[Write % FProfilerEventBuffer::Capacity];
+        Event.Cycles = FPlatformTime::Cycles64();
+        Event.StatName = StatName;
+        Event.bBegin = bBegin;
+        Buffer.WriteIndex.store(Write + 1, std::memory_order_release);
+    }
+
+    int32 FindOrAddChild(FProfilerThreadTree& Tree, int32 ParentIndex, const FName& StatName)
+    {
+        for (const int32 ChildIndex : Tree.Nodes[ParentIndex].Children)
+        {
+            if (Tree.Nodes[ChildIndex].StatName == StatName)
+            {
+                return ChildIndex;
+            }
+        }
+
+        FProfilerScopeNode NewNode;
+        NewNode.StatName = StatName;
+        NewNode.ParentIndex = ParentIndex;
+        const int32 NewIndex = Tree.Nodes.Add(std::move(NewNode));
+        Tree.Nodes[ParentIndex].Children.Add(NewIndex);
+        return NewIndex;
+    }
+
+    void FinishFrame(FProfilerScopeNode& Node)
+    {
+        constexpr int32 NumHistoryFrames = FProfilerScopeNode::NumHistoryFrames;
+
+        Node.HistoryMs[Node.NumHistory % NumHistoryFrames] = Node.FrameMs;
+        ++Node.NumHistory;
+
+        Node.LastMs = Node.FrameMs;
+        Node.LastCalls = Node.FrameCalls;
+        Node.FrameMs = 0.0;
+        Node.FrameCalls = 0;
+
+        const int32 Count = std::min(Node.NumHistory, NumHistoryFrames);
+        double Sum = 0.0;
+        Node.MinMs = Node.HistoryMs[0];
+        Node.MaxMs = Node.HistoryMs[0];
+        for (int32 Index = 0; Index < Count; ++Index)
+        {
+            Sum += Node.HistoryMs[Index];
+            Node.MinMs = std::min(Node.MinMs, Node.HistoryMs[Index]);
+            Node.MaxMs = std::max(Node.MaxMs, Node.HistoryMs[Index]);
+        }
+        Node.AvgMs = Sum / Count;
+    }
+
+    void EscapeJson(std::string_view In, std::string& Out)
+    {
+        constexpr char HexDigits[] = "0123456789abcdef";
+        for (const char Char : In)
+        {
+            const uint8 Code = static_cast<uint8>(Char);
+            if (Char == '"' || Char == '\\')
+            {
+                Out += '\\';
+                Out += Char;
+            }
+            else if (Code < 0x20)
+            {
+                // JSON 문자열에는 제어 문자를 그대로 넣을 수 없음
+                Out += "\\u00";
+                Out += HexDigits[Code >> 4];
+                Out += HexDigits[Code & 0xF];
+            }
+            else
+            {
+                Out += Char;
+            }
+        }
+    }
+
+    void EscapeJson(const FString& In, std::string& Out)
+    {
+        EscapeJson(std::string_view(In.ToAnsiString()), Out);
+    }
+
+    void EscapeJson(const FName& In, std::string& Out)
+    {
+        // Event마다 임시 FString을 만들지 않도록 Pool의 문자열을 바로 읽음
+        const FNameView View = In.GetView();
+        if (View.IsWide())
+        {
+            EscapeJson(In.ToString(), Out);
+            return;
+        }
+        EscapeJson(std::string_view(View.GetAnsi(), View.Len), Out);
+    }
+}
+
+void FProfilerStatsManager::BeginFrame()
+{
+    DrainEvents();
+
+    CPUStatsMS.Empty();
+    for (FProfilerThreadTree& Tree : ThreadTrees)
+    {
+        for (int32 NodeIndex = 1; NodeIndex < Tree.Nodes.Num(); ++NodeIndex)
+        {
+            FProfilerScopeNode& Node = Tree.Nodes[NodeIndex];
+            if (Node.FrameCalls > 0)
+            {
+                CPUStatsMS.FindOrAdd(Node.StatName) += Node.FrameMs;
+            }
+            FinishFrame(Node);
+        }
+    }
+
+    if (bTracing)
+    {
+        GTraceFrameCycles.Add(FPlatformTime::Cycles64());
+    }
+}
+
+void FProfilerStatsManager::DrainEvents()
+{
+    TArray<FProfilerEventBuffer*> Buffers;
+    {
+        std::lock_guard Lock(GBufferLock);
+        for (const std::unique_ptr<FProfilerEventBuffer>& Buffer : GBuffers)
+        {
+            if (Buffer->TreeIndex == INDEX_NONE)
+            {
+                FProfilerThreadTree NewTree;
+                NewTree.ThreadId = Buffer->ThreadId;
+                NewTree.Nodes.Add(FProfilerScopeNode());
+                Buffer->TreeIndex = ThreadTrees.Add(std::move(NewTree));
+            }
+            ThreadTrees[Buffer->TreeIndex].ThreadName = Buffer->ThreadName;
+            Buffers.Add(Buffer.get());
+        }
+    }
+
+    for (FProfilerEventBuffer* Buffer : Buffers)
+    {
+        FProfilerThreadTree& Tree = ThreadTrees[Buffer->TreeIndex];
+
+        const uint64 Read = Buffer->ReadIndex.load(std::memory_order_relaxed);
+        const uint64 Write = Buffer->WriteIndex.load(std::memory_order_acquire);
+        for (uint64 Index = Read; Index < Write; ++Index)
+        {
+            const FProfilerEvent& Event = Buffer->Events[Index % FProfilerEventBuffer::Capacity];
+            if (Event.bBegin)
+            {
+                const int32 ParentIndex = Buffer->OpenScopes.Num() > 0 ? Buffer->OpenScopes[Buffer->OpenScopes.Num() - 1].first : 0;
+                Buffer->OpenScopes.Add({ FindOrAddChild(Tree, ParentIndex, Event.StatName), Event.Cycles });
+                continue;
+            }
+
+            if (Buffer->OpenScopes.Num() == 0)
+            {
+                continue;
+            }
+
+            const auto [NodeIndex, BeginCycles] = Buffer->OpenScopes.Pop();
+
+            FProfilerScopeNode& Node = Tree.Nodes[NodeIndex];
+            Node.FrameMs += FPlatformTime::ToMilliseconds(Event.Cycles - BeginCycles);
+            ++Node.FrameCalls;
+
+            if (bTracing)
+            {
+                GTraceEvents.Add({ Node.StatName, Buffer->ThreadId, BeginCycles, Event.Cycles });
+            }
+        }
+        Buffer->ReadIndex.store(Write, std::memory_order_release);
+    }
+}
+
+void FProfilerStatsManager::BeginScope(const TStatId& StatId)
+{
+    PushEvent(StatId.GetName(), true);
+}
+
+void FProfilerStatsManager::EndScope(const TStatId& StatId)
+{
+    PushEvent(StatId.GetName(), false);
+}
+
+void FProfilerStatsManager::SetCurrentThreadName(const FString& ThreadName)
+{
+    FProfilerEventBuffer& Buffer = GetThreadBuffer();
+
+    std::lock_guard Lock(GBufferLock);
+    Buffer.ThreadName = ThreadName;
+}
+
+void FProfilerStatsManager::StartTrace()
+{
+    GTraceEvents.Empty();
+    GTraceFrameCycles.Empty();
+    GTraceStartCycles = FPlatformTime::Cycles64();
+    bTracing = true;
+}
+
+bool FProfilerStatsManager::StopTrace(const FString& FilePath)
+{
+    if (!bTracing)
+    {
+        return false;
+    }
+
+    // Collect the scopes that finished since the last BeginFrame, they still count for the current frame
+    DrainEvents();
+    bTracing = false;
+
+    const std::filesystem::path Path(FilePath.ToAnsiString());
+    if (Path.has_parent_path())
+    {
+        std::error_code ErrorCode;
+        std::filesystem::create_directories(Path.parent_path(), ErrorCode);
+    }
+
+    std::ofstream File(Path);
+    if (!File.is_open())
+    {
+        return false;
+    }
+
+    const auto ToMicroseconds = [](uint64 Cycles)
+    {
+        return Cycles > GTraceStartCycles ? FPlatformTime::ToMilliseconds(Cycles - GTraceStartCycles) * 1000.0 : 0.0;
+    };
+
+    std::string Json;
+    Json.reserve(128 * (GTraceEvents.Num() + 16));
+    Json += "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+
+    bool bFirst = true;
+    const auto BeginEntry = [&Json, &bFirst]()
+    {
+        Json += bFirst ? "" : ",\n";
+        bFirst = false;
+    };
+
+    for (const FProfilerThreadTree& Tree : ThreadTrees)
+    {
+        BeginEntry();
+        Json += "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" + std::to_string(Tree.ThreadId) + ",\"args\":{\"name\":\"";
+        EscapeJson(Tree.ThreadName, Json);
+        Json += "\"}}";
+    }
+
+    for (int32 Frame = 0; Frame < GTraceFrameCycles.Num(); ++Frame)
+    {
+        BeginEntry();
+        Json += "{\"name\":\"Frame " + std::to_string(Frame) + "\",\"ph\":\"i\",\"s\":\"g\",\"pid\":1,\"tid\":0,\"ts\":"
+            + std::to_string(ToMicroseconds(GTraceFrameCycles[Frame])) + "}";
+    }
+
+    char Number[64];
+    for (const FTraceEvent& Event : GTraceEvents)
+    {
+        BeginEntry();
+        Json += "{\"name\":\"";
+        EscapeJson(Event.StatName, Json);
+        Json += "\",\"cat\":\"CPU\",\"ph\":\"X\",\"pid\":1,\"tid\":" + std::to_string(Event.ThreadId);
+
+        const double BeginUs = ToMicroseconds(Event.BeginCycles);
+        const double EndUs = ToMicroseconds(Event.EndCycles);
+        snprintf(Number, sizeof(Number), ",\"ts\":%.3f,\"dur\":%.3f}", BeginUs, EndUs - BeginUs);
+        Json += Number;
+    }
+
+    Json += "\n]}\n";
+    File << Json;
+
+    GTraceEvents.Empty();
+    GTraceFrameCycles.Empty();
+    return File.good();
+}
+
+uint64 FProfilerStatsManager::GetNumDroppedEvents()
+{
+    std::lock_guard Lock(GBufferLock);
+
+    uint64 NumDropped = 0;
+    for (const std::unique_ptr<FProfilerEventBuffer>& Buffer : GBuffers)
+    {
+        NumDropped += Buffer->NumDropped.load(std::memory_order_relaxed);
+    }
+    return NumDropped;
+}
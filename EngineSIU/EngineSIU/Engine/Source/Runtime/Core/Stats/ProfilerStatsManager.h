@@ -1,33 +1,99 @@
 #pragma once
 
 #include "Core/HAL/PlatformType.h"
+#include "CoreMiscDefines.h"
+#include "Container/Array.h"   // For TArray
+#include "Container/String.h"  // For FString
 #include "UObject/NameTypes.h" // For FName
 #include "Container/Map.h"     // For TMap
 #include "Stats.h"             // For TStatId
 
+// One scope in the per-thread call tree, identified by its path from the thread root
+struct FProfilerScopeNode
+{
+    static constexpr int32 NumHistoryFrames = 120;
+
+    FName StatName;
+    int32 ParentIndex = INDEX_NONE;
+    TArray<int32> Children;
+
+    // Inclusive time and call count of the last finished frame
+    double LastMs = 0.0;
+    uint32 LastCalls = 0;
+
+    // Min/Avg/Max of the inclusive time over the recorded history
+    double MinMs = 0.0;
+    double AvgMs = 0.0;
+    double MaxMs = 0.0;
+
+    // Ring buffer of the inclusive time per frame
+    double HistoryMs[NumHistoryFrames] = {};
+    int32 NumHistory = 0;
+
+    // Accumulated while draining the current frame
+    double FrameMs = 0.0;
+    uint32 FrameCalls = 0;
+};
+
+struct FProfilerThreadTree
+{
+    FString ThreadName;
+    uint32 ThreadId = 0;
+
+    // Index 0 is the virtual root of the thread
+    TArray<FProfilerScopeNode> Nodes;
+};
+
+/**
+ * Hierarchical CPU profiler fed by FScopeCycleCounter.
+ *
+ * Every thread writes begin/end events into its own lock-free ring buffer.
+ * BeginFrame drains all buffers on the main thread, rebuilds the nesting into a per-thread
+ * scope tree, keeps Min/Avg/Max over the last NumHistoryFrames frames and optionally
+ * records a Chrome trace-event capture (chrome://tracing, Perfetto).
+ */
 class FProfilerStatsManager
 {
 public:
-    // Call at the beginning of each frame to clear previous results
-    static void BeginFrame()
-    {
-        CPUStatsMS.Empty();
-    }
+    // Call at the beginning of each frame on the main thread to aggregate the previous frame's events
+    static void BeginFrame();
 
-    // Called by FScopeCycleCounter to record CPU time
-    static void AddCpuStat(const TStatId& StatId, const double TimeMs)
-    {
-        CPUStatsMS.FindOrAdd(StatId.GetName()) = TimeMs;
-    }
+    // Called by FScopeCycleCounter, safe on any thread
+    static void BeginScope(const TStatId& StatId);
+    static void EndScope(const TStatId& StatId);
 
-    // Retrieve CPU time for a given StatId
+    // Names the calling thread in the scope tree and trace output
+    static void SetCurrentThreadName(const FString& ThreadName);
+
+    // Retrieve the total CPU time of a stat in the previous frame, summed over all calls and threads
     static double GetCpuStatMs(const FName& StatName)
     {
         const double* FoundMs = CPUStatsMS.Find(StatName);
         return FoundMs ? *FoundMs : -1.0; // Return -1 if not found
     }
 
+    // Per-thread scope trees of the previous frame, main thread only
+    static const TArray<FProfilerThreadTree>& GetThreadTrees() { return ThreadTrees; }
+
+    // Starts collecting every scope for a Chrome trace-event JSON dump
+    static void StartTrace();
+
+    // Drains the pending events and writes the capture to FilePath
+    static bool StopTrace(const FString& FilePath);
+
+    static bool IsTracing() { return bTracing; }
+
+    // Number of events dropped because a ring buffer was full
+    static uint64 GetNumDroppedEvents();
+
 private:
-    // Map from Stat Name to elapsed time in milliseconds for the current frame
+    // Moves the events of every thread buffer into the scope trees (and the trace capture)
+    static void DrainEvents();
+
+    // Map from Stat Name to elapsed time in milliseconds for the previous frame
     static TMap<FName, double> CPUStatsMS;
+
+    static TArray<FProfilerThreadTree> ThreadTrees;
+
+    static bool bTracing;
 };
@@ -6,7 +6,9 @@
 FScopeCycleCounter::FScopeCycleCounter(TStatId StatId)
     : StartCycles(FPlatformTime::Cycles64())
     , UsedStatId(StatId)
+    , bFinished(false)
 {
+    FProfilerStatsManager::BeginScope(UsedStatId);
 }
 
 FScopeCycleCounter::~FScopeCycleCounter()
@@ -16,11 +18,17 @@ FScopeCycleCounter::~FScopeCycleCounter()
 
 uint64 FScopeCycleCounter::Finish()
 {
+    if (bFinished)
+    {
+        return 0;
+    }
+    bFinished = true;
+
     const uint64 EndCycles = FPlatformTime::Cycles64();
     const uint64 CycleDiff = EndCycles - StartCycles;
 
     // FThreadStats::AddMessage(UsedStatId, EStatOperation::Add, CycleDiff);
-    FProfilerStatsManager::AddCpuStat(UsedStatId, FPlatformTime::ToMilliseconds(CycleDiff));
+    FProfilerStatsManager::EndScope(UsedStatId);
 
     return CycleDiff;
 }
@@ -23,8 +23,10 @@ public:
 private:
     uint64 StartCycles;
 
-    [[maybe_unused]]
     TStatId UsedStatId;
+
+    // Finish를 직접 호출한 뒤 소멸자에서 다시 기록하지 않도록
+    bool bFinished;
 };
 
 #define QUICK_SCOPE_CYCLE_COUNTER(Stat) \
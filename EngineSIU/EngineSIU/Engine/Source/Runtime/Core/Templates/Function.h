@@ -0,0 +1,319 @@
+#pragma once
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformType.h"
+
+template <typename Signature>
+class TFunction;
+
+template <typename Signature>
+class TFunctionRef;
+
+
+namespace FunctionPrivate
+{
+    /** TFunction 안에 Heap 할당 없이 저장할 수 있는 Functor의 최대 크기 */
+    constexpr size_t InlineSize = 48;
+    constexpr size_t InlineAlignment = alignof(std::max_align_t);
+
+    template <typename FunctorType>
+    constexpr bool IsStoredInline =
+        sizeof(FunctorType) <= InlineSize
+        && alignof(FunctorType) <= InlineAlignment
+        && std::is_nothrow_move_constructible_v<FunctorType>;
+
+    /** Functor 타입마다 하나씩 만들어지는 함수 Table, Inline이든 Heap이든 Storage의 시작 주소를 받음 */
+    template <typename ReturnType, typename... ParamTypes>
+    struct TFunctionVTable
+    {
+        ReturnType (*Invoke)(void* Storage, ParamTypes&&... Params);
+
+        /** Src의 Functor를 Dest로 옮기고 Src의 Functor는 소멸시킵니다. */
+        void (*Relocate)(void* Dest, void* Src);
+
+        /** Copy할 수 없는 Functor면 nullptr */
+        void (*Copy)(void* Dest, const void* Src);
+
+        void (*Destroy)(void* Storage);
+    };
+
+    /** Inline 저장이면 Storage에 Functor가, Heap 저장이면 Storage에 Functor의 포인터가 있음 */
+    template <typename FunctorType>
+    FORCEINLINE FunctorType& GetFunctor(void* Storage)
+    {
+        if constexpr (IsStoredInline<FunctorType>)
+        {
+            return *static_cast<FunctorType*>(Storage);
+        }
+        else
+        {
+            return **static_cast<FunctorType**>(Storage);
+        }
+    }
+
+    template <typename FunctorType, typename... ArgTypes>
+    void Construct(void* Storage, ArgTypes&&... Args)
+    {
+        if constexpr (IsStoredInline<FunctorType>)
+        {
+            new (Storage) FunctorType(std::forward<ArgTypes>(Args)...);
+        }
+        else
+        {
+            void* Memory = FPlatformMemory::AlignedMalloc<EAT_Container>(sizeof(FunctorType), alignof(FunctorType));
+            *static_cast<FunctorType**>(Storage) = new (Memory) FunctorType(std::forward<ArgTypes>(Args)...);
+        }
+    }
+
+    template <typename FunctorType, typename ReturnType, typename... ParamTypes>
+    struct TFunctionVTableFor
+    {
+        static ReturnType Invoke(void* Storage, ParamTypes&&... Params)
+        {
+            return std::invoke(GetFunctor<FunctorType>(Storage), std::forward<ParamTypes>(Params)...);
+        }
+
+        static void Relocate(void* Dest, void* Src)
+        {
+            if constexpr (IsStoredInline<FunctorType>)
+            {
+                FunctorType& SrcFunctor = GetFunctor<FunctorType>(Src);
+                new (Dest) FunctorType(std::move(SrcFunctor));
+                SrcFunctor.~FunctorType();
+            }
+            else
+            {
+                // Heap에 있으면 포인터만 옮김
+                *static_cast<FunctorType**>(Dest) = *static_cast<FunctorType**>(Src);
+            }
+        }
+
+        static void Copy(void* Dest, const void* Src)
+        {
+            Construct<FunctorType>(Dest, GetFunctor<FunctorType>(const_cast<void*>(Src)));
+        }
+
+        static void Destroy(void* Storage)
+        {
+            if constexpr (IsStoredInline<FunctorType>)
+            {
+                GetFunctor<FunctorType>(Storage).~FunctorType();
+            }
+            else
+            {
+                FunctorType* Functor = *static_cast<FunctorType**>(Storage);
+                Functor->~FunctorType();
+                FPlatformMemory::AlignedFree<EAT_Container>(Functor, sizeof(FunctorType));
+            }
+        }
+
+        using FCopyFunc = void (*)(void*, const void*);
+
+        // Copy할 수 없는 Functor는 Copy를 인스턴스화하지 않도록 if constexpr로 나눔
+        static constexpr FCopyFunc GetCopyFunc()
+        {
+            if constexpr (std::is_copy_constructible_v<FunctorType>)
+            {
+                return &Copy;
+            }
+            else
+            {
+                return nullptr;
+            }
+        }
+
+        static constexpr TFunctionVTable<ReturnType, ParamTypes...> VTable = {
+            &Invoke,
+            &Relocate,
+            GetCopyFunc(),
+            &Destroy,
+        };
+    };
+
+    template <typename T>
+    struct TIsTFunction : std::false_type {};
+
+    template <typename Signature>
+    struct TIsTFunction<TFunction<Signature>> : std::true_type {};
+
+    template <typename T>
+    struct TIsTFunctionRef : std::false_type {};
+
+    template <typename Signature>
+    struct TIsTFunctionRef<TFunctionRef<Signature>> : std::true_type {};
+}
+
+
+/**
+ * std::function을 대신하는 호출 가능한 객체의 Wrapper
+ *
+ * FunctionPrivate::InlineSize 이하의 Functor(this와 몇 개의 값을 캡처한 Lambda, Weak Pointer와 Method Pointer 등)는
+ * TFunction 안에 바로 저장하므로 Heap 할당이 없습니다. 더 큰 Functor만 Heap에 저장합니다.
+ * 호출은 Functor 타입별 함수 Table을 거치는 간접 호출 한 번입니다.
+ *
+ * @note Copy할 수 없는 Functor(Move Only Lambda 등)를 담은 TFunction은 Copy하면 안 됩니다.
+ */
+template <typename ReturnType, typename... ParamTypes>
+class TFunction<ReturnType(ParamTypes...)>
+{
+    using FVTable = FunctionPrivate::TFunctionVTable<ReturnType, ParamTypes...>;
+
+public:
+    TFunction() = default;
+
+    TFunction(std::nullptr_t)
+    {
+    }
+
+    template <typename FunctorType>
+        requires (!FunctionPrivate::TIsTFunction<std::decay_t<FunctorType>>::value)
+            && std::is_invocable_r_v<ReturnType, std::decay_t<FunctorType>&, ParamTypes...>
+    TFunction(FunctorType&& InFunctor)
+    {
+        using DecayedFunctorType = std::decay_t<FunctorType>;
+
+        if constexpr (std::is_pointer_v<DecayedFunctorType> || std::is_member_pointer_v<DecayedFunctorType>)
+        {
+            if (!InFunctor)
+            {
+                return;
+            }
+        }
+
+        FunctionPrivate::Construct<DecayedFunctorType>(&Storage, std::forward<FunctorType>(InFunctor));
+        VTable = &FunctionPrivate::TFunctionVTableFor<DecayedFunctorType, ReturnType, ParamTypes...>::VTable;
+    }
+
+    TFunction(const TFunction& Other)
+    {
+        if (Other.VTable)
+        {
+            assert(Other.VTable->Copy && "Copy할 수 없는 Functor를 담은 TFunction입니다.");
+            Other.VTable->Copy(&Storage, &Other.Storage);
+            VTable = Other.VTable;
+        }
+    }
+
+    TFunction(TFunction&& Other) noexcept
+    {
+        MoveFrom(Other);
+    }
+
+    TFunction& operator=(const TFunction& Other)
+    {
+        if (this != &Other)
+        {
+            TFunction Copy(Other);
+            Reset();
+            MoveFrom(Copy);
+        }
+        return *this;
+    }
+
+    TFunction& operator=(TFunction&& Other) noexcept
+    {
+        if (this != &Other)
+        {
+            Reset();
+            MoveFrom(Other);
+        }
+        return *this;
+    }
+
+    TFunction& operator=(std::nullptr_t)
+    {
+        Reset();
+        return *this;
+    }
+
+    ~TFunction()
+    {
+        Reset();
+    }
+
+    void Reset()
+    {
+        if (VTable)
+        {
+            VTable->Destroy(&Storage);
+            VTable = nullptr;
+        }
+    }
+
+    bool IsSet() const { return VTable != nullptr; }
+    explicit operator bool() const { return IsSet(); }
+
+    bool operator==(std::nullptr_t) const { return !IsSet(); }
+
+    ReturnType operator()(ParamTypes... Params) const
+    {
+        assert(VTable && "바인딩되지 않은 TFunction을 호출했습니다.");
+        return VTable->Invoke(&Storage, std::forward<ParamTypes>(Params)...);
+    }
+
+private:
+    void MoveFrom(TFunction& Other)
+    {
+        if (Other.VTable)
+        {
+            Other.VTable->Relocate(&Storage, &Other.Storage);
+            VTable = Other.VTable;
+            Other.VTable = nullptr;
+        }
+    }
+
+    struct alignas(FunctionPrivate::InlineAlignment) FStorage
+    {
+        uint8 Bytes[FunctionPrivate::InlineSize];
+    };
+
+    // std::function과 같이 const TFunction으로도 Functor의 operator()를 호출할 수 있음
+    mutable FStorage Storage;
+
+    const FVTable* VTable = nullptr;
+};
+
+
+/**
+ * 호출 가능한 객체를 소유하지 않고 가리키는 참조
+ * 함수 인자로 Callback을 받을 때 사용하며, 할당도 Copy도 없습니다.
+ *
+ * @note 가리키는 객체보다 오래 살아있으면 안 됩니다. 멤버로 저장하지 마세요.
+ */
+template <typename ReturnType, typename... ParamTypes>
+class TFunctionRef<ReturnType(ParamTypes...)>
+{
+public:
+    template <typename FunctorType>
+        requires (!FunctionPrivate::TIsTFunctionRef<std::decay_t<FunctorType>>::value)
+            && std::is_invocable_r_v<ReturnType, FunctorType&, ParamTypes...>
+    TFunctionRef(FunctorType&& InFunctor)
+        : Object(const_cast<void*>(static_cast<const void*>(std::addressof(InFunctor))))
+        , Invoke(&InvokeFunctor<std::remove_reference_t<FunctorType>>)
+    {
+    }
+
+    TFunctionRef(const TFunctionRef&) = default;
+    TFunctionRef& operator=(const TFunctionRef&) = delete;
+
+    ReturnType operator()(ParamTypes... Params) const
+    {
+        return Invoke(Object, std::forward<ParamTypes>(Params)...);
+    }
+
+private:
+    template <typename FunctorType>
+    static ReturnType InvokeFunctor(void* InObject, ParamTypes&&... Params)
+    {
+        return std::invoke(*static_cast<FunctorType*>(InObject), std::forward<ParamTypes>(Params)...);
+    }
+
+    void* Object;
+    ReturnType (*Invoke)(void*, ParamTypes&&...);
+};
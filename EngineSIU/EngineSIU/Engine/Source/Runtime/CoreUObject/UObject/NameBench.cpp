@@ -0,0 +1,143 @@
+#include <cstdio>
+#include <string>
+
+#include "NameTypes.h"
+#include "Async/JobSystem.h"
+#include "Misc/Benchmark.h"
+#include "UserInterface/Console.h"
+
+namespace
+{
+    /**
+     * Job System의 모든 Thread에서 같은 이름들을 서로 다른 순서로 동시에 등록하고,
+     * 모든 Task가 같은 Index를 받았는지, 문자열과 대소문자 비교가 맞는지 확인합니다.
+     */
+    void RunNameStressTest(const FBenchmarkContext& Context)
+    {
+        const int32 NumNames = Context.Count;
+
+        // Main Thread도 ParallelFor에 참여하므로 Worker 수 + 1개의 Task
+        const int32 NumTasks = FJobSystem::Get().GetNumWorkers() + 1;
+
+        const FNamePoolStats StatsBefore = FName::GetNamePoolStats();
+
+        TArray<TArray<FName>> TaskNames;
+        TaskNames.SetNum(NumTasks);
+
+        const double ElapsedMs = MeasureMilliseconds([&]
+        {
+            FJobSystem::Get().ParallelFor(NumTasks, [NumNames, NumTasks, &TaskNames](int32 TaskIndex)
+            {
+                TArray<FName>& Names = TaskNames[TaskIndex];
+                Names.SetNum(NumNames);
+
+                char Buffer[32];
+                const int32 Start = static_cast<int32>(static_cast<int64>(NumNames) * TaskIndex / NumTasks);
+                for (int32 Count = 0; Count < NumNames; ++Count)
+                {
+                    const int32 NameIndex = (Start + Count) % NumNames;
+                    snprintf(Buffer, sizeof(Buffer), "StressName_%d", NameIndex);
+                    Names[NameIndex] = FName(Buffer);
+                }
+            });
+        });
+
+        int32 NumErrors = 0;
+        char Buffer[32];
+        for (int32 NameIndex = 0; NameIndex < NumNames; ++NameIndex)
+        {
+            const FName& Name = TaskNames[0][NameIndex];
+            for (int32 TaskIndex = 1; TaskIndex < NumTasks; ++TaskIndex)
+            {
+                if (TaskNames[TaskIndex][NameIndex].GetDisplayIndex() != Name.GetDisplayIndex())
+                {
+                    ++NumErrors;
+                }
+            }
+
+            snprintf(Buffer, sizeof(Buffer), "StressName_%d", NameIndex);
+            if (Name.ToString() != FString(Buffer))
+            {
+                ++NumErrors;
+            }
+
+            snprintf(Buffer, sizeof(Buffer), "STRESSNAME_%d", NameIndex);
+            if (NameIndex % 64 == 0 && FName(Buffer) != Name)
+            {
+                ++NumErrors;
+            }
+        }
+
+        const FNamePoolStats StatsAfter = FName::GetNamePoolStats();
+        Context.Console.AddLog(
+            NumErrors ? ELogLevel::Error : ELogLevel::Display,
+            "Name stress: %d names x %d tasks (%d workers) in %.2f ms, %d errors",
+            NumNames, NumTasks, FJobSystem::Get().GetNumWorkers(), ElapsedMs, NumErrors
+        );
+        Context.Console.AddLog(ELogLevel::Display, "Added %u names, %.2f MB (see 'name stats')",
+            StatsAfter.NumNames - StatsBefore.NumNames,
+            (StatsAfter.GetTotalBytes() - StatsBefore.GetTotalBytes()) / (1024.0 * 1024.0));
+    }
+
+    /** 이름 생성, 조회, 문자열 변환, 비교에 걸리는 시간을 측정합니다. */
+    void RunNameBenchmark(const FBenchmarkContext& Context)
+    {
+        const int32 NumNames = Context.Count;
+
+        TArray<std::string> Strings;
+        Strings.SetNum(NumNames);
+        for (int32 Index = 0; Index < NumNames; ++Index)
+        {
+            Strings[Index] = "BenchName_" + std::to_string(Index);
+        }
+
+        TArray<FName> Names;
+        Names.SetNum(NumNames);
+
+        auto Measure = [&Context, NumNames](const char* Label, auto&& Body)
+        {
+            Context.Measure(Label, NumNames, [&]
+            {
+                for (int32 Index = 0; Index < NumNames; ++Index)
+                {
+                    Body(Index);
+                }
+            });
+        };
+
+        // 같은 문자열로 두 번 실행하면 처음 한 번만 Pool에 등록됨
+        Measure("FName create", [&](int32 Index) { Names[Index] = FName(Strings[Index].c_str()); });
+        Measure("FName find", [&](int32 Index) { Names[Index] = FName(Strings[Index].c_str()); });
+
+        uint64 Checksum = 0;
+        Measure("ToString", [&](int32 Index) { Checksum += Names[Index].ToString().Len(); });
+
+        FString Buffer;
+        Measure("AppendString", [&](int32 Index)
+        {
+            Buffer.Empty();
+            Names[Index].AppendString(Buffer);
+            Checksum += Buffer.Len();
+        });
+
+        Measure("ToCString", [&](int32 Index)
+        {
+            TCHAR NameBuffer[NAME_SIZE];
+            Checksum += Names[Index].ToCString(NameBuffer)[0];
+        });
+
+        Measure("Compare (FName)", [&](int32 Index) { Checksum += Names[Index] == Names[(Index + 1) % NumNames]; });
+        Measure("Compare (string)", [&](int32 Index) { Checksum += Names[Index] == Strings[Index].c_str(); });
+        Measure("Compare (lexical)", [&](int32 Index) { Checksum += Names[Index].Compare(Names[(Index + 1) % NumNames]) < 0; });
+
+        Context.Console.AddLog(ELogLevel::Display, "Name bench: %d names (checksum %llu)", NumNames, Checksum);
+    }
+
+    FAutoRegisterBenchmark NameStressTest(
+        "name stress", "[count]: Register names concurrently on every job system thread and verify the FName pool", 1000000, &RunNameStressTest
+    );
+
+    FAutoRegisterBenchmark NameBenchmark(
+        "name bench", "[count]: Measure FName create, find, string conversion and compare", 100000, &RunNameBenchmark
+    );
+}
@@ -3,9 +3,11 @@
 #include <assert.h>
 #include <atomic>
 #include <cwchar>
+#include <cwctype>
 #include <mutex>
-#include "Core/Container/Map.h"
+#include "Core/Container/Array.h"
 #include "Core/Container/String.h"
+#include "Misc/Hash.h"
 
 
 enum ENameCase : uint8
@@ -33,13 +35,15 @@ struct FNameStringView
 	bool bIsWide;
 
 	bool IsAnsi() const { return !bIsWide; }
+
+	uint32 GetCharSize() const { return bIsWide ? sizeof(WIDECHAR) : sizeof(ANSICHAR); }
 };
 
 
-/** FName의 Hash값을 담는 클래스, FNameEntry에서 사용 */
+/** Name Pool에 등록된 순서대로 매겨지는 Entry 번호, 0은 "None" */
 struct FNameEntryId
 {
-	uint32 Value = 0;  // 비교 문자열이 있는 해시
+	uint32 Value = 0;
 
 	bool IsNone() const { return !Value; }
 
@@ -66,230 +70,332 @@ struct FNameEntryHeader
 	uint16 Len : 15;   // FName의 길이 0 ~ 32767
 };
 
-
+/**
+ * Name Pool에 저장되는 이름 하나
+ * 문자열은 Entry 바로 뒤에 null 종료 문자열로 이어서 저장되므로, 이름 길이만큼만 메모리를 사용합니다.
+ */
 struct FNameEntry
 {
-	FNameEntryId ComparisonId; // 비교 문자열이 있는 해시
+	FNameEntryId ComparisonId; // 대소문자만 다른 이름 중 처음 등록된 Entry
 	FNameEntryHeader Header;   // Name의 정보
 
-	union
-	{
-		ANSICHAR AnsiName[NAME_SIZE];
-		WIDECHAR WideName[NAME_SIZE];
-	};
+	const ANSICHAR* GetAnsiName() const { return reinterpret_cast<const ANSICHAR*>(this + 1); }
+	const WIDECHAR* GetWideName() const { return reinterpret_cast<const WIDECHAR*>(this + 1); }
 
-	void StoreName(const ANSICHAR* InName, uint32 Len)
-	{
-		memcpy(AnsiName, InName, sizeof(ANSICHAR) * Len);
-		AnsiName[Len] = '\0';
-	}
+	FNameStringView GetView() const { return {this + 1, Header.Len, Header.IsWide != 0}; }
 
-	void StoreName(const WIDECHAR* InName, uint32 Len)
+	/** Entry와 문자열을 합친 크기, 다음 Entry가 정렬되도록 맞춤 */
+	static uint32 GetAllocSize(const FNameStringView& Name)
 	{
-		memcpy(WideName, InName, sizeof(WIDECHAR) * Len);
-		WideName[Len] = '\0';
+		const uint32 Size = sizeof(FNameEntry) + (Name.Len + 1) * Name.GetCharSize();
+		return (Size + alignof(FNameEntry) - 1) & ~static_cast<uint32>(alignof(FNameEntry) - 1);
 	}
 };
 
 namespace
 {
-template <typename CharType>
-uint32 HashString(const CharType* Str)
+template <ENameCase Sensitivity>
+FORCEINLINE uint32 NormalizeChar(ANSICHAR Char)
+{
+	const uint32 Code = static_cast<uint8>(Char);
+	return Sensitivity == IgnoreCase ? static_cast<uint32>(tolower(static_cast<int>(Code))) : Code;
+}
+
+template <ENameCase Sensitivity>
+FORCEINLINE uint32 NormalizeChar(WIDECHAR Char)
+{
+	return Sensitivity == IgnoreCase ? static_cast<uint32>(towlower(Char)) : static_cast<uint32>(Char);
+}
+
+/** 문자 단위 FNV-1a, Ansi와 Wide로 저장된 같은 문자열은 같은 Hash가 나옴 */
+template <ENameCase Sensitivity, typename CharType>
+uint64 HashChars(const CharType* Str, uint32 Len)
 {
-	// djb2 문자열 해싱 알고리즘
-	uint32 Hash = 5381;
-	while (*Str)
+	uint64 Hash = FHash::Fnv1a64Offset;
+	for (uint32 i = 0; i < Len; ++i)
 	{
-		Hash = ((Hash << 5) + Hash) + *Str;
-		++Str;
+		Hash ^= NormalizeChar<Sensitivity>(Str[i]);
+		Hash *= FHash::Fnv1a64Prime;
 	}
 	return Hash;
 }
 
-template <typename CharType>
-uint32 HashStringLower(const CharType* Str, uint32 InLen)
+template <ENameCase Sensitivity>
+uint64 HashName(const FNameStringView& InName)
+{
+	return InName.IsAnsi() ? HashChars<Sensitivity>(InName.Ansi, InName.Len) : HashChars<Sensitivity>(InName.Wide, InName.Len);
+}
+
+template <ENameCase Sensitivity, typename CharTypeA, typename CharTypeB>
+bool EqualsChars(const CharTypeA* A, const CharTypeB* B, uint32 Len)
 {
-	CharType LowerStr[NAME_SIZE];
-	if constexpr (std::is_same_v<CharType, wchar_t>)
+	if constexpr (Sensitivity == CaseSensitive && std::is_same_v<CharTypeA, CharTypeB>)
 	{
-		for (uint32 i = 0; i < InLen; i++)
-		{
-			LowerStr[i] = towlower(Str[i]);
-		}
-		LowerStr[InLen] = '\0';
+		return memcmp(A, B, Len * sizeof(CharTypeA)) == 0;
 	}
 	else
 	{
-		for (uint32 i = 0; i < InLen; ++i)
+		for (uint32 i = 0; i < Len; ++i)
 		{
-			LowerStr[i] = static_cast<CharType>(tolower(Str[i]));
+			if (NormalizeChar<Sensitivity>(A[i]) != NormalizeChar<Sensitivity>(B[i]))
+			{
+				return false;
+			}
 		}
-		LowerStr[InLen] = '\0';
+		return true;
 	}
-	return HashString(LowerStr);
 }
 
 template <ENameCase Sensitivity>
-uint32 HashName(FNameStringView InName);
+bool EqualsName(const FNameStringView& A, const FNameStringView& B)
+{
+	if (A.Len != B.Len)
+	{
+		return false;
+	}
+
+	if (A.IsAnsi())
+	{
+		return B.IsAnsi() ? EqualsChars<Sensitivity>(A.Ansi, B.Ansi, A.Len) : EqualsChars<Sensitivity>(A.Ansi, B.Wide, A.Len);
+	}
+	return B.IsAnsi() ? EqualsChars<Sensitivity>(A.Wide, B.Ansi, A.Len) : EqualsChars<Sensitivity>(A.Wide, B.Wide, A.Len);
+}
 
-template <>
-uint32 HashName<IgnoreCase>(FNameStringView InName)
+/** 대소문자를 무시한 사전순 비교, 소문자로 바꾼 임시 문자열 없이 문자 단위로 비교 */
+template <typename CharTypeA, typename CharTypeB>
+int32 CompareCharsIgnoreCase(const CharTypeA* A, uint32 LenA, const CharTypeB* B, uint32 LenB)
 {
-	return InName.IsAnsi() ? HashStringLower(InName.Ansi, InName.Len) : HashStringLower(InName.Wide, InName.Len);
+	const uint32 MinLen = LenA < LenB ? LenA : LenB;
+	for (uint32 i = 0; i < MinLen; ++i)
+	{
+		const uint32 CharA = NormalizeChar<IgnoreCase>(A[i]);
+		const uint32 CharB = NormalizeChar<IgnoreCase>(B[i]);
+		if (CharA != CharB)
+		{
+			return CharA < CharB ? -1 : 1;
+		}
+	}
+	return LenA == LenB ? 0 : (LenA < LenB ? -1 : 1);
 }
 
-template <>
-uint32 HashName<CaseSensitive>(FNameStringView InName)
+int32 CompareNameIgnoreCase(const FNameStringView& A, const FNameStringView& B)
 {
-	return InName.IsAnsi() ? HashString(InName.Ansi) : HashString(InName.Wide);
+	if (A.IsAnsi())
+	{
+		return B.IsAnsi() ? CompareCharsIgnoreCase(A.Ansi, A.Len, B.Ansi, B.Len) : CompareCharsIgnoreCase(A.Ansi, A.Len, B.Wide, B.Len);
+	}
+	return B.IsAnsi() ? CompareCharsIgnoreCase(A.Wide, A.Len, B.Ansi, B.Len) : CompareCharsIgnoreCase(A.Wide, A.Len, B.Wide, B.Len);
 }
 }
 
-template <ENameCase Sensitivity>
-struct FNameValue
+
+/**
+ * Entry를 큰 Block에 이어서 할당하고, Entry 번호로 Entry를 찾는 Index 표를 관리합니다.
+ *
+ * 할당은 Lock 안에서 하지만, Resolve는 Lock 없이 읽습니다.
+ * Entry와 Index 표의 Chunk는 한 번 쓰이면 바뀌거나 해제되지 않고, release로 공개한 뒤 acquire로 읽습니다.
+ * 다른 Static 객체의 소멸자에서도 FName을 쓸 수 있도록, 프로그램이 끝날 때까지 해제하지 않습니다.
+ */
+class FNameEntryAllocator
 {
-	explicit FNameValue(FNameStringView InName)
-		: Name(InName)
-		, Hash(HashName<Sensitivity>(InName))
-	{}
+public:
+	static constexpr uint32 BlockSize = 64 * 1024;
 
-	FNameStringView Name;
-	uint32 Hash;
-	FNameEntryId ComparisonId = {};
-};
+	static constexpr uint32 ChunkBits = 16;
+	static constexpr uint32 ChunkSize = 1u << ChunkBits;
 
-using FNameComparisonValue = FNameValue<IgnoreCase>;
-using FNameDisplayValue = FNameValue<CaseSensitive>;
+	// 최대 Entry 수는 MaxChunks * ChunkSize (64M)
+	static constexpr uint32 MaxChunks = 1024;
 
-/** Open Addressing을 이용한 커스텀 Hash Set 이었는데, Hash 충돌 문제로 사용 못함 */
-#pragma region Deprecated Pool Shard
-#if 0  // NOLINT(readability-avoid-unconditional-preprocessor-if)
-template <ENameCase Sensitivity>
-class FNamePoolShard
-{
-	template <typename T>
-	using Vec = std::vector<T, FDefaultAllocator<T>>;
+	static_assert(sizeof(FNameEntry) + NAME_SIZE * sizeof(WIDECHAR) <= BlockSize);
 
-	// 요소 상태를 나타내는 enum
-	enum class ESlotState : uint8
+	/**
+	 * 새 Entry를 만들고 Index 표에 공개합니다.
+	 * @param ComparisonId nullptr이면 새 Entry가 자기 자신의 Comparison Entry가 됨
+	 */
+	FNameEntryId Allocate(const FNameStringView& Name, const FNameEntryId* ComparisonId)
 	{
-		Empty,    // 비어있는 슬롯
-		Occupied, // 사용 중인 슬롯
-		Deleted   // 삭제된 슬롯
-	};
+		std::lock_guard Lock(Mutex);
 
-	// 슬롯 구조체
-	struct FSlot
-	{
-		FNameEntry Value;   // 저장된 값
-		ESlotState State;    // 슬롯의 상태
+		const uint32 Id = NumEntries.load(std::memory_order_relaxed);
+		const uint32 ChunkIndex = Id >> ChunkBits;
+		assert(ChunkIndex < MaxChunks);
 
-		FSlot()
-			: Value()
-			, State(ESlotState::Empty)
+		const uint32 Size = FNameEntry::GetAllocSize(Name);
+		if (!CurrentBlock || BlockOffset + Size > BlockSize)
 		{
+			CurrentBlock = static_cast<uint8*>(::operator new(BlockSize));
+			BlockOffset = 0;
+			NumBlocks.fetch_add(1, std::memory_order_relaxed);
 		}
 
-		bool Used() const
-		{
-			return State == ESlotState::Occupied;
-		}
+		FNameEntry* Entry = new (CurrentBlock + BlockOffset) FNameEntry;
+		BlockOffset += Size;
+		EntryBytes.fetch_add(Size, std::memory_order_relaxed);
+
+		Entry->ComparisonId = ComparisonId ? *ComparisonId : FNameEntryId{Id};
+		Entry->Header = {
+			.IsWide = Name.bIsWide,
+			.Len = static_cast<uint16>(Name.Len)
+		};
+
+		uint8* Chars = reinterpret_cast<uint8*>(Entry + 1);
+		memcpy(Chars, Name.Data, Name.Len * Name.GetCharSize());
+		memset(Chars + Name.Len * Name.GetCharSize(), 0, Name.GetCharSize());
 
-		void SetValue(const FNameEntry& InValue)
+		std::atomic<const FNameEntry*>* Chunk = Chunks[ChunkIndex].load(std::memory_order_relaxed);
+		if (!Chunk)
 		{
-			Value = InValue;
-			State = ESlotState::Occupied;
+			Chunk = new std::atomic<const FNameEntry*>[ChunkSize]();
+			Chunks[ChunkIndex].store(Chunk, std::memory_order_release);
+			NumChunks.fetch_add(1, std::memory_order_relaxed);
 		}
-	};
+		Chunk[Id & (ChunkSize - 1)].store(Entry, std::memory_order_release);
+		NumEntries.store(Id + 1, std::memory_order_release);
 
-private:
-	mutable Vec<FSlot> Slots;
-	std::atomic<uint32> ElementCount; // 총 요소 개수
-	float MaxLoadFactorValue;        // 최대 부하 계수
-
-	mutable std::mutex Mutex;
+		return {Id};
+	}
 
-	// 해시 테이블 리사이징 및 리해싱
-	void Rehash(uint32 NewCapacity)
+	/** Lock 없이 Entry를 읽습니다. Id는 이 Pool이 돌려준 값이어야 함 */
+	const FNameEntry* Resolve(FNameEntryId Id) const
 	{
-		Vec<FSlot> OldSlots = std::move(Slots);
-		Slots.clear();
-		Slots.resize(NewCapacity);
-
-		ElementCount = 0;
-		for (const auto& Slot : OldSlots)
-		{
-			if (Slot.State == ESlotState::Occupied)
-			{
-				Slots[Slot.Value.ComparisonId.Value & Slots.size()] = Slot;
-			}
-		}
+		const std::atomic<const FNameEntry*>* Chunk = Chunks[Id.Value >> ChunkBits].load(std::memory_order_acquire);
+		return Chunk[Id.Value & (ChunkSize - 1)].load(std::memory_order_acquire);
 	}
 
-public:
-	FNamePoolShard(int32 InitCapacity = 1024, float InMaxLoadFactor = 0.75f)
-		: Slots(InitCapacity)
-		, ElementCount(0)
-		, MaxLoadFactorValue(InMaxLoadFactor)
+	/** Lock 없이 통계용 Counter를 읽으므로, 등록 중인 이름은 일부 값에만 반영될 수 있음 */
+	void GetStats(FNamePoolStats& OutStats) const
 	{
+		OutStats.NumNames = NumEntries.load(std::memory_order_relaxed);
+		OutStats.EntryBytes = EntryBytes.load(std::memory_order_relaxed);
+		OutStats.BlockBytes = static_cast<uint64>(NumBlocks.load(std::memory_order_relaxed)) * BlockSize;
+		OutStats.IndexBytes = static_cast<uint64>(NumChunks.load(std::memory_order_relaxed)) * ChunkSize * sizeof(std::atomic<const FNameEntry*>);
 	}
 
-	FSlot& Probe(uint32 InHash) const
+private:
+	std::mutex Mutex;
+
+	std::atomic<std::atomic<const FNameEntry*>*> Chunks[MaxChunks] = {};
+	std::atomic<uint32> NumEntries = 0;
+
+	uint8* CurrentBlock = nullptr;
+	uint32 BlockOffset = 0;
+
+	// 통계용, Lock 안에서만 쓰고 GetStats에서 Lock 없이 읽음
+	std::atomic<uint32> NumBlocks = 0;
+	std::atomic<uint32> NumChunks = 0;
+	std::atomic<uint64> EntryBytes = 0;
+};
+
+
+/**
+ * 이름 Hash로 나눈 Open Addressing Hash 표 하나
+ *
+ * Slot에는 Entry 번호와 Hash 하위 32Bit만 저장하고, Hash가 같으면 실제 문자열을 비교해서 충돌을 구분합니다.
+ * GetAllocatedBytes를 뺀 모든 함수는 GetMutex()를 잡은 상태에서 호출합니다.
+ */
+template <ENameCase Sensitivity>
+class FNamePoolShard
+{
+	static constexpr uint32 EmptyId = ~0u;
+	static constexpr int32 InitialCapacity = 256;
+
+	struct FSlot
+	{
+		uint32 Id = EmptyId;
+		uint32 Hash = 0;
+	};
+
+public:
+	FNamePoolShard()
 	{
-		return Slots[InHash & Slots.size()-1];
+		Slots.SetNum(InitialCapacity);
+		Capacity.store(InitialCapacity, std::memory_order_relaxed);
 	}
 
-	FNameEntryId Find(const FNameValue<Sensitivity>& Value) const
+	std::mutex& GetMutex() const { return Mutex; }
+
+	bool Find(const FNameStringView& Name, uint32 Hash, const FNameEntryAllocator& Entries, FNameEntryId& OutId) const
 	{
-		FNameEntryId Result;
+		const uint32 Mask = Slots.Num() - 1;
+		for (uint32 Index = Hash & Mask; ; Index = (Index + 1) & Mask)
 		{
-			std::lock_guard _(Mutex);
+			const FSlot& Slot = Slots[Index];
+			if (Slot.Id == EmptyId)
+			{
+				return false;
+			}
 
-			const FSlot& Slot = Probe(Value.Hash);
-			Result = Slot.Value.ComparisonId;
+			if (Slot.Hash == Hash && EqualsName<Sensitivity>(Entries.Resolve({Slot.Id})->GetView(), Name))
+			{
+				OutId = {Slot.Id};
+				return true;
+			}
 		}
-		return Result;
 	}
 
-	FNameEntryId Insert(const FNameValue<Sensitivity>& Value)
+	/** 같은 이름이 없는 것을 Find로 확인한 뒤에 호출 */
+	void Insert(uint32 Hash, FNameEntryId Id)
 	{
-		// 부하 계수 확인 및 필요시 리해싱
-		if (ElementCount >= Slots.size() * MaxLoadFactorValue)
+		// Load Factor 0.75를 넘으면 두 배로 늘림
+		if ((NumUsed + 1) * 4 > static_cast<uint32>(Slots.Num()) * 3)
 		{
-			Rehash(Slots.size() * 2);
+			Grow();
 		}
+		InsertUnchecked(Hash, Id.Value);
+		++NumUsed;
+	}
 
-		std::lock_guard _(Mutex);
-		FSlot& Slot = Probe(Value.Hash);
+	/** Lock 없이 읽을 수 있음 */
+	uint64 GetAllocatedBytes() const
+	{
+		return static_cast<uint64>(Capacity.load(std::memory_order_relaxed)) * sizeof(FSlot);
+	}
 
-		if (Slot.Used())
+private:
+	void InsertUnchecked(uint32 Hash, uint32 Id)
+	{
+		const uint32 Mask = Slots.Num() - 1;
+		uint32 Index = Hash & Mask;
+		while (Slots[Index].Id != EmptyId)
 		{
-			return Slot.Value.ComparisonId;
+			Index = (Index + 1) & Mask;
 		}
+		Slots[Index] = {Id, Hash};
+	}
 
-		// 요소 삽입
-		FNameEntry Entry;
-		Entry.ComparisonId = Value.ComparisonId;
-		Entry.Header = {
-			.IsWide = Value.Name.bIsWide,
-			.Len = static_cast<uint16>(Value.Name.Len)
-		};
-		if (Value.Name.bIsWide)
-		{
-			Entry.StoreName(Value.Name.Wide, Value.Name.Len);
-		}
-		else
+	void Grow()
+	{
+		TArray<FSlot> OldSlots = std::move(Slots);
+		Slots.Empty();
+		Slots.SetNum(OldSlots.Num() * 2);
+		Capacity.store(Slots.Num(), std::memory_order_relaxed);
+
+		for (const FSlot& Slot : OldSlots)
 		{
-			Entry.StoreName(Value.Name.Ansi, Value.Name.Len);
+			if (Slot.Id != EmptyId)
+			{
+				InsertUnchecked(Slot.Hash, Slot.Id);
+			}
 		}
-		Slot.SetValue(Entry);
-		ElementCount.fetch_add(1, std::memory_order_relaxed);
-		return {Value.Hash};
 	}
+
+	mutable std::mutex Mutex;
+	TArray<FSlot> Slots;
+	uint32 NumUsed = 0;
+
+	// 통계용 Slots.Num(), GetStats가 Shard마다 Lock을 잡지 않도록 따로 둠
+	std::atomic<uint32> Capacity = 0;
 };
-#endif
-#pragma endregion Deprecated Pool Shard
 
+
+/**
+ * FName의 문자열을 저장하는 Pool
+ *
+ * Display 표(대소문자 구분)와 Comparison 표(대소문자 무시)는 각각 Hash 상위 Bit로 Shard를 나눠서,
+ * 서로 다른 Shard에 등록하는 Thread끼리는 기다리지 않습니다.
+ * 문자열 조회(ToString)는 Entry 번호로 Index 표를 읽기만 하므로 Lock이 없습니다.
+ */
 struct FNamePool
 {
 public:
@@ -299,66 +405,89 @@ public:
         return Instance;
     }
 
-private:
-	// FNamePoolShard<CaseSensitive> DisplayPool;
-	// FNamePoolShard<IgnoreCase> ComparisonPool;
-
-	TMap<uint32, FNameEntry> DisplayPool;
-	TMap<uint32, FNameEntry> ComparisonPool;
+	static constexpr uint32 ShardBits = 6;
+	static constexpr uint32 NumShards = 1u << ShardBits;
 
-private:
-	template <ENameCase Sensitivity>
-	FNameEntry MakeEntry(const FNameValue<Sensitivity>& Value) const
-	{
-		FNameEntry Result;
-		Result.ComparisonId = Value.ComparisonId;
-		Result.Header = {
-			.IsWide = Value.Name.bIsWide,
-			.Len = static_cast<uint16>(Value.Name.Len)
-		};
-		if (Value.Name.bIsWide)
-		{
-			Result.StoreName(Value.Name.Wide, Value.Name.Len);
-		}
-		else
-		{
-			Result.StoreName(Value.Name.Ansi, Value.Name.Len);
-		}
-		return Result;
+	FNamePool()
+	{
+		// 0번 Entry를 "None"으로 만들어서 FName("None") == NAME_None이 되게 함
+		const FNameEntryId NoneId = FindOrStoreString({"None", 4});
+		assert(NoneId.IsNone());
 	}
 
-public:
-	/** Hash로 원본 문자열을 가져옵니다. */
-	FNameEntry Resolve(uint32 Hash) const
+	/** Entry 번호로 원본 문자열을 가져옵니다. */
+	const FNameEntry* Resolve(FNameEntryId Id) const
 	{
-		return *DisplayPool.Find(Hash);
+		return Entries.Resolve(Id);
 	}
 
 	/**
-	 * 문자열을 찾거나, 없으면 Hash화 해서 저장합니다.
+	 * 문자열을 찾거나, 없으면 새 Entry로 저장합니다.
 	 *
-	 * @return DisplayName의 Hash
+	 * @return DisplayName의 Entry 번호
 	 */
 	FNameEntryId FindOrStoreString(const FNameStringView& Name)
 	{
-		// DisplayPool에 같은 문자열이 있다면, 문자열의 Hash 반환
-		FNameDisplayValue DisplayValue{Name};
-		if (DisplayPool.Find(DisplayValue.Hash))
+		const uint64 DisplayHash = HashName<CaseSensitive>(Name);
+		FNamePoolShard<CaseSensitive>& DisplayShard = DisplayShards[GetShardIndex(DisplayHash)];
+
+		// Lock 순서는 항상 Display -> Comparison
+		std::lock_guard DisplayLock(DisplayShard.GetMutex());
+
+		FNameEntryId DisplayId;
+		if (DisplayShard.Find(Name, static_cast<uint32>(DisplayHash), Entries, DisplayId))
+		{
+			return DisplayId;
+		}
+
+		const uint64 ComparisonHash = HashName<IgnoreCase>(Name);
+		FNamePoolShard<IgnoreCase>& ComparisonShard = ComparisonShards[GetShardIndex(ComparisonHash)];
 		{
-			return {DisplayValue.Hash};
+			std::lock_guard ComparisonLock(ComparisonShard.GetMutex());
+
+			// 대소문자만 다른 이름이 이미 있으면 그 Entry를 비교 기준으로 사용
+			FNameEntryId ComparisonId;
+			if (ComparisonShard.Find(Name, static_cast<uint32>(ComparisonHash), Entries, ComparisonId))
+			{
+				DisplayId = Entries.Allocate(Name, &ComparisonId);
+			}
+			else
+			{
+				DisplayId = Entries.Allocate(Name, nullptr);
+				ComparisonShard.Insert(static_cast<uint32>(ComparisonHash), DisplayId);
+			}
 		}
 
-		const FNameComparisonValue ComparisonValue{Name};
-		if (!ComparisonPool.Find(ComparisonValue.Hash))
+		DisplayShard.Insert(static_cast<uint32>(DisplayHash), DisplayId);
+		return DisplayId;
+	}
+
+	FNamePoolStats GetStats() const
+	{
+		FNamePoolStats Stats;
+		Entries.GetStats(Stats);
+
+		for (const FNamePoolShard<CaseSensitive>& Shard : DisplayShards)
+		{
+			Stats.HashTableBytes += Shard.GetAllocatedBytes();
+		}
+		for (const FNamePoolShard<IgnoreCase>& Shard : ComparisonShards)
 		{
-			const FNameEntry Entry = MakeEntry(ComparisonValue);
-			ComparisonPool.Add(ComparisonValue.Hash, Entry);
+			Stats.HashTableBytes += Shard.GetAllocatedBytes();
 		}
+		return Stats;
+	}
 
-		DisplayValue.ComparisonId = {ComparisonValue.Hash};
-		DisplayPool.Add(DisplayValue.Hash, MakeEntry(DisplayValue));
-		return {DisplayValue.Hash};
+private:
+	static uint32 GetShardIndex(uint64 Hash)
+	{
+		// Shard 안의 Slot은 하위 Bit를 쓰므로, Shard는 상위 Bit로 고름
+		return static_cast<uint32>(Hash >> (64 - ShardBits));
 	}
+
+	FNameEntryAllocator Entries;
+	FNamePoolShard<CaseSensitive> DisplayShards[NumShards];
+	FNamePoolShard<IgnoreCase> ComparisonShards[NumShards];
 };
 
 struct FNameHelper
@@ -391,22 +520,20 @@ struct FNameHelper
 			return {};
 		}
 
-		const FNameEntryId DisplayId = FNamePool::Get().FindOrStoreString({Char, Len});
+		// 빈 문자열은 None
+		if (Len == 0)
+		{
+			return {};
+		}
+
+		FNamePool& Pool = FNamePool::Get();
+		const FNameEntryId DisplayId = Pool.FindOrStoreString({Char, Len});
 
 		FName Result;
 		Result.DisplayIndex = DisplayId.Value;
-		Result.ComparisonIndex = ResolveComparisonId(DisplayId).Value;
+		Result.ComparisonIndex = Pool.Resolve(DisplayId)->ComparisonId.Value;
 		return Result;
 	}
-
-	static FNameEntryId ResolveComparisonId(FNameEntryId DisplayId)
-	{
-		if (DisplayId.IsNone())
-		{
-			return {};
-		}
-		return FNamePool::Get().Resolve(DisplayId.Value).ComparisonId;
-	}
 };
 
 #if defined(_DEBUG)
@@ -429,23 +556,74 @@ FName::FName(const FString& Name)
 {
 }
 
+FName::FName(const WIDECHAR* Name, uint32 Len)
+	: FName(FNameHelper::MakeFName(Name, Len))
+{
+}
+
+FName::FName(const ANSICHAR* Name, uint32 Len)
+	: FName(FNameHelper::MakeFName(Name, Len))
+{
+}
+
 FString FName::ToString() const
 {
-	if (DisplayIndex == 0 && ComparisonIndex == 0)
+	FString Result;
+	AppendString(Result);
+	return Result;
+}
+
+FNameView FName::GetView() const
+{
+	// 0번 Entry가 "None"이므로 None도 그대로 읽음
+	const FNameEntry* Entry = FNamePool::Get().Resolve({DisplayIndex});
+	return {Entry + 1, Entry->Header.Len, Entry->Header.IsWide != 0};
+}
+
+void FName::AppendString(FString& Out) const
+{
+	const FNameView View = GetView();
+	if (View.IsWide() == static_cast<bool>(USE_WIDECHAR))
+	{
+		Out.Append(static_cast<const TCHAR*>(View.Data), static_cast<int32>(View.Len));
+	}
+	else
 	{
-		return {TEXT("None")};
+		// 문자 크기가 다르면 FString의 변환을 사용
+		Out += View.IsWide() ? FString(View.GetWide()) : FString(View.GetAnsi());
 	}
+}
 
-	// TODO: WIDECHAR에 대응 해야함
-	FNameEntry Entry = FNamePool::Get().Resolve(DisplayIndex);
-    if (Entry.Header.IsWide)
-    {
-        return {Entry.WideName};
-    }
-    else
-    {
-        return {Entry.AnsiName};
-    }
+const TCHAR* FName::ToCString(TCHAR (&Buffer)[NAME_SIZE]) const
+{
+	const FNameView View = GetView();
+	if (View.IsWide() == static_cast<bool>(USE_WIDECHAR))
+	{
+		return static_cast<const TCHAR*>(View.Data);
+	}
+
+	const FString Converted = View.IsWide() ? FString(View.GetWide()) : FString(View.GetAnsi());
+	const uint32 Len = static_cast<uint32>(Converted.Len()) < NAME_SIZE ? static_cast<uint32>(Converted.Len()) : NAME_SIZE - 1;
+	memcpy(Buffer, *Converted, Len * sizeof(TCHAR));
+	Buffer[Len] = TEXT('\0');
+	return Buffer;
+}
+
+int32 FName::Compare(const FName& Other) const
+{
+	if (ComparisonIndex == Other.ComparisonIndex)
+	{
+		return 0;
+	}
+
+	const FNameView A = GetView();
+	const FNameView B = Other.GetView();
+	return CompareNameIgnoreCase({A.Data, A.Len, A.bIsWide}, {B.Data, B.Len, B.bIsWide});
+}
+
+FNamePoolStats FName::GetNamePoolStats()
+{
+	return FNamePool::Get().GetStats();
 }
 
 bool FName::operator==(const FName& Other) const
@@ -467,3 +645,26 @@ bool FName::operator!=(const FName& Other) const
 {
     return ComparisonIndex != Other.ComparisonIndex;
 }
+
+bool FName::operator==(const ANSICHAR* Other) const
+{
+	// FName("")은 None
+	if (!Other || !*Other)
+	{
+		return ComparisonIndex == NAME_None;
+	}
+
+	const FNameView View = GetView();
+	return EqualsName<IgnoreCase>({View.Data, View.Len, View.bIsWide}, {Other, static_cast<uint32>(strlen(Other))});
+}
+
+bool FName::operator==(const WIDECHAR* Other) const
+{
+	if (!Other || !*Other)
+	{
+		return ComparisonIndex == NAME_None;
+	}
+
+	const FNameView View = GetView();
+	return EqualsName<IgnoreCase>({View.Data, View.Len, View.bIsWide}, {Other, static_cast<uint32>(wcslen(Other))});
+}
@@ -1,5 +1,6 @@
 ﻿#pragma once
 #include "Core/HAL/PlatformType.h"
+#include "Core/Container/StringView.h"
 
 class FString;
 
@@ -8,12 +9,47 @@ enum ENameNone : uint8 { NAME_None = 0 };
 /** Maximum size of name, including the null terminator. */
 enum : uint16 { NAME_SIZE = 256 };
 
+/**
+ * Name Pool에 저장된 문자열을 복사 없이 가리키는 View
+ * Pool의 문자열은 null 종료 문자열이고 프로그램이 끝날 때까지 유지됩니다.
+ */
+struct FNameView
+{
+    const void* Data = nullptr;
+    uint32 Len = 0;
+    bool bIsWide = false;
+
+    bool IsWide() const { return bIsWide; }
+    const ANSICHAR* GetAnsi() const { return bIsWide ? nullptr : static_cast<const ANSICHAR*>(Data); }
+    const WIDECHAR* GetWide() const { return bIsWide ? static_cast<const WIDECHAR*>(Data) : nullptr; }
+};
+
+/** Name Pool의 메모리 사용량 */
+struct FNamePoolStats
+{
+    uint32 NumNames = 0;
+
+    // Entry와 문자열이 실제로 차지하는 크기
+    uint64 EntryBytes = 0;
+
+    // Entry를 담는 Block 전체 크기
+    uint64 BlockBytes = 0;
+
+    // Display, Comparison Hash 표 크기
+    uint64 HashTableBytes = 0;
+
+    // Entry 번호 -> Entry 표 크기
+    uint64 IndexBytes = 0;
+
+    uint64 GetTotalBytes() const { return BlockBytes + HashTableBytes + IndexBytes; }
+};
+
 class FName
 {
     friend struct FNameHelper;
 
-    uint32 DisplayIndex;    // 원본 문자열의 Hash
-    uint32 ComparisonIndex; // 비교시 사용되는 Hash
+    uint32 DisplayIndex;    // 원본 문자열의 Entry 번호
+    uint32 ComparisonIndex; // 비교시 사용되는 Entry 번호, 대소문자만 다른 이름끼리 같음
 
 public:
     FName() : DisplayIndex(NAME_None), ComparisonIndex(NAME_None) {}
@@ -21,15 +57,45 @@ public:
     FName(const WIDECHAR* Name);
     FName(const ANSICHAR* Name);
     FName(const FString& Name);
+    FName(const WIDECHAR* Name, uint32 Len);
+    FName(const ANSICHAR* Name, uint32 Len);
+
+    // null 종료가 아닌 부분 문자열도 복사 없이 찾거나 등록
+    FName(FWideStringView Name) : FName(Name.GetData(), static_cast<uint32>(Name.Len())) {}
+    FName(FAnsiStringView Name) : FName(Name.GetData(), static_cast<uint32>(Name.Len())) {}
 
     FString ToString() const;
+
+    /** Pool의 문자열을 할당 없이 가리킵니다. None이면 "None" */
+    FNameView GetView() const;
+
+    /** 임시 FString 없이 Out 뒤에 이름을 붙입니다. */
+    void AppendString(FString& Out) const;
+
+    /**
+     * null 종료 TCHAR 문자열을 할당 없이 가져옵니다.
+     * Pool의 문자 크기가 TCHAR와 같으면 Pool의 문자열을 그대로 반환하고, 다르면 Buffer에 변환해서 반환합니다.
+     */
+    const TCHAR* ToCString(TCHAR (&Buffer)[NAME_SIZE]) const;
+
+    /** 대소문자를 무시한 사전순 비교, 같은 이름이면 문자열을 비교하지 않음 */
+    int32 Compare(const FName& Other) const;
+
     uint32 GetDisplayIndex() const { return DisplayIndex; }
     uint32 GetComparisonIndex() const { return ComparisonIndex; }
 
+    static FNamePoolStats GetNamePoolStats();
+
     bool operator==(const FName& Other) const;
     bool operator==(ENameNone) const;
     bool operator!=(const FName& Other) const;
     bool operator!=(ENameNone) const;
+
+    // 문자열과 대소문자를 무시하고 비교, Pool에 새 이름을 등록하지 않음
+    bool operator==(const ANSICHAR* Other) const;
+    bool operator==(const WIDECHAR* Other) const;
+    bool operator!=(const ANSICHAR* Other) const { return !(*this == Other); }
+    bool operator!=(const WIDECHAR* Other) const { return !(*this == Other); }
 };
 
 template<>
@@ -1,7 +1,9 @@
 #include "Object.h"
+#include <utility>
 
 #include "ObjectFactory.h"
 #include "Class.h"
+#include "UObjectArray.h"
 #include "Engine/Engine.h"
 
 
@@ -22,12 +24,22 @@ UClass* UObject::StaticClass()
     return &ClassInfo;
 }
 
+thread_local const FObjectConstructionParams* UObject::ConstructionParams = nullptr;
+
 UObject::UObject()
     : UUID(0)
-    // TODO: Object를 생성할 때 직접 설정하기
-    , InternalIndex(-1)
+    , InternalIndex(INDEX_NONE) // GUObjectArray.AddObject에서 설정
     , NamePrivate("None")
 {
+    // 자식 Class의 생성자보다 먼저 등록, 생성자 안에서 다시 ConstructObject를 호출할 수 있도록 바로 비움
+    if (const FObjectConstructionParams* Params = std::exchange(ConstructionParams, nullptr))
+    {
+        ClassPrivate = Params->Class;
+        NamePrivate = Params->Name;
+        UUID = Params->UUID;
+        OuterPrivate = Params->Outer;
+        GUObjectArray.AddObject(this);
+    }
 }
 
 UObject* UObject::Duplicate(UObject* InOuter)
@@ -9,6 +9,15 @@ class UClass;
 class UWorld;
 class AActor;
 
+/** FObjectFactory가 ClassCTOR를 호출하는 동안 UObject 생성자에 넘기는, 생성할 Object의 정보 */
+struct FObjectConstructionParams
+{
+    UClass* Class;
+    UObject* Outer;
+    FName Name;
+    uint32 UUID;
+};
+
 class UObject
 {
     friend class AActor;
@@ -27,15 +36,22 @@ public:
 private:
     friend class FObjectFactory;
     friend class FSceneMgr;
+    friend class FUObjectArray;
     friend class UClass;
 
     uint32 UUID;
-    uint32 InternalIndex; // Index of GUObjectArray
+    int32 InternalIndex; // Index of GUObjectArray
 
     FName NamePrivate;
     UClass* ClassPrivate = nullptr;
     UObject* OuterPrivate = nullptr;
 
+    /**
+     * FObjectFactory::ConstructObject가 ClassCTOR를 호출하는 동안만 설정됩니다.
+     * UObject 생성자가 이 값으로 자신을 GUObjectArray에 등록하므로, 자식 Class의 생성자에서도 Weak Pointer를 만들 수 있습니다.
+     */
+    static thread_local const FObjectConstructionParams* ConstructionParams;
+
     
     // FName을 키값으로 넣어주는 컨테이너를 모두 업데이트 해야합니다.
     void SetFName(const FName& InName) { NamePrivate = InName; }
@@ -55,7 +71,7 @@ public:
 
 
     uint32 GetUUID() const { return UUID; }
-    uint32 GetInternalIndex() const { return InternalIndex; }
+    int32 GetInternalIndex() const { return InternalIndex; }
 
     UClass* GetClass() const { return ClassPrivate; }
 
@@ -73,10 +89,11 @@ public:
 public:
     void* operator new(size_t size)
     {
-        UE_LOG(ELogLevel::Display, "UObject Created : %d", size);
+        UE_LOG_CATEGORY(LogObject, ELogLevel::Display, "UObject Created : %d", size);
 
         void* RawMemory = FPlatformMemory::Malloc<EAT_Object>(size);
-        UE_LOG(
+        UE_LOG_CATEGORY(
+            LogObject,
             ELogLevel::Display,
             "TotalAllocationBytes : %d, TotalAllocationCount : %d",
             FPlatformMemory::GetAllocationBytes<EAT_Object>(),
@@ -87,7 +104,7 @@ public:
 
     void operator delete(void* ptr, size_t size)
     {
-        UE_LOG(ELogLevel::Display, "UObject Deleted : %d", size);
+        UE_LOG_CATEGORY(LogObject, ELogLevel::Display, "UObject Deleted : %d", size);
         FPlatformMemory::Free<EAT_Object>(ptr, size);
     }
 
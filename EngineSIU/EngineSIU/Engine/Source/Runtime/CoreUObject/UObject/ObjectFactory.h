@@ -1,4 +1,6 @@
 #pragma once
+#include <cassert>
+
 #include "EngineStatics.h"
 #include "Object.h"
 #include "Class.h"
@@ -12,21 +14,25 @@ public:
     static UObject* ConstructObject(UClass* InClass, UObject* InOuter, FName InName = NAME_None)
     {
         const uint32 Id = UEngineStatics::GenUUID();
-        FString Name = InClass->GetName() + "_" + std::to_string(Id);
-        if (InName != NAME_None)
+
+        // 이름이 주어지면 문자열로 바꾸지 않고 그대로 사용
+        FName Name = InName;
+        if (InName == NAME_None)
         {
-            Name = InName.ToString();
+            FString GeneratedName;
+            InClass->GetFName().AppendString(GeneratedName);
+            GeneratedName += "_" + std::to_string(Id);
+            Name = FName(GeneratedName);
         }
 
+        // UObject 생성자에서 GUObjectArray에 등록되므로, 생성자 안에서 만든 TWeakObjectPtr와 Delegate도 유효함
+        const FObjectConstructionParams Params{ InClass, InOuter, Name, Id };
+        UObject::ConstructionParams = &Params;
         UObject* Obj = InClass->ClassCTOR();
-        Obj->ClassPrivate = InClass;
-        Obj->NamePrivate = Name;
-        Obj->UUID = Id;
-        Obj->OuterPrivate = InOuter;
-
-        GUObjectArray.AddObject(Obj);
+        assert(GUObjectArray.IsRegistered(Obj) && "ClassCTOR must construct the object through UObject::UObject");
 
-        UE_LOG(ELogLevel::Display, "Created New Object : %s", *Name);
+        TCHAR NameBuffer[NAME_SIZE];
+        UE_LOG(ELogLevel::Display, "Created New Object : %s", Name.ToCString(NameBuffer));
         return Obj;
     }
 
@@ -4,5 +4,5 @@
 
 bool IsValid(const UObject* Test)
 {
-    return Test && GUObjectArray.GetObjectItemArrayUnsafe().Contains(const_cast<UObject*>(Test));
+    return GUObjectArray.IsRegistered(Test);
 }
@@ -5,7 +5,10 @@ class UObject;
 /**
  * 주어진 UObject 포인터가 유효한지 확인합니다.
  *
- * @param Test 유효성을 검사할 UObject 포인터입니다.
+ * @param Test 유효성을 검사할 UObject 포인터입니다. nullptr이거나 아직 삭제되지 않은 Object여야 합니다.
  * @return 포인터가 유효하면 true를 반환하고, 그렇지 않으면 false를 반환합니다.
+ *
+ * @note Object의 InternalIndex를 읽어서 검사하므로, 이미 삭제된 Object의 포인터를 넘기면 해제된 메모리를 읽습니다.
+ *       삭제되었을 수 있는 Object를 들고 있어야 한다면 Raw Pointer 대신 FWeakObjectPtr(TWeakObjectPtr)로 들고 있다가 Get()으로 확인하세요.
  */
 bool IsValid(const UObject* Test);
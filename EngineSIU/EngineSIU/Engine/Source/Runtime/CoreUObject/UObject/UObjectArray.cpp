@@ -1,19 +1,90 @@
 #include "UObjectArray.h"
+#include <cassert>
+#include <memory>
+
 #include "Object.h"
 #include "UObjectHash.h"
+#include "HAL/PlatformMemory.h"
+
+
+FChunkedFixedUObjectArray::~FChunkedFixedUObjectArray()
+{
+    for (std::atomic<FUObjectItem*>& Chunk : Chunks)
+    {
+        if (FUObjectItem* ChunkData = Chunk.exchange(nullptr))
+        {
+            std::destroy_n(ChunkData, NumElementsPerChunk);
+            FPlatformMemory::Free<EAT_Container>(ChunkData, sizeof(FUObjectItem) * NumElementsPerChunk);
+        }
+    }
+}
+
+int32 FChunkedFixedUObjectArray::AddSingle()
+{
+    const int32 Index = NumElements.fetch_add(1, std::memory_order_acq_rel);
+    assert(Index < NumElementsPerChunk * MaxChunks && "GUObjectArray is full");
+
+    GetOrAllocateChunk(Index / NumElementsPerChunk);
+    return Index;
+}
+
+FUObjectItem* FChunkedFixedUObjectArray::GetOrAllocateChunk(int32 ChunkIndex)
+{
+    FUObjectItem* Chunk = Chunks[ChunkIndex].load(std::memory_order_acquire);
+    if (Chunk)
+    {
+        return Chunk;
+    }
+
+    void* RawMemory = FPlatformMemory::Malloc<EAT_Container>(sizeof(FUObjectItem) * NumElementsPerChunk);
+    FUObjectItem* NewChunk = static_cast<FUObjectItem*>(RawMemory);
+    std::uninitialized_default_construct_n(NewChunk, NumElementsPerChunk);
+
+    // 다른 스레드가 먼저 할당했다면 그쪽을 사용
+    if (!Chunks[ChunkIndex].compare_exchange_strong(Chunk, NewChunk, std::memory_order_acq_rel))
+    {
+        std::destroy_n(NewChunk, NumElementsPerChunk);
+        FPlatformMemory::Free<EAT_Container>(NewChunk, sizeof(FUObjectItem) * NumElementsPerChunk);
+        return Chunk;
+    }
+    return NewChunk;
+}
 
 
 void FUObjectArray::AddObject(UObject* Object)
 {
-    ObjObjects.Add(Object);
+    int32 Index = PopFreeIndex();
+    if (Index == INDEX_NONE)
+    {
+        Index = ObjObjects.AddSingle();
+    }
+
+    FUObjectItem& Item = ObjObjects.GetItem(Index);
+    assert(Item.Object == nullptr);
+    Item.Object = Object;
+    Object->InternalIndex = Index;
+    NumLiveObjects.fetch_add(1, std::memory_order_relaxed);
+
     AddToClassMap(Object);
 }
 
 void FUObjectArray::MarkRemoveObject(UObject* Object)
 {
-    ObjObjects.Remove(Object);
+    // 이미 제거된 Object라면 무시, Slot이 비워졌거나 다른 Object가 사용중
+    if (!IsRegistered(Object))
+    {
+        return;
+    }
+
+    const int32 Index = Object->InternalIndex;
+    FUObjectItem& Item = ObjObjects.GetItem(Index);
+    Item.Object = nullptr;
+    Item.SerialNumber.fetch_add(1, std::memory_order_acq_rel); // 기존 TWeakObjectPtr 무효화
+    PushFreeIndex(Index);
+    NumLiveObjects.fetch_sub(1, std::memory_order_relaxed);
+
     RemoveFromClassMap(Object);  // UObjectHashTable에서 Object를 제외
-    PendingDestroyObjects.AddUnique(Object);
+    PendingDestroyObjects.Add(Object);
 }
 
 void FUObjectArray::ProcessPendingDestroyObjects()
@@ -28,4 +99,46 @@ void FUObjectArray::ProcessPendingDestroyObjects()
     PendingDestroyObjects.Empty();
 }
 
+bool FUObjectArray::IsRegistered(const UObject* Object) const
+{
+    return Object && IndexToObject(Object->InternalIndex) == Object;
+}
+
+int32 FUObjectArray::PopFreeIndex()
+{
+    uint64 Head = FreeListHead.load(std::memory_order_acquire);
+    while (true)
+    {
+        const int32 Index = static_cast<int32>(static_cast<uint32>(Head));
+        if (Index == INDEX_NONE)
+        {
+            return INDEX_NONE;
+        }
+
+        const int32 NextIndex = ObjObjects.GetItem(Index).NextFreeIndex.load(std::memory_order_relaxed);
+        const uint64 Tag = (Head >> 32) + 1;
+        const uint64 NewHead = (Tag << 32) | static_cast<uint32>(NextIndex);
+        if (FreeListHead.compare_exchange_weak(Head, NewHead, std::memory_order_acq_rel))
+        {
+            return Index;
+        }
+    }
+}
+
+void FUObjectArray::PushFreeIndex(int32 Index)
+{
+    FUObjectItem& Item = ObjObjects.GetItem(Index);
+    uint64 Head = FreeListHead.load(std::memory_order_acquire);
+    while (true)
+    {
+        Item.NextFreeIndex.store(static_cast<int32>(static_cast<uint32>(Head)), std::memory_order_relaxed);
+        const uint64 Tag = (Head >> 32) + 1;
+        const uint64 NewHead = (Tag << 32) | static_cast<uint32>(Index);
+        if (FreeListHead.compare_exchange_weak(Head, NewHead, std::memory_order_acq_rel))
+        {
+            return;
+        }
+    }
+}
+
 FUObjectArray GUObjectArray;
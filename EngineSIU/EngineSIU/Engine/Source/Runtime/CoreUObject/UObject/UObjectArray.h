@@ -1,11 +1,99 @@
 ﻿#pragma once
+#include <atomic>
+
+#include "CoreMiscDefines.h"
 #include "Container/Array.h"
-#include "Container/Set.h"
 
 class UClass;
 class UObject;
 
 
+/**
+ * GUObjectArray의 Slot 하나
+ */
+struct FUObjectItem
+{
+    /** Slot에 등록된 Object, 비어있으면 nullptr */
+    UObject* Object = nullptr;
+
+    /**
+     * Slot이 비워질 때마다 증가하는 번호
+     * Index가 재사용되더라도 TWeakObjectPtr가 이전 Object를 가리키는지 구분할 수 있습니다.
+     */
+    std::atomic<int32> SerialNumber = 1;
+
+    /** Free List에서 다음 빈 Slot의 Index */
+    std::atomic<int32> NextFreeIndex = INDEX_NONE;
+};
+
+
+/**
+ * 고정 크기 Chunk 단위로 FUObjectItem을 할당하는 배열
+ * Chunk는 한 번 할당되면 이동하지 않으므로, Item의 주소와 Index가 변하지 않습니다.
+ */
+class FChunkedFixedUObjectArray
+{
+public:
+    static constexpr int32 NumElementsPerChunk = 64 * 1024;
+    static constexpr int32 MaxChunks = 2048;
+
+public:
+    FChunkedFixedUObjectArray() = default;
+    ~FChunkedFixedUObjectArray();
+
+    FChunkedFixedUObjectArray(const FChunkedFixedUObjectArray&) = delete;
+    FChunkedFixedUObjectArray& operator=(const FChunkedFixedUObjectArray&) = delete;
+    FChunkedFixedUObjectArray(FChunkedFixedUObjectArray&&) = delete;
+    FChunkedFixedUObjectArray& operator=(FChunkedFixedUObjectArray&&) = delete;
+
+    /** 한 번이라도 사용된 Slot의 수 */
+    int32 Num() const { return NumElements.load(std::memory_order_acquire); }
+
+    /** 새 Slot을 배열 끝에 추가하고, 그 Index를 반환합니다. */
+    int32 AddSingle();
+
+    FUObjectItem& GetItem(int32 Index)
+    {
+        return Chunks[Index / NumElementsPerChunk].load(std::memory_order_acquire)[Index % NumElementsPerChunk];
+    }
+
+    const FUObjectItem& GetItem(int32 Index) const
+    {
+        return Chunks[Index / NumElementsPerChunk].load(std::memory_order_acquire)[Index % NumElementsPerChunk];
+    }
+
+    /**
+     * Index의 Item을 반환합니다.
+     * 다른 스레드가 Slot을 추가하는 중이라 Chunk가 아직 할당되지 않았다면 nullptr
+     */
+    const FUObjectItem* GetItemPtr(int32 Index) const
+    {
+        if (Index < 0 || Index >= Num())
+        {
+            return nullptr;
+        }
+
+        const FUObjectItem* Chunk = Chunks[Index / NumElementsPerChunk].load(std::memory_order_acquire);
+        return Chunk ? &Chunk[Index % NumElementsPerChunk] : nullptr;
+    }
+
+    bool IsValidIndex(int32 Index) const { return Index >= 0 && Index < Num(); }
+
+private:
+    FUObjectItem* GetOrAllocateChunk(int32 ChunkIndex);
+
+private:
+    std::atomic<FUObjectItem*> Chunks[MaxChunks] = {};
+    std::atomic<int32> NumElements = 0;
+};
+
+
+/**
+ * 모든 UObject가 등록되는 배열
+ *
+ * Object는 등록될 때 Slot Index(UObject::InternalIndex)를 받고, 제거될 때까지 Index가 바뀌지 않습니다.
+ * 비워진 Slot은 lock-free Free List로 관리되어 다음 AddObject에서 재사용됩니다.
+ */
 class FUObjectArray
 {
 public:
@@ -14,18 +102,71 @@ public:
 
     void ProcessPendingDestroyObjects();
 
-    TSet<UObject*>& GetObjectItemArrayUnsafe()
+    /** 한 번이라도 사용된 Slot의 수, 비어있는 Slot도 포함합니다. */
+    int32 GetObjectArrayNum() const { return ObjObjects.Num(); }
+
+    /** 현재 등록되어있는 Object의 수 */
+    int32 GetObjectArrayNumMinusAvailable() const { return NumLiveObjects.load(std::memory_order_relaxed); }
+
+    /** Index의 Object를 반환합니다. 비어있는 Slot이면 nullptr */
+    UObject* IndexToObject(int32 Index) const
+    {
+        const FUObjectItem* Item = ObjObjects.GetItemPtr(Index);
+        return Item ? Item->Object : nullptr;
+    }
+
+    /** Index의 Slot이 SerialNumber일 때만 Object를 반환합니다. */
+    UObject* IndexToObject(int32 Index, int32 SerialNumber) const
+    {
+        const FUObjectItem* Item = ObjObjects.GetItemPtr(Index);
+        if (Item && Item->SerialNumber.load(std::memory_order_acquire) == SerialNumber)
+        {
+            return Item->Object;
+        }
+        return nullptr;
+    }
+
+    /** Index의 현재 SerialNumber, 유효하지 않은 Index면 0 */
+    int32 GetSerialNumber(int32 Index) const
+    {
+        const FUObjectItem* Item = ObjObjects.GetItemPtr(Index);
+        return Item ? Item->SerialNumber.load(std::memory_order_acquire) : 0;
+    }
+
+    /**
+     * Object가 GUObjectArray에 등록되어 있는지 확인합니다.
+     * @note Object->InternalIndex를 읽으므로 nullptr이거나 살아있는 Object만 넘겨야 합니다. 삭제되었을 수 있다면 FWeakObjectPtr을 사용하세요.
+     */
+    bool IsRegistered(const UObject* Object) const;
+
+    FChunkedFixedUObjectArray& GetObjectItemArrayUnsafe()
     {
         return ObjObjects;
     }
 
-    const TSet<UObject*>& GetObjectItemArrayUnsafe() const
+    const FChunkedFixedUObjectArray& GetObjectItemArrayUnsafe() const
     {
         return ObjObjects;
     }
 
 private:
-    TSet<UObject*> ObjObjects;
+    /** Free List에서 빈 Slot을 꺼냅니다. 없으면 INDEX_NONE */
+    int32 PopFreeIndex();
+
+    /** Slot을 Free List에 넣습니다. */
+    void PushFreeIndex(int32 Index);
+
+private:
+    FChunkedFixedUObjectArray ObjObjects;
+
+    /**
+     * Free List의 첫 번째 Index
+     * 하위 32bit는 Index, 상위 32bit는 ABA 문제를 막기 위한 Tag입니다.
+     */
+    std::atomic<uint64> FreeListHead = static_cast<uint32>(INDEX_NONE);
+
+    std::atomic<int32> NumLiveObjects = 0;
+
     TArray<UObject*> PendingDestroyObjects;
 };
 
@@ -1,5 +1,8 @@
 #include "UObjectHash.h"
 #include <cassert>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include "Object.h"
 #include "Class.h"
 #include "Container/Map.h"
@@ -28,6 +31,17 @@ public:
 
     TMap<UClass*, TSet<UClass*>> ClassToChildListMap;
     TMap<UClass*, TSet<UObject*>> ClassToObjectListMap;
+
+    /**
+     * TObjectIterator가 순회하는 Class별 Object 목록
+     * 한 번 조회된 Class만 만들어지며, 이후에는 AddToClassMap/RemoveFromClassMap에서 같이 갱신됩니다.
+     * Map에 다른 Class가 추가되어도 주소가 바뀌지 않도록 Heap에 할당합니다.
+     */
+    TMap<const UClass*, std::unique_ptr<FObjectListCache>> ClassToDerivedObjectListCache;
+    TMap<const UClass*, std::unique_ptr<FObjectListCache>> ClassToExactObjectListCache;
+
+    /** 여러 Job에서 TObjectIterator를 동시에 만들 수 있도록 캐시 Map을 보호합니다. */
+    std::shared_mutex CacheLock;
 };
 
 /** Helper function that returns all the children of the specified class recursively */
@@ -71,6 +85,21 @@ void AddToClassMap(UObject* Object)
     UClass* Class = Object->GetClass();
     HashTable.ClassToObjectListMap.FindOrAdd(Class).Add(Object);
 
+    // 이미 만들어진 캐시에 Object 추가
+    std::unique_lock Lock(HashTable.CacheLock);
+    if (std::unique_ptr<FObjectListCache>* ExactCache = HashTable.ClassToExactObjectListCache.Find(Class))
+    {
+        (*ExactCache)->Objects.Add(Object);
+    }
+    for (const UClass* SuperClass = Class; SuperClass; SuperClass = SuperClass->GetSuperClass())
+    {
+        if (std::unique_ptr<FObjectListCache>* DerivedCache = HashTable.ClassToDerivedObjectListCache.Find(SuperClass))
+        {
+            (*DerivedCache)->Objects.Add(Object);
+        }
+    }
+    Lock.unlock();
+
     // Ensure child class mappings are updated
     AddClassToChildListMap(Class);
 }
@@ -80,12 +109,42 @@ void RemoveFromClassMap(UObject* Object)
     assert(Object->GetClass());
     FUObjectHashTables& HashTable = FUObjectHashTables::Get();
 
-    TSet<UObject*>& ObjectSet = HashTable.ClassToObjectListMap.FindOrAdd(Object->GetClass());
+    UClass* Class = Object->GetClass();
+    TSet<UObject*>& ObjectSet = HashTable.ClassToObjectListMap.FindOrAdd(Class);
     int32 NumRemoved = ObjectSet.Remove(Object);
 
     if (NumRemoved == 0)
     {
-        HashTable.ClassToObjectListMap.Remove(Object->GetClass());
+        HashTable.ClassToObjectListMap.Remove(Class);
+    }
+
+    std::unique_lock Lock(HashTable.CacheLock);
+    auto RemoveFromCache = [Object](FObjectListCache& Cache)
+    {
+        // 순회 중이면 Object의 자리를 그대로 두고 EndObjectListIteration에서 제거
+        if (Cache.NumIterators.load(std::memory_order_acquire) > 0)
+        {
+            if (Cache.Objects.Contains(Object))
+            {
+                Cache.PendingRemovals.AddUnique(Object);
+            }
+        }
+        else
+        {
+            Cache.Objects.Remove(Object);
+        }
+    };
+
+    if (std::unique_ptr<FObjectListCache>* ExactCache = HashTable.ClassToExactObjectListCache.Find(Class))
+    {
+        RemoveFromCache(**ExactCache);
+    }
+    for (const UClass* SuperClass = Class; SuperClass; SuperClass = SuperClass->GetSuperClass())
+    {
+        if (std::unique_ptr<FObjectListCache>* DerivedCache = HashTable.ClassToDerivedObjectListCache.Find(SuperClass))
+        {
+            RemoveFromCache(**DerivedCache);
+        }
     }
 }
 
@@ -106,30 +165,98 @@ uint32 GetNumOfObjectsByClass(UClass* ClassToLookFor)
     return 0;
 }
 
-void GetObjectsOfClass(const UClass* ClassToLookFor, TArray<UObject*>& Results, bool bIncludeDerivedClasses)
+const FObjectListCache& GetObjectListOfClass(const UClass* ClassToLookFor, bool bIncludeDerivedClasses)
 {
-    // Most classes searched for have around 10 subclasses, some have hundreds
+    FUObjectHashTables& ThreadHash = FUObjectHashTables::Get();
+    TMap<const UClass*, std::unique_ptr<FObjectListCache>>& CacheMap = bIncludeDerivedClasses
+        ? ThreadHash.ClassToDerivedObjectListCache
+        : ThreadHash.ClassToExactObjectListCache;
+
+    {
+        std::shared_lock ReadLock(ThreadHash.CacheLock);
+        if (const std::unique_ptr<FObjectListCache>* Cache = CacheMap.Find(ClassToLookFor))
+        {
+            return **Cache;
+        }
+    }
+
+    std::unique_lock WriteLock(ThreadHash.CacheLock);
+
+    // Lock을 기다리는 동안 다른 Thread가 먼저 만들었을 수 있음
+    if (const std::unique_ptr<FObjectListCache>* Cache = CacheMap.Find(ClassToLookFor))
+    {
+        return **Cache;
+    }
+
+    // 처음 조회된 Class라면 캐시를 만들고, 이후에는 AddToClassMap/RemoveFromClassMap에서 갱신
     TArray<const UClass*> ClassesToSearch;
     ClassesToSearch.Add(ClassToLookFor);
 
-    FUObjectHashTables& ThreadHash = FUObjectHashTables::Get();
-
     if (bIncludeDerivedClasses)
     {
         RecursivelyPopulateDerivedClasses(ThreadHash, ClassToLookFor, ClassesToSearch);
     }
 
-
+    std::unique_ptr<FObjectListCache> NewCache = std::make_unique<FObjectListCache>();
     for (const UClass* SearchClass : ClassesToSearch)
     {
-        if (TSet<UObject*>* List = ThreadHash.ClassToObjectListMap.Find(const_cast<UClass*>(SearchClass)))
+        if (const TSet<UObject*>* List = ThreadHash.ClassToObjectListMap.Find(const_cast<UClass*>(SearchClass)))
         {
-            for (const auto& Object : *List)
+            NewCache->Objects.Reserve(NewCache->Objects.Num() + List->Num());
+            for (UObject* Object : *List)
             {
-                Results.Add(Object);
+                NewCache->Objects.Add(Object);
             }
         }
     }
+
+    FObjectListCache& Result = *NewCache;
+    CacheMap.Emplace(ClassToLookFor, std::move(NewCache));
+    return Result;
+}
+
+void BeginObjectListIteration(const FObjectListCache& ObjectList)
+{
+    // RemoveFromClassMap이 NumIterators를 읽고 제거하는 사이에 끼어들지 않도록 Shared Lock
+    std::shared_lock Lock(FUObjectHashTables::Get().CacheLock);
+    const_cast<FObjectListCache&>(ObjectList).NumIterators.fetch_add(1, std::memory_order_acq_rel);
+}
+
+void EndObjectListIteration(const FObjectListCache& ObjectList)
+{
+    // 캐시는 FUObjectHashTables가 소유하므로 const를 떼어도 안전
+    FObjectListCache& Cache = const_cast<FObjectListCache&>(ObjectList);
+    if (Cache.NumIterators.fetch_sub(1, std::memory_order_acq_rel) != 1)
+    {
+        return;
+    }
+
+    std::unique_lock Lock(FUObjectHashTables::Get().CacheLock);
+
+    // Lock을 기다리는 동안 새 순회가 시작되었다면 그 순회가 끝날 때 적용
+    if (Cache.NumIterators.load(std::memory_order_acquire) > 0)
+    {
+        return;
+    }
+    for (UObject* Object : Cache.PendingRemovals)
+    {
+        Cache.Objects.Remove(Object);
+    }
+    Cache.PendingRemovals.Empty();
+}
+
+void GetObjectsOfClass(const UClass* ClassToLookFor, TArray<UObject*>& Results, bool bIncludeDerivedClasses)
+{
+    const FObjectListCache& ObjectList = GetObjectListOfClass(ClassToLookFor, bIncludeDerivedClasses);
+
+    Results.Reserve(Results.Num() + ObjectList.Objects.Num());
+    for (UObject* Object : ObjectList.Objects)
+    {
+        if (!ObjectList.IsPendingRemoval(Object))
+        {
+            Results.Add(Object);
+        }
+    }
 }
 
 void AddClassToChildListMap(UClass* InClass)
@@ -1,9 +1,46 @@
 #pragma once
+#include <atomic>
+
 #include "Container/Array.h"
+#include "Container/Set.h"
 
 class UObject;
 class UClass;
 
+/** GetObjectListOfClass가 반환하는 Class별 Object 목록 */
+struct FObjectListCache
+{
+    TSet<UObject*> Objects;
+
+    /**
+     * 이 목록을 순회 중인 TObjectRange의 수
+     * 제거하면 마지막 Object가 빈 자리로 옮겨져 순회 중인 Range가 건너뛰므로, 0보다 크면 제거를 PendingRemovals로 미룹니다.
+     */
+    std::atomic<int32> NumIterators = 0;
+
+    /** 순회 중에 제거된 Object, 순회하는 쪽에서는 건너뛰고 마지막 순회가 끝나면 Objects에서 뺍니다. */
+    TArray<UObject*> PendingRemovals;
+
+    bool IsPendingRemoval(const UObject* Object) const
+    {
+        return !PendingRemovals.IsEmpty() && PendingRemovals.Contains(const_cast<UObject*>(Object));
+    }
+};
+
+/**
+ * ClassToLookFor와 일치하는 UObject 목록을 반환합니다.
+ * 목록은 Class별로 캐시되어 Object가 추가/제거될 때 갱신되므로, 매번 복사하지 않고 그대로 순회할 수 있습니다.
+ *
+ * @note Object가 추가/제거되면 목록의 순서가 바뀌거나 내부 배열이 재할당될 수 있습니다. 순회 중에는 Index로 접근해야 합니다.
+ */
+const FObjectListCache& GetObjectListOfClass(const UClass* ClassToLookFor, bool bIncludeDerivedClasses);
+
+/** ObjectList의 순회를 시작합니다. EndObjectListIteration까지 목록에서 Object가 제거되지 않습니다. */
+void BeginObjectListIteration(const FObjectListCache& ObjectList);
+
+/** ObjectList의 순회를 끝내고, 마지막 순회였다면 그동안 미뤄둔 제거를 적용합니다. */
+void EndObjectListIteration(const FObjectListCache& ObjectList);
+
 /**
  * ClassToLookFor와 일치하는 UObject를 반환합니다.
  * @param ClassToLookFor 반환할 Object의 Class정보
@@ -1,15 +1,20 @@
 ﻿#pragma once
 #include "Object.h"
 #include "UObjectHash.h"
-#include "Container/Array.h"
+#include "Container/Set.h"
 
 #undef GetObject // Windows.h 이름 겹침
 
 
 /**
  * 특정 타입의 UObject 인스턴스를 순회하기 위한 반복자 클래스입니다.
- * 
+ * Class별로 캐시된 Object 목록을 복사하지 않고 그대로 순회합니다.
+ * TObjectRange를 통해서만 만들어지며, Range가 살아있는 동안 목록에서 Object가 제거되지 않습니다.
+ *
  * @tparam T 순회할 UObject 타입 또는 그 파생 클래스
+ *
+ * @note 순회 중 Object가 추가되면 이번 순회에서 방문될 수 있습니다.
+ *       순회 중 제거된 Object는 목록에 남아있지만 건너뛰고, 마지막 Range가 끝날 때 목록에서 빠집니다.
  */
 template <typename T>
     requires std::derived_from<T, UObject>
@@ -22,16 +27,17 @@ public:
     };
 
     /** Begin 생성자 */
-    explicit TObjectIterator(bool bIncludeDerivedClasses = true)
-        : Index(-1)
+    explicit TObjectIterator(const FObjectListCache& InObjectList)
+        : ObjectList(&InObjectList)
+        , Index(-1)
     {
-        GetObjectsOfClass(T::StaticClass(), ObjectArray, bIncludeDerivedClasses);
         Advance();
     }
 
     /** End 생성자 */
     TObjectIterator(EEndTagType, const TObjectIterator& Begin)
-        : Index(Begin.ObjectArray.Num())
+        : ObjectList(Begin.ObjectList)
+        , Index(EndIndex)
     {
     }
 
@@ -50,20 +56,29 @@ public:
         return (T*)GetObject();
     }
 
-    FORCEINLINE bool operator==(const TObjectIterator& Rhs) const { return Index == Rhs.Index; }
-    FORCEINLINE bool operator!=(const TObjectIterator& Rhs) const { return Index != Rhs.Index; }
+    // 순회 중에 목록의 크기가 바뀔 수 있으므로, 목록을 벗어난 Index는 모두 End로 취급
+    FORCEINLINE bool operator==(const TObjectIterator& Rhs) const { return GetCompareIndex() == Rhs.GetCompareIndex(); }
+    FORCEINLINE bool operator!=(const TObjectIterator& Rhs) const { return GetCompareIndex() != Rhs.GetCompareIndex(); }
 
 protected:
+    static constexpr int32 EndIndex = INT32_MAX;
+
     UObject* GetObject() const 
     { 
-        return ObjectArray[Index];
+        return ObjectList->Objects[Index];
+    }
+
+    int32 GetCompareIndex() const
+    {
+        return Index < ObjectList->Objects.Num() ? Index : EndIndex;
     }
 
     bool Advance()
     {
-        while(++Index < ObjectArray.Num())
+        while(++Index < ObjectList->Objects.Num())
         {
-            if (GetObject())
+            const UObject* Object = GetObject();
+            if (Object && !ObjectList->IsPendingRemoval(Object))
             {
                 return true;
             }
@@ -72,12 +87,33 @@ protected:
     }
 
 protected:
-    /** Results from the GetObjectsOfClass query */
-    TArray<UObject*> ObjectArray;
+    /** GetObjectListOfClass가 반환한 캐시, 순회 중에 재할당될 수 있으므로 Index로 접근 */
+    const FObjectListCache* ObjectList;
     int32 Index;
 };
 
 
+/** 살아있는 동안 ObjectList의 순회 중으로 표시해서, 목록에서 Object가 제거되지 않도록 합니다. */
+struct FObjectListIterationScope
+{
+    explicit FObjectListIterationScope(const FObjectListCache& InObjectList)
+        : ObjectList(InObjectList)
+    {
+        BeginObjectListIteration(ObjectList);
+    }
+
+    ~FObjectListIterationScope()
+    {
+        EndObjectListIteration(ObjectList);
+    }
+
+    FObjectListIterationScope(const FObjectListIterationScope&) = delete;
+    FObjectListIterationScope& operator=(const FObjectListIterationScope&) = delete;
+
+    const FObjectListCache& ObjectList;
+};
+
+
 /**
  * 특정 타입의 UObject 인스턴스들을 순회할 수 있는 범위를 정의하는 구조체입니다.
  * 이 구조체는 range-based for 루프에서 사용될 수 있습니다.
@@ -89,12 +125,15 @@ template <typename T>
 struct TObjectRange
 {
     TObjectRange(bool bIncludeDerivedClasses = true)
-        : Begin(bIncludeDerivedClasses)
+        : IterationScope(GetObjectListOfClass(T::StaticClass(), bIncludeDerivedClasses))
+        , Begin(IterationScope.ObjectList)
     {
     }
 
     friend TObjectIterator<T> begin(const TObjectRange& Range) { return Range.Begin; }
     friend TObjectIterator<T> end  (const TObjectRange& Range) { return TObjectIterator<T>(TObjectIterator<T>::EndTag, Range.Begin); }
 
+    // Begin보다 먼저 생성되어야 첫 Advance부터 제거가 미뤄짐
+    FObjectListIterationScope IterationScope;
     TObjectIterator<T> Begin;
 };
@@ -0,0 +1,83 @@
+#include "UObjectArray.h"
+#include "UObjectHash.h"
+#include "UObjectIterator.h"
+#include "Components/SceneComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "GameFramework/Actor.h"
+#include "Misc/Benchmark.h"
+#include "UserInterface/Console.h"
+
+namespace
+{
+    /**
+     * TObjectRange로 캐시된 목록을 순회하는 것과, GetObjectsOfClass로 복사한 뒤 순회하는 것,
+     * GUObjectArray 전체를 IsA로 걸러 순회하는 것(이전 구현)의 시간을 비교합니다.
+     */
+    template <typename T>
+    void RunObjectIteratorBenchmarkOfClass(const FBenchmarkContext& Context, const char* ClassName)
+    {
+        const int32 NumIterations = Context.Count;
+        const int32 NumObjects = GetObjectListOfClass(T::StaticClass(), true).Objects.Num();
+        uint64 Checksum = 0;
+
+        auto Measure = [&Context, ClassName, NumIterations, NumObjects](const char* Label, auto&& Body)
+        {
+            const std::string FullLabel = std::string(ClassName) + ' ' + Label;
+            Context.Measure(FullLabel.c_str(), static_cast<double>(NumIterations) * FMath::Max(NumObjects, 1), [&]
+            {
+                for (int32 Index = 0; Index < NumIterations; ++Index)
+                {
+                    Body();
+                }
+            }, "object");
+        };
+
+        Measure("TObjectRange", [&]
+        {
+            for (T* Object : TObjectRange<T>())
+            {
+                Checksum += reinterpret_cast<uint64>(Object);
+            }
+        });
+        Measure("GetObjectsOfClass", [&]
+        {
+            TArray<UObject*> Objects;
+            GetObjectsOfClass(T::StaticClass(), Objects, true);
+            for (UObject* Object : Objects)
+            {
+                Checksum += reinterpret_cast<uint64>(Object);
+            }
+        });
+        Measure("GUObjectArray + IsA", [&]
+        {
+            const UClass* Class = T::StaticClass();
+            const int32 NumSlots = GUObjectArray.GetObjectArrayNum();
+            for (int32 Index = 0; Index < NumSlots; ++Index)
+            {
+                UObject* Object = GUObjectArray.IndexToObject(Index);
+                if (Object && Object->IsA(Class))
+                {
+                    Checksum += reinterpret_cast<uint64>(Object);
+                }
+            }
+        });
+
+        Context.Console.AddLog(ELogLevel::Display, "%-22s %d objects (checksum %llu)", ClassName, NumObjects, Checksum);
+    }
+
+    /** 현재 World에 있는 Object로 Class별 순회 시간을 측정합니다. */
+    void RunObjectIteratorBenchmark(const FBenchmarkContext& Context)
+    {
+        RunObjectIteratorBenchmarkOfClass<UStaticMeshComponent>(Context, "UStaticMeshComponent");
+        RunObjectIteratorBenchmarkOfClass<USceneComponent>(Context, "USceneComponent");
+        RunObjectIteratorBenchmarkOfClass<AActor>(Context, "AActor");
+        Context.Console.AddLog(
+            ELogLevel::Display, "Object bench: %d iterations, %d live objects",
+            Context.Count, GUObjectArray.GetObjectArrayNumMinusAvailable()
+        );
+    }
+
+    FAutoRegisterBenchmark ObjectIteratorBenchmark(
+        "obj bench", "[iterations]: Compare TObjectRange against GetObjectsOfClass and a GUObjectArray walk", 1000, &RunObjectIteratorBenchmark
+    );
+}
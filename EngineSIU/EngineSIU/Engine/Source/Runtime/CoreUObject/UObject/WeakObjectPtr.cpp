@@ -0,0 +1,23 @@
+#include "WeakObjectPtr.h"
+#include "Object.h"
+#include "UObjectArray.h"
+
+
+FWeakObjectPtr& FWeakObjectPtr::operator=(const UObject* Object)
+{
+    if (GUObjectArray.IsRegistered(Object))
+    {
+        ObjectIndex = Object->GetInternalIndex();
+        ObjectSerialNumber = GUObjectArray.GetSerialNumber(ObjectIndex);
+    }
+    else
+    {
+        Reset();
+    }
+    return *this;
+}
+
+UObject* FWeakObjectPtr::Get() const
+{
+    return GUObjectArray.IndexToObject(ObjectIndex, ObjectSerialNumber);
+}
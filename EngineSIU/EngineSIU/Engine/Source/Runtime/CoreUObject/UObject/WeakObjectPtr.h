@@ -1,9 +1,49 @@
 ﻿#pragma once
 #include <concepts>
 
+#include "CoreMiscDefines.h"
 #include "ObjectUtils.h"
 #include "HAL/PlatformType.h"
 
+/**
+ * GUObjectArray의 Index와 SerialNumber로 Object를 가리키는 약한 참조
+ * Object가 제거되면 Slot의 SerialNumber가 바뀌므로, 이미 삭제된 Object의 메모리에 접근하지 않고 유효성을 판단할 수 있습니다.
+ */
+struct FWeakObjectPtr
+{
+public:
+    FWeakObjectPtr() = default;
+
+    FWeakObjectPtr(const UObject* Object)
+    {
+        *this = Object;
+    }
+
+    FWeakObjectPtr& operator=(const UObject* Object);
+
+    /** Object가 유효하면 반환하고, 그렇지 않으면 nullptr */
+    UObject* Get() const;
+
+    bool IsValid() const { return Get() != nullptr; }
+
+    void Reset()
+    {
+        ObjectIndex = INDEX_NONE;
+        ObjectSerialNumber = 0;
+    }
+
+    /** 두 포인터가 같은 Slot의 같은 Object를 가리키는지 확인합니다. Object의 유효성은 검사하지 않습니다. */
+    bool HasSameIndexAndSerialNumber(const FWeakObjectPtr& Other) const
+    {
+        return ObjectIndex == Other.ObjectIndex && ObjectSerialNumber == Other.ObjectSerialNumber;
+    }
+
+private:
+    int32 ObjectIndex = INDEX_NONE;
+    int32 ObjectSerialNumber = 0;
+};
+
+
 /**
  * Object가 유효할때만 값을 반환하는 포인터, Object가 유효하지 않다면 nullptr
  * @tparam T UObject를 상속받은 Class
@@ -26,39 +66,30 @@ public:
     TWeakObjectPtr& operator=(TWeakObjectPtr&&) = default;
 
     TWeakObjectPtr(nullptr_t)
-        : ObjectPtr(nullptr)
     {
     }
 
     TWeakObjectPtr(ElementType* InPtr)
-        : ObjectPtr(InPtr)
+        : WeakPtr(InPtr)
     {
     }
 
     TWeakObjectPtr& operator=(nullptr_t)
     {
-        ObjectPtr = nullptr;
+        WeakPtr.Reset();
         return *this;
     }
 
     TWeakObjectPtr& operator=(ElementType* InPtr)
     {
-        ObjectPtr = InPtr;
+        WeakPtr = InPtr;
         return *this;
     }
 
 public:
     FORCEINLINE ElementType* Get() const
     {
-        if (ObjectPtr)
-        {
-            if (::IsValid(ObjectPtr))
-            {
-                return ObjectPtr;
-            }
-            ObjectPtr = nullptr;
-        }
-        return nullptr;
+        return static_cast<ElementType*>(WeakPtr.Get());
     }
 
     FORCEINLINE ElementType* operator->() const { return Get(); }
@@ -69,6 +100,11 @@ public:
 public:
     bool IsValid() const { return Get() != nullptr; }
 
+    bool HasSameIndexAndSerialNumber(const TWeakObjectPtr& Other) const
+    {
+        return WeakPtr.HasSameIndexAndSerialNumber(Other.WeakPtr);
+    }
+
 private:
-    mutable ElementType* ObjectPtr = nullptr;
+    FWeakObjectPtr WeakPtr;
 };
@@ -0,0 +1,50 @@
+#include "AnimBenchmarkUtils.h"
+
+#include "AnimSequence.h"
+#include "ReferenceSkeleton.h"
+#include "Math/Rotator.h"
+
+void FAnimBenchmarkUtils::MakeReferenceSkeleton(int32 NumBones, FReferenceSkeleton& OutRefSkeleton)
+{
+    OutRefSkeleton = FReferenceSkeleton();
+
+    TArray<FMatrix> BindPoseMatrices;
+    for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+    {
+        const FName BoneName(FString::Printf(TEXT("Bone_%d"), BoneIndex));
+        const int32 ParentIndex = BoneIndex == 0 ? INDEX_NONE : (BoneIndex - 1) / 2;
+        OutRefSkeleton.RawRefBoneInfo.Add(FMeshBoneInfo(BoneName, ParentIndex));
+        OutRefSkeleton.RawRefBonePose.Add(FTransform(FRotator(static_cast<float>(BoneIndex % 7) * 5.f, 0.f, 10.f), FVector(0.f, 0.f, 10.f)));
+        OutRefSkeleton.RawNameToIndexMap.Add(BoneName, BoneIndex);
+
+        // 부모가 항상 앞에 있으므로 한 번에 Component Space Bind Pose를 구함
+        FMatrix BindPoseMatrix = OutRefSkeleton.RawRefBonePose[BoneIndex].ToMatrixWithScale();
+        if (ParentIndex != INDEX_NONE)
+        {
+            BindPoseMatrix = BindPoseMatrix * BindPoseMatrices[ParentIndex];
+        }
+        BindPoseMatrices.Add(BindPoseMatrix);
+        OutRefSkeleton.InverseBindPoseMatrices.Add(FMatrix::Inverse(BindPoseMatrix));
+    }
+}
+
+void FAnimBenchmarkUtils::MakeAnimSequence(int32 NumBones, int32 NumFrames, int32 FrameRate, UAnimSequence& OutSequence)
+{
+    TArray<FRawAnimSequenceTrack> RawTracks;
+    TArray<int32> TrackBoneIndices;
+    RawTracks.SetNum(NumBones);
+    for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+    {
+        FRawAnimSequenceTrack& Track = RawTracks[BoneIndex];
+        const float Phase = static_cast<float>(BoneIndex) * 0.37f;
+        for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+        {
+            const float Time = static_cast<float>(Frame) / FrameRate;
+            Track.RotKeys.Add(FRotator(FMath::Sin(Time * PI + Phase) * 30.f, FMath::Cos(Time * PI + Phase) * 20.f, 0.f).Quaternion());
+        }
+        Track.PosKeys.Add(FVector::ZeroVector);
+        Track.ScaleKeys.Add(FVector::OneVector);
+        TrackBoneIndices.Add(BoneIndex);
+    }
+    OutSequence.SetAnimationData(RawTracks, TrackBoneIndices, NumFrames, FrameRate);
+}
@@ -0,0 +1,18 @@
+#pragma once
+#include "HAL/PlatformType.h"
+
+struct FReferenceSkeleton;
+class UAnimSequence;
+
+/** 애니메이션 벤치마크가 같이 쓰는 합성 Skeleton과 Sequence */
+struct FAnimBenchmarkUtils
+{
+    /**
+     * 부모가 (Index - 1) / 2인 NumBones개의 Bone으로 된 Reference Skeleton을 만듭니다.
+     * Bind Pose는 부모에서 조금씩 회전하며 뻗어 나가고, InverseBindPoseMatrices까지 채웁니다.
+     */
+    static void MakeReferenceSkeleton(int32 NumBones, FReferenceSkeleton& OutRefSkeleton);
+
+    /** NumBones개의 Bone이 모두 회전하는 NumFrames Frame짜리 Sequence를 채웁니다. */
+    static void MakeAnimSequence(int32 NumBones, int32 NumFrames, int32 FrameRate, UAnimSequence& OutSequence);
+};
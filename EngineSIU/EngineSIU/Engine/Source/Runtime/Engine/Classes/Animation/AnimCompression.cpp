@@ -0,0 +1,380 @@
+#include "AnimCompression.h"
+
+#include "Math/Transform.h"
+
+
+namespace
+{
+    FORCEINLINE FQuat LerpQuat(const FQuat& A, const FQuat& B, float Alpha)
+    {
+        // 최단 경로로 Normalized Lerp
+        const float Dot = A.X * B.X + A.Y * B.Y + A.Z * B.Z + A.W * B.W;
+        const float WeightB = Dot >= 0.f ? Alpha : -Alpha;
+        const float WeightA = 1.f - Alpha;
+
+        const float X = A.X * WeightA + B.X * WeightB;
+        const float Y = A.Y * WeightA + B.Y * WeightB;
+        const float Z = A.Z * WeightA + B.Z * WeightB;
+        const float W = A.W * WeightA + B.W * WeightB;
+
+        // 두 Key 모두 단위 쿼터니언이라 길이가 0이 되지 않음
+        const float Scale = FMath::InvSqrt(X * X + Y * Y + Z * Z + W * W);
+        return FQuat(X * Scale, Y * Scale, Z * Scale, W * Scale);
+    }
+
+    FORCEINLINE FVector LerpVector(const FVector& A, const FVector& B, float Alpha)
+    {
+        return A + (B - A) * Alpha;
+    }
+
+    /**
+     * 선형 보간으로 오차 범위 안에서 복원되는 Key를 제거하고 남은 Frame 번호를 반환합니다.
+     * 첫 Frame과 마지막 Frame은 항상 남습니다.
+     */
+    template <typename KeyType, typename LerpFuncType, typename ErrorFuncType>
+    void ReduceKeys(const TArray<KeyType>& Samples, float MaxError, LerpFuncType LerpFunc, ErrorFuncType ErrorFunc, TArray<int32>& OutFrames)
+    {
+        const int32 NumSamples = Samples.Num();
+
+        OutFrames.Empty();
+        OutFrames.Add(0);
+
+        int32 Anchor = 0;
+        for (int32 End = 2; End < NumSamples; ++End)
+        {
+            for (int32 Frame = Anchor + 1; Frame < End; ++Frame)
+            {
+                const float Alpha = static_cast<float>(Frame - Anchor) / static_cast<float>(End - Anchor);
+                if (ErrorFunc(LerpFunc(Samples[Anchor], Samples[End], Alpha), Samples[Frame]) > MaxError)
+                {
+                    Anchor = End - 1;
+                    OutFrames.Add(Anchor);
+                    break;
+                }
+            }
+        }
+
+        if (NumSamples > 1)
+        {
+            OutFrames.Add(NumSamples - 1);
+        }
+    }
+
+    /**
+     * 한 Channel을 압축해서 Frames/Keys 배열 끝에 추가합니다.
+     * @param Samples 양자화 후 복원한 값, 오차 계산에 양자화 오차까지 포함되도록
+     */
+    template <typename KeyType, typename StoredKeyType, typename LerpFuncType, typename ErrorFuncType, typename EncodeFuncType>
+    FAnimKeyChannel CompressChannel(
+        const TArray<KeyType>& Samples, const KeyType& DefaultValue, float MaxError,
+        LerpFuncType LerpFunc, ErrorFuncType ErrorFunc, EncodeFuncType EncodeFunc,
+        TArray<uint16>& OutFrames, TArray<StoredKeyType>& OutKeys
+    )
+    {
+        FAnimKeyChannel Channel;
+        Channel.Offset = OutKeys.Num();
+
+        if (Samples.Num() == 0)
+        {
+            return Channel;
+        }
+
+        bool bConstant = true;
+        for (const KeyType& Sample : Samples)
+        {
+            if (ErrorFunc(Samples[0], Sample) > MaxError)
+            {
+                bConstant = false;
+                break;
+            }
+        }
+
+        if (bConstant)
+        {
+            if (ErrorFunc(Samples[0], DefaultValue) > MaxError)
+            {
+                OutFrames.Add(0);
+                OutKeys.Add(EncodeFunc(Samples[0]));
+                Channel.NumKeys = 1;
+            }
+            return Channel;
+        }
+
+        TArray<int32> KeptFrames;
+        ReduceKeys(Samples, MaxError, LerpFunc, ErrorFunc, KeptFrames);
+
+        for (const int32 Frame : KeptFrames)
+        {
+            OutFrames.Add(static_cast<uint16>(Frame));
+            OutKeys.Add(EncodeFunc(Samples[Frame]));
+        }
+        Channel.NumKeys = KeptFrames.Num();
+        return Channel;
+    }
+
+    /**
+     * Frame을 감싸는 두 Key와 그 사이의 비율을 찾습니다.
+     * Key가 고르게 분포한다고 보고 위치를 추정한 뒤 앞뒤로 보정하므로, 대부분 한두 번의 비교로 끝납니다.
+     */
+    FORCEINLINE void FindKeys(const uint16* Frames, int32 NumKeys, float Frame, int32 NumFrames, bool bLooping, int32& OutKey0, int32& OutKey1, float& OutAlpha)
+    {
+        int32 Key = FMath::Min(static_cast<int32>(Frame * static_cast<float>(NumKeys) / static_cast<float>(NumFrames)), NumKeys - 1);
+        while (Key > 0 && static_cast<float>(Frames[Key]) > Frame)
+        {
+            --Key;
+        }
+        while (Key + 1 < NumKeys && static_cast<float>(Frames[Key + 1]) <= Frame)
+        {
+            ++Key;
+        }
+
+        OutKey0 = Key;
+        if (Key + 1 < NumKeys)
+        {
+            OutKey1 = Key + 1;
+            OutAlpha = (Frame - Frames[Key]) / static_cast<float>(Frames[Key + 1] - Frames[Key]);
+        }
+        else if (bLooping && NumKeys > 1)
+        {
+            // 마지막 Key에서 첫 Key로 돌아가는 구간
+            OutKey1 = 0;
+            OutAlpha = (Frame - Frames[Key]) / static_cast<float>(NumFrames - Frames[Key]);
+        }
+        else
+        {
+            OutKey1 = Key;
+            OutAlpha = 0.f;
+        }
+    }
+
+    FORCEINLINE FVector SampleVector(const TArray<uint16>& Frames, const TArray<FVector>& Keys, const FAnimKeyChannel& Channel, float Frame, int32 NumFrames, bool bLooping, const FVector& DefaultValue)
+    {
+        if (Channel.NumKeys == 0)
+        {
+            return DefaultValue;
+        }
+        if (Channel.NumKeys == 1)
+        {
+            return Keys[Channel.Offset];
+        }
+
+        int32 Key0, Key1;
+        float Alpha;
+        FindKeys(&Frames[Channel.Offset], Channel.NumKeys, Frame, NumFrames, bLooping, Key0, Key1, Alpha);
+        return LerpVector(Keys[Channel.Offset + Key0], Keys[Channel.Offset + Key1], Alpha);
+    }
+
+    FORCEINLINE FQuat SampleRotation(const FCompressedAnimData& Data, const FAnimKeyChannel& Channel, float Frame, bool bLooping)
+    {
+        if (Channel.NumKeys == 0)
+        {
+            return FQuat::Identity;
+        }
+        if (Channel.NumKeys == 1)
+        {
+            return Data.RotationKeys[Channel.Offset].ToQuat();
+        }
+
+        int32 Key0, Key1;
+        float Alpha;
+        FindKeys(&Data.RotationFrames[Channel.Offset], Channel.NumKeys, Frame, Data.NumFrames, bLooping, Key0, Key1, Alpha);
+        return LerpQuat(Data.RotationKeys[Channel.Offset + Key0].ToQuat(), Data.RotationKeys[Channel.Offset + Key1].ToQuat(), Alpha);
+    }
+}
+
+void FQuat48::FromQuat(const FQuat& InQuat)
+{
+    const FQuat Quat = InQuat.GetNormalized();
+    float Components[4] = { Quat.X, Quat.Y, Quat.Z, Quat.W };
+
+    uint32 LargestIndex = 0;
+    for (uint32 Index = 1; Index < 4; ++Index)
+    {
+        if (FMath::Abs(Components[Index]) > FMath::Abs(Components[LargestIndex]))
+        {
+            LargestIndex = Index;
+        }
+    }
+
+    // q와 -q는 같은 회전이므로 가장 큰 성분이 양수가 되도록 맞추고 생략
+    const float Sign = Components[LargestIndex] < 0.f ? -1.f : 1.f;
+
+    uint64 Packed = LargestIndex;
+    for (uint32 Index = 0; Index < 4; ++Index)
+    {
+        if (Index == LargestIndex)
+        {
+            continue;
+        }
+
+        const float Normalized = FMath::Clamp(Components[Index] * Sign / ComponentRange * 0.5f + 0.5f, 0.f, 1.f);
+        Packed = (Packed << 15) | static_cast<uint64>(Normalized * ComponentMax + 0.5f);
+    }
+
+    Data[0] = static_cast<uint16>(Packed >> 32);
+    Data[1] = static_cast<uint16>(Packed >> 16);
+    Data[2] = static_cast<uint16>(Packed);
+}
+
+void FCompressedAnimData::Empty()
+{
+    NumFrames = 0;
+    Tracks.Empty();
+    TranslationFrames.Empty();
+    TranslationKeys.Empty();
+    RotationFrames.Empty();
+    RotationKeys.Empty();
+    ScaleFrames.Empty();
+    ScaleKeys.Empty();
+}
+
+uint64 FCompressedAnimData::GetDataSize() const
+{
+    return Tracks.Num() * sizeof(FCompressedAnimTrack)
+        + (TranslationFrames.Num() + RotationFrames.Num() + ScaleFrames.Num()) * sizeof(uint16)
+        + (TranslationKeys.Num() + ScaleKeys.Num()) * sizeof(FVector)
+        + RotationKeys.Num() * sizeof(FQuat48);
+}
+
+bool FCompressedAnimData::IsValid() const
+{
+    // Key의 Frame 번호는 같은 Index의 *Frames에 있으므로 두 배열의 길이가 같아야 함
+    if (NumFrames < 0
+        || TranslationFrames.Num() != TranslationKeys.Num()
+        || RotationFrames.Num() != RotationKeys.Num()
+        || ScaleFrames.Num() != ScaleKeys.Num())
+    {
+        return false;
+    }
+
+    const auto IsValidChannel = [this](const FAnimKeyChannel& Channel, const TArray<uint16>& Frames)
+    {
+        // 64bit로 더해서 Offset + NumKeys의 Overflow를 막음
+        if (Channel.Offset < 0
+            || Channel.NumKeys < 0
+            || static_cast<int64>(Channel.Offset) + Channel.NumKeys > Frames.Num())
+        {
+            return false;
+        }
+        if (Channel.NumKeys <= 1)
+        {
+            return true;
+        }
+
+        // FindKeys가 이웃한 Key의 Frame 차이와 (NumFrames - 마지막 Frame)으로 나누므로 순증가하고 NumFrames보다 작아야 함
+        const uint16* ChannelFrames = &Frames[Channel.Offset];
+        for (int32 Key = 1; Key < Channel.NumKeys; ++Key)
+        {
+            if (ChannelFrames[Key] <= ChannelFrames[Key - 1])
+            {
+                return false;
+            }
+        }
+        return ChannelFrames[Channel.NumKeys - 1] < NumFrames;
+    };
+
+    for (const FCompressedAnimTrack& Track : Tracks)
+    {
+        if (Track.BoneIndex < 0
+            || !IsValidChannel(Track.Translation, TranslationFrames)
+            || !IsValidChannel(Track.Rotation, RotationFrames)
+            || !IsValidChannel(Track.Scale, ScaleFrames))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void FAnimationCompression::Compress(
+    const TArray<FRawAnimSequenceTrack>& RawTracks,
+    const TArray<int32>& TrackBoneIndices,
+    int32 NumFrames,
+    const FAnimCompressionSettings& Settings,
+    FCompressedAnimData& OutData
+)
+{
+    OutData.Empty();
+
+    // Key의 Frame 번호를 uint16으로 저장
+    OutData.NumFrames = FMath::Clamp(NumFrames, 1, 0xFFFF);
+
+    const auto VectorError = [](const FVector& A, const FVector& B) { return FVector::Distance(A, B); };
+    const auto QuatError = [](const FQuat& A, const FQuat& B) { return A.AngularDistance(B); };
+    const auto KeepVector = [](const FVector& Value) { return Value; };
+    const auto EncodeQuat = [](const FQuat& Value) { return FQuat48(Value); };
+
+    TArray<FQuat> QuantizedRotations;
+    for (int32 TrackIndex = 0; TrackIndex < RawTracks.Num(); ++TrackIndex)
+    {
+        const FRawAnimSequenceTrack& RawTrack = RawTracks[TrackIndex];
+
+        FCompressedAnimTrack Track;
+        Track.BoneIndex = TrackBoneIndices[TrackIndex];
+
+        Track.Translation = CompressChannel(
+            RawTrack.PosKeys, FVector::ZeroVector, Settings.MaxTranslationError,
+            LerpVector, VectorError, KeepVector,
+            OutData.TranslationFrames, OutData.TranslationKeys
+        );
+
+        // 양자화 오차까지 오차 범위에 포함되도록 복원한 값으로 Key Reduction
+        QuantizedRotations.SetNum(RawTrack.RotKeys.Num());
+        for (int32 KeyIndex = 0; KeyIndex < RawTrack.RotKeys.Num(); ++KeyIndex)
+        {
+            QuantizedRotations[KeyIndex] = FQuat48(RawTrack.RotKeys[KeyIndex]).ToQuat();
+        }
+        Track.Rotation = CompressChannel(
+            QuantizedRotations, FQuat::Identity, Settings.MaxRotationError,
+            LerpQuat, QuatError, EncodeQuat,
+            OutData.RotationFrames, OutData.RotationKeys
+        );
+
+        Track.Scale = CompressChannel(
+            RawTrack.ScaleKeys, FVector::OneVector, Settings.MaxScaleError,
+            LerpVector, VectorError, KeepVector,
+            OutData.ScaleFrames, OutData.ScaleKeys
+        );
+
+        // 모든 Channel이 항등인 Track은 샘플링할 필요가 없음 (Track이 없는 Bone은 Identity)
+        if (Track.Translation.NumKeys == 0 && Track.Rotation.NumKeys == 0 && Track.Scale.NumKeys == 0)
+        {
+            continue;
+        }
+
+        OutData.Tracks.Add(Track);
+    }
+}
+
+void FAnimationCompression::DecompressPose(
+    const FCompressedAnimData& Data,
+    float Frame,
+    bool bLooping,
+    TArray<FTransform>& OutPose,
+    const TArray<uint8>* RequiredBones
+)
+{
+    if (Data.NumFrames <= 0)
+    {
+        return;
+    }
+
+    Frame = FMath::Clamp(Frame, 0.f, static_cast<float>(bLooping ? Data.NumFrames : Data.NumFrames - 1));
+
+    for (const FCompressedAnimTrack& Track : Data.Tracks)
+    {
+        if (!OutPose.IsValidIndex(Track.BoneIndex))
+        {
+            continue;
+        }
+        if (RequiredBones && !(RequiredBones->IsValidIndex(Track.BoneIndex) && (*RequiredBones)[Track.BoneIndex]))
+        {
+            continue;
+        }
+
+        FTransform& OutTransform = OutPose[Track.BoneIndex];
+        OutTransform.Translation = SampleVector(Data.TranslationFrames, Data.TranslationKeys, Track.Translation, Frame, Data.NumFrames, bLooping, FVector::ZeroVector);
+        OutTransform.Rotation = SampleRotation(Data, Track.Rotation, Frame, bLooping);
+        OutTransform.Scale3D = SampleVector(Data.ScaleFrames, Data.ScaleKeys, Track.Scale, Frame, Data.NumFrames, bLooping, FVector::OneVector);
+    }
+}
@@ -0,0 +1,145 @@
+#pragma once
+#include "CoreMiscDefines.h"
+#include "Container/Array.h"
+#include "HAL/PlatformType.h"
+#include "Math/Quat.h"
+#include "Math/Vector.h"
+
+struct FTransform;
+
+
+/**
+ * Bone 하나의 압축 전 Key 데이터 (UE의 FRawAnimSequenceTrack)
+ * 각 배열은 NumFrames개 이거나, 전체 구간에서 상수면 1개입니다.
+ */
+struct FRawAnimSequenceTrack
+{
+    TArray<FVector> PosKeys;
+    TArray<FQuat> RotKeys;
+    TArray<FVector> ScaleKeys;
+};
+
+/**
+ * Smallest-three 방식으로 48bit에 양자화한 단위 쿼터니언
+ * 가장 큰 성분의 Index(2bit)와 나머지 세 성분(각 15bit, [-1/√2, 1/√2])을 저장합니다.
+ */
+struct FQuat48
+{
+    uint16 Data[3];
+
+    FQuat48() = default;
+    explicit FQuat48(const FQuat& InQuat) { FromQuat(InQuat); }
+
+    void FromQuat(const FQuat& InQuat);
+    FORCEINLINE FQuat ToQuat() const;
+
+    static constexpr float ComponentRange = 0.70710678f; // 1/√2
+    static constexpr uint32 ComponentMax = (1 << 15) - 1;
+};
+
+FORCEINLINE FQuat FQuat48::ToQuat() const
+{
+    const uint64 Packed = (static_cast<uint64>(Data[0]) << 32) | (static_cast<uint64>(Data[1]) << 16) | Data[2];
+
+    const auto Decode = [](uint64 Bits)
+    {
+        return (static_cast<float>(static_cast<uint32>(Bits) & ComponentMax) / ComponentMax * 2.f - 1.f) * ComponentRange;
+    };
+    const float A = Decode(Packed >> 30);
+    const float B = Decode(Packed >> 15);
+    const float C = Decode(Packed);
+    const float Largest = FMath::Sqrt(FMath::Max(1.f - A * A - B * B - C * C, 0.f));
+
+    switch (Packed >> 45)
+    {
+    case 0:  return FQuat(Largest, A, B, C);
+    case 1:  return FQuat(A, Largest, B, C);
+    case 2:  return FQuat(A, B, Largest, C);
+    default: return FQuat(A, B, C, Largest);
+    }
+}
+
+// 압축 데이터 배열 안에서 한 Channel의 Key 구간, NumKeys가 0이면 항등(0, Identity, 1), 1이면 상수
+struct FAnimKeyChannel
+{
+    int32 Offset = 0;
+    int32 NumKeys = 0;
+};
+
+struct FCompressedAnimTrack
+{
+    int32 BoneIndex = INDEX_NONE;
+
+    FAnimKeyChannel Translation;
+    FAnimKeyChannel Rotation;
+    FAnimKeyChannel Scale;
+};
+
+struct FAnimCompressionSettings
+{
+    // Key Reduction에서 허용하는 최대 오차
+    float MaxTranslationError = 0.05f;
+    float MaxRotationError = 0.002f; // Radian
+    float MaxScaleError = 0.001f;
+};
+
+/**
+ * Track 단위로 압축된 애니메이션 데이터
+ *
+ * Channel 종류별로 Key를 한 배열에 모으고, Track은 자신의 Key 구간만 가리킵니다.
+ * Key Reduction으로 남은 Key의 Frame 번호는 같은 Offset의 *Frames 배열에 있습니다.
+ */
+struct FCompressedAnimData
+{
+    int32 NumFrames = 0;
+
+    TArray<FCompressedAnimTrack> Tracks;
+
+    TArray<uint16> TranslationFrames;
+    TArray<FVector> TranslationKeys;
+
+    TArray<uint16> RotationFrames;
+    TArray<FQuat48> RotationKeys;
+
+    TArray<uint16> ScaleFrames;
+    TArray<FVector> ScaleKeys;
+
+    void Empty();
+
+    // Key 데이터가 차지하는 메모리 (Byte)
+    uint64 GetDataSize() const;
+
+    /** 모든 Track의 BoneIndex와 Channel 구간, Key Frame 순서가 유효한지 검사합니다. 파일에서 읽은 데이터는 사용 전에 검사 */
+    bool IsValid() const;
+};
+
+class FAnimationCompression
+{
+public:
+    /**
+     * Raw Track을 압축합니다.
+     * 상수 Channel은 Key 1개(항등이면 0개)로 접고, 회전은 FQuat48로 양자화한 뒤
+     * 선형 보간으로 오차 범위 안에서 복원되는 Key를 제거합니다.
+     */
+    static void Compress(
+        const TArray<FRawAnimSequenceTrack>& RawTracks,
+        const TArray<int32>& TrackBoneIndices,
+        int32 NumFrames,
+        const FAnimCompressionSettings& Settings,
+        FCompressedAnimData& OutData
+    );
+
+    /**
+     * Frame(소수 가능) 위치의 Pose를 OutPose[BoneIndex]에 씁니다.
+     * Track이 없는 Bone은 건드리지 않습니다.
+     * @param bLooping true면 마지막 Frame과 첫 Frame 사이를 보간
+     * @param RequiredBones nullptr가 아니면 값이 0인 Bone의 Track은 건너뜀 (Bone LOD)
+     */
+    static void DecompressPose(
+        const FCompressedAnimData& Data,
+        float Frame,
+        bool bLooping,
+        TArray<FTransform>& OutPose,
+        const TArray<uint8>* RequiredBones = nullptr
+    );
+};
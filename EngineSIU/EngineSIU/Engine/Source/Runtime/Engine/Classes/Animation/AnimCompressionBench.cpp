@@ -0,0 +1,164 @@
+#include "AnimCompression.h"
+
+#include "Container/Map.h"
+#include "Math/Rotator.h"
+#include "Misc/Benchmark.h"
+#include "UserInterface/Console.h"
+
+namespace
+{
+    /** TMap의 Element 배열과 Slot 배열(Slot당 Hash, Index 8 Byte)이 차지하는 메모리 */
+    template <typename KeyType, typename ValueType>
+    uint64 GetMapMemorySize(const TMap<KeyType, ValueType>& Map)
+    {
+        return sizeof(Map)
+            + Map.Num() * sizeof(TPair<KeyType, ValueType>)
+            + Map.GetContainerPrivate().GetNumSlots() * (sizeof(uint32) + sizeof(int32));
+    }
+
+    /**
+     * Count개의 Bone이 움직이는 240 Frame(30fps) Clip을 만들어, 압축된 Track과 이전의 Frame별 TMap 구조를 비교합니다.
+     * 메모리, Pose 샘플링 시간, 그리고 이전 방식(Slerp)에 대한 압축 오차를 출력합니다.
+     */
+    void RunAnimCompressionBenchmark(const FBenchmarkContext& Context)
+    {
+        constexpr int32 NumFrames = 240;
+        constexpr int32 FrameRate = 30;
+        constexpr int32 NumSamples = 10000;
+        const int32 NumBones = Context.Count;
+
+        // 회전은 모든 Bone이, 이동은 4개 중 하나만 움직이고, Scale은 상수
+        TArray<FRawAnimSequenceTrack> RawTracks;
+        TArray<int32> TrackBoneIndices;
+        RawTracks.SetNum(NumBones);
+        for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+        {
+            FRawAnimSequenceTrack& Track = RawTracks[BoneIndex];
+            const float Phase = static_cast<float>(BoneIndex) * 0.37f;
+            for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+            {
+                const float Time = static_cast<float>(Frame) / FrameRate;
+                Track.RotKeys.Add(FRotator(
+                    FMath::Sin(Time * PI + Phase) * 30.f,
+                    FMath::Cos(Time * PI * 0.5f + Phase) * 20.f,
+                    FMath::Sin(Time * PI * 2.f) * 10.f
+                ).Quaternion());
+
+                if (BoneIndex % 4 == 0)
+                {
+                    Track.PosKeys.Add(FVector(FMath::Sin(Time * PI + Phase) * 10.f, 0.f, static_cast<float>(BoneIndex)));
+                }
+            }
+            if (Track.PosKeys.Num() == 0)
+            {
+                Track.PosKeys.Add(FVector(0.f, 0.f, static_cast<float>(BoneIndex)));
+            }
+            Track.ScaleKeys.Add(FVector::OneVector);
+            TrackBoneIndices.Add(BoneIndex);
+        }
+
+        // 이전 구조: Frame마다 BoneIndex -> FTransform
+        TArray<TMap<int32, FTransform>> OldFrames;
+        OldFrames.SetNum(NumFrames);
+        uint64 OldSize = 0;
+        for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+        {
+            TMap<int32, FTransform>& Transforms = OldFrames[Frame];
+            for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+            {
+                const FRawAnimSequenceTrack& Track = RawTracks[BoneIndex];
+                FTransform Transform;
+                Transform.Translation = Track.PosKeys[Track.PosKeys.Num() > 1 ? Frame : 0];
+                Transform.Rotation = Track.RotKeys[Frame];
+                Transform.Scale3D = Track.ScaleKeys[0];
+                Transforms.Add(BoneIndex, Transform);
+            }
+            OldSize += GetMapMemorySize(Transforms);
+        }
+
+        FCompressedAnimData Compressed;
+        const double CompressMs = MeasureMilliseconds([&]
+        {
+            FAnimationCompression::Compress(RawTracks, TrackBoneIndices, NumFrames, FAnimCompressionSettings(), Compressed);
+        });
+
+        TArray<FTransform> OldPose;
+        TArray<FTransform> NewPose;
+        OldPose.SetNum(NumBones);
+        NewPose.SetNum(NumBones);
+
+        // 이전 USkeletalMeshComponent::TickComponent의 샘플링: 두 Frame의 TMap을 복사한 뒤 Bone마다 Blend
+        auto SampleOld = [&](float Frame)
+        {
+            const int32 CurrentKey = static_cast<int32>(Frame) % NumFrames;
+            const int32 NextKey = (CurrentKey + 1) % NumFrames;
+            const float Alpha = Frame - static_cast<float>(static_cast<int32>(Frame));
+
+            TMap<int32, FTransform> CurrentFrameTransforms = OldFrames[CurrentKey];
+            TMap<int32, FTransform> NextFrameTransforms = OldFrames[NextKey];
+            for (auto& [BoneIndex, CurrentTransform] : CurrentFrameTransforms)
+            {
+                if (const FTransform* NextTransform = NextFrameTransforms.Find(BoneIndex))
+                {
+                    OldPose[BoneIndex].Blend(CurrentTransform, *NextTransform, Alpha);
+                }
+                else
+                {
+                    OldPose[BoneIndex] = CurrentTransform;
+                }
+            }
+        };
+
+        auto GetSampleFrame = [](int32 Sample)
+        {
+            return FMath::Fmod(static_cast<float>(Sample) * 0.137f, static_cast<float>(NumFrames));
+        };
+
+        float Checksum = 0.f;
+        auto Measure = [&Context, &Checksum, NumBones](const char* Label, auto&& Body, const TArray<FTransform>& Pose)
+        {
+            Context.Measure(Label, NumSamples, [&]
+            {
+                for (int32 Sample = 0; Sample < NumSamples; ++Sample)
+                {
+                    Body(Sample);
+                    Checksum += Pose[Sample % NumBones].Rotation.W;
+                }
+            }, "pose");
+        };
+
+        Measure("TMap per frame (old)", [&](int32 Sample) { SampleOld(GetSampleFrame(Sample)); }, OldPose);
+        Measure("Compressed tracks", [&](int32 Sample)
+        {
+            FAnimationCompression::DecompressPose(Compressed, GetSampleFrame(Sample), true, NewPose);
+        }, NewPose);
+
+        // 같은 Frame에서 두 방식의 Pose 차이
+        float MaxRotationError = 0.f;
+        float MaxTranslationError = 0.f;
+        for (int32 Sample = 0; Sample < NumFrames * 4; ++Sample)
+        {
+            const float Frame = static_cast<float>(Sample) * 0.25f;
+            SampleOld(Frame);
+            FAnimationCompression::DecompressPose(Compressed, Frame, true, NewPose);
+            for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+            {
+                MaxRotationError = FMath::Max(MaxRotationError, OldPose[BoneIndex].Rotation.AngularDistance(NewPose[BoneIndex].Rotation));
+                MaxTranslationError = FMath::Max(MaxTranslationError, (OldPose[BoneIndex].Translation - NewPose[BoneIndex].Translation).Length());
+            }
+        }
+
+        Context.Console.AddLog(
+            ELogLevel::Display, "Memory: %.1f KB as TMap per frame, %.1f KB compressed (compressed in %.2f ms)",
+            OldSize / 1024.0, Compressed.GetDataSize() / 1024.0, CompressMs
+        );
+        Context.Console.AddLog(
+            ELogLevel::Display, "Anim bench: %d bones, %d frames, max error %.5f rad, %.4f units (checksum %g)",
+            NumBones, NumFrames, MaxRotationError, MaxTranslationError, Checksum
+        );
+    }
+
+    FAutoRegisterBenchmark AnimCompressionBenchmark(
+        "anim bench", "[bones]: Compare compressed animation tracks against the per-frame TMap layout in memory, sampling time and error", 60, &RunAnimCompressionBenchmark
+    );
+}
@@ -0,0 +1,288 @@
+#include "AnimGraph.h"
+
+#include "AnimSequence.h"
+#include "ReferenceSkeleton.h"
+
+
+namespace
+{
+    FORCEINLINE void AccumulateWeighted(FTransform& Accumulated, const FTransform& Pose, float Weight)
+    {
+        Accumulated.Translation += Pose.Translation * Weight;
+        Accumulated.Scale3D += Pose.Scale3D * Weight;
+
+        // 반대 반구의 쿼터니언은 부호를 뒤집어서 최단 경로로 섞음
+        const FQuat& A = Accumulated.Rotation;
+        const FQuat& B = Pose.Rotation;
+        const float Dot = A.X * B.X + A.Y * B.Y + A.Z * B.Z + A.W * B.W;
+        const float RotationWeight = Dot >= 0.f ? Weight : -Weight;
+        Accumulated.Rotation.X += B.X * RotationWeight;
+        Accumulated.Rotation.Y += B.Y * RotationWeight;
+        Accumulated.Rotation.Z += B.Z * RotationWeight;
+        Accumulated.Rotation.W += B.W * RotationWeight;
+    }
+}
+
+
+FAnimGraph::FAnimGraph()
+{
+    AddLayer(EAnimLayerBlendMode::Override);
+}
+
+int32 FAnimGraph::AddLayer(EAnimLayerBlendMode BlendMode, float Weight)
+{
+    FAnimLayer Layer;
+    Layer.BlendMode = BlendMode;
+    Layer.Weight = Weight;
+    return Layers.Add(std::move(Layer));
+}
+
+void FAnimGraph::SetLayerWeight(int32 LayerIndex, float Weight)
+{
+    if (Layers.IsValidIndex(LayerIndex))
+    {
+        Layers[LayerIndex].Weight = FMath::Clamp(Weight, 0.f, 1.f);
+    }
+}
+
+void FAnimGraph::SetLayerBoneMask(int32 LayerIndex, const TArray<float>& BoneMask)
+{
+    if (Layers.IsValidIndex(LayerIndex))
+    {
+        Layers[LayerIndex].BoneMask = BoneMask;
+    }
+}
+
+int32 FAnimGraph::Play(int32 LayerIndex, UAnimSequence* Sequence, float Weight, bool bLooping, float PlayRate)
+{
+    if (!Sequence || !Layers.IsValidIndex(LayerIndex))
+    {
+        return INDEX_NONE;
+    }
+
+    FAnimSequencePlayer Player;
+    Player.Sequence = Sequence;
+    Player.Weight = Weight;
+    Player.bLooping = bLooping;
+    Player.PlayRate = PlayRate;
+    return Layers[LayerIndex].Players.Add(Player);
+}
+
+void FAnimGraph::CrossFade(int32 LayerIndex, UAnimSequence* Sequence, float BlendTime, bool bLooping, float PlayRate)
+{
+    if (!Sequence || !Layers.IsValidIndex(LayerIndex))
+    {
+        return;
+    }
+
+    if (BlendTime <= 0.f)
+    {
+        Layers[LayerIndex].Players.Empty();
+        Play(LayerIndex, Sequence, 1.f, bLooping, PlayRate);
+        return;
+    }
+
+    for (FAnimSequencePlayer& Player : Layers[LayerIndex].Players)
+    {
+        Player.FadeStartWeight = Player.Weight;
+        Player.FadeTargetWeight = 0.f;
+        Player.FadeDuration = BlendTime;
+        Player.FadeElapsed = 0.f;
+    }
+
+    const int32 PlayerIndex = Play(LayerIndex, Sequence, 0.f, bLooping, PlayRate);
+    FAnimSequencePlayer& Player = Layers[LayerIndex].Players[PlayerIndex];
+    Player.FadeStartWeight = 0.f;
+    Player.FadeTargetWeight = 1.f;
+    Player.FadeDuration = BlendTime;
+}
+
+void FAnimGraph::StopLayer(int32 LayerIndex, float BlendTime)
+{
+    if (!Layers.IsValidIndex(LayerIndex))
+    {
+        return;
+    }
+
+    if (BlendTime <= 0.f)
+    {
+        Layers[LayerIndex].Players.Empty();
+        return;
+    }
+
+    for (FAnimSequencePlayer& Player : Layers[LayerIndex].Players)
+    {
+        Player.FadeStartWeight = Player.Weight;
+        Player.FadeTargetWeight = 0.f;
+        Player.FadeDuration = BlendTime;
+        Player.FadeElapsed = 0.f;
+    }
+}
+
+void FAnimGraph::Update(float DeltaTime)
+{
+    for (FAnimLayer& Layer : Layers)
+    {
+        for (FAnimSequencePlayer& Player : Layer.Players)
+        {
+            Player.Time += DeltaTime * Player.PlayRate;
+            if (!Player.bLooping)
+            {
+                Player.Time = FMath::Clamp(Player.Time, 0.f, Player.Sequence->GetPlayLength());
+            }
+
+            if (Player.FadeDuration > 0.f)
+            {
+                Player.FadeElapsed += DeltaTime;
+                const float Alpha = FMath::Min(Player.FadeElapsed / Player.FadeDuration, 1.f);
+                Player.Weight = FMath::Lerp(Player.FadeStartWeight, Player.FadeTargetWeight, Alpha);
+                if (Alpha >= 1.f)
+                {
+                    Player.FadeDuration = 0.f;
+
+                    // Fade-out이 끝난 Sequence는 아래에서 제거
+                    if (Player.FadeTargetWeight <= 0.f)
+                    {
+                        Player.Sequence = nullptr;
+                    }
+                }
+            }
+        }
+
+        Layer.Players.RemoveAll([](const FAnimSequencePlayer& Player)
+        {
+            return Player.Sequence == nullptr;
+        });
+    }
+}
+
+float FAnimGraph::EvaluateLayer(const FAnimLayer& Layer, int32 NumBones, const TArray<uint8>* RequiredBones)
+{
+    float TotalWeight = 0.f;
+    for (const FAnimSequencePlayer& Player : Layer.Players)
+    {
+        TotalWeight += FMath::Max(Player.Weight, 0.f);
+    }
+    if (TotalWeight <= SMALL_NUMBER)
+    {
+        return 0.f;
+    }
+
+    // 합이 1보다 작으면 남은 Weight만큼 아래 Layer의 Pose가 남아야 하므로, LayerPose는 비율로 섞고 합은 반환값으로 합성에 반영
+    // (StopLayer의 Fade-out, Weight < 1로 Play한 Sequence)
+    const float LayerWeight = FMath::Min(TotalWeight, 1.f);
+
+    // Sequence가 하나면 누적 없이 바로 샘플링
+    if (Layer.Players.Num() == 1)
+    {
+        Layer.Players[0].Sequence->GetAnimationPose(Layer.Players[0].Time, LayerPose, Layer.Players[0].bLooping, RequiredBones);
+        return LayerWeight;
+    }
+
+    // N개의 Pose를 정규화한 Weight로 누적한 뒤 회전만 다시 정규화 (Pose 하나당 Bone 배열을 한 번 훑음)
+    const FTransform Zero(FQuat(0.f, 0.f, 0.f, 0.f), FVector::ZeroVector, FVector::ZeroVector);
+    for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+    {
+        LayerPose[BoneIndex] = Zero;
+    }
+
+    for (const FAnimSequencePlayer& Player : Layer.Players)
+    {
+        const float Weight = FMath::Max(Player.Weight, 0.f) / TotalWeight;
+        if (Weight <= 0.f)
+        {
+            continue;
+        }
+
+        Player.Sequence->GetAnimationPose(Player.Time, SamplePose, Player.bLooping, RequiredBones);
+        for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+        {
+            AccumulateWeighted(LayerPose[BoneIndex], SamplePose[BoneIndex], Weight);
+        }
+    }
+
+    for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+    {
+        LayerPose[BoneIndex].Rotation.Normalize();
+    }
+    return LayerWeight;
+}
+
+void FAnimGraph::Evaluate(TArray<FTransform>& OutPose, const TArray<uint8>* RequiredBones)
+{
+    const int32 NumBones = OutPose.Num();
+    SamplePose.SetNum(NumBones);
+    LayerPose.SetNum(NumBones);
+
+    for (FTransform& Transform : OutPose)
+    {
+        Transform = FTransform::Identity;
+    }
+
+    for (const FAnimLayer& Layer : Layers)
+    {
+        if (Layer.Weight <= 0.f)
+        {
+            continue;
+        }
+        const float LayerAlpha = Layer.Weight * EvaluateLayer(Layer, NumBones, RequiredBones);
+        if (LayerAlpha <= 0.f)
+        {
+            continue;
+        }
+
+        const bool bHasMask = Layer.BoneMask.Num() > 0;
+        for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+        {
+            if (RequiredBones && !(RequiredBones->IsValidIndex(BoneIndex) && (*RequiredBones)[BoneIndex]))
+            {
+                continue;
+            }
+
+            float Alpha = LayerAlpha;
+            if (bHasMask)
+            {
+                Alpha *= Layer.BoneMask.IsValidIndex(BoneIndex) ? Layer.BoneMask[BoneIndex] : 0.f;
+            }
+            if (Alpha <= 0.f)
+            {
+                continue;
+            }
+
+            if (Layer.BlendMode == EAnimLayerBlendMode::Additive)
+            {
+                FTransform::BlendFromIdentityAndAccumulate(OutPose[BoneIndex], LayerPose[BoneIndex], Alpha);
+            }
+            else if (Alpha >= 1.f)
+            {
+                OutPose[BoneIndex] = LayerPose[BoneIndex];
+            }
+            else
+            {
+                OutPose[BoneIndex].Blend(OutPose[BoneIndex], LayerPose[BoneIndex], Alpha);
+            }
+        }
+    }
+}
+
+void FAnimGraph::BuildBranchMask(const FReferenceSkeleton& RefSkeleton, const FName& BranchRootBone, TArray<float>& OutBoneMask)
+{
+    const int32 NumBones = RefSkeleton.RawRefBoneInfo.Num();
+    const int32 RootIndex = RefSkeleton.FindBoneIndex(BranchRootBone);
+    OutBoneMask.Init(0.f, NumBones);
+    if (RootIndex == INDEX_NONE)
+    {
+        return;
+    }
+
+    // 부모 Bone의 Index가 항상 자식보다 작으므로 한 번 훑으면 됨
+    OutBoneMask[RootIndex] = 1.f;
+    for (int32 BoneIndex = RootIndex + 1; BoneIndex < NumBones; ++BoneIndex)
+    {
+        const int32 ParentIndex = RefSkeleton.RawRefBoneInfo[BoneIndex].ParentIndex;
+        if (ParentIndex != INDEX_NONE && OutBoneMask[ParentIndex] > 0.f)
+        {
+            OutBoneMask[BoneIndex] = 1.f;
+        }
+    }
+}
@@ -0,0 +1,110 @@
+#pragma once
+#include "Container/Array.h"
+#include "HAL/PlatformType.h"
+#include "Math/Transform.h"
+
+class UAnimSequence;
+class FName;
+struct FReferenceSkeleton;
+
+
+enum class EAnimLayerBlendMode : uint8
+{
+    // 아래 Layer의 Pose를 Weight만큼 이 Layer의 Pose로 덮어씀
+    Override,
+
+    // 아래 Layer의 Pose 위에 이 Layer의 Pose를 Weight만큼 누적
+    Additive,
+};
+
+/** Layer 안에서 재생 중인 Sequence 하나 */
+struct FAnimSequencePlayer
+{
+    UAnimSequence* Sequence = nullptr;
+
+    float Time = 0.f;
+    float PlayRate = 1.f;
+    bool bLooping = true;
+
+    float Weight = 1.f;
+
+    // Cross-fade 중이면 FadeDuration > 0, 끝나면 Weight가 FadeTargetWeight가 됨
+    float FadeStartWeight = 0.f;
+    float FadeTargetWeight = 0.f;
+    float FadeDuration = 0.f;
+    float FadeElapsed = 0.f;
+};
+
+struct FAnimLayer
+{
+    EAnimLayerBlendMode BlendMode = EAnimLayerBlendMode::Override;
+
+    float Weight = 1.f;
+
+    // Bone별 Weight [0, 1], 비어 있으면 모든 Bone이 1
+    TArray<float> BoneMask;
+
+    // 같은 Layer의 Sequence는 Weight 비율로 섞이고, Weight 합이 1보다 작으면 나머지는 아래 Layer의 Pose
+    TArray<FAnimSequencePlayer> Players;
+};
+
+/**
+ * Component 하나의 애니메이션 Layer들
+ *
+ * Layer 0은 Base Layer이고, 위 Layer부터 차례로 Override/Additive로 합성합니다.
+ * Pose는 Bone 수 크기의 평평한 FTransform 배열(Bind Pose 기준 Local Transform)이며,
+ * Layer 하나를 합성하는 것은 Bone 배열을 한 번 훑는 작업입니다.
+ */
+class FAnimGraph
+{
+public:
+    FAnimGraph();
+
+    int32 AddLayer(EAnimLayerBlendMode BlendMode, float Weight = 1.f);
+
+    int32 GetNumLayers() const { return Layers.Num(); }
+    FAnimLayer& GetLayer(int32 LayerIndex) { return Layers[LayerIndex]; }
+    const FAnimLayer& GetLayer(int32 LayerIndex) const { return Layers[LayerIndex]; }
+
+    void SetLayerWeight(int32 LayerIndex, float Weight);
+    void SetLayerBoneMask(int32 LayerIndex, const TArray<float>& BoneMask);
+
+    /**
+     * Layer에 Sequence를 추가합니다. 이미 재생 중인 Sequence와 Weight 비율로 섞입니다.
+     * Layer의 Weight 합이 1보다 작으면 그만큼만 아래 Layer(Base Layer는 Bind Pose) 위에 합성됩니다.
+     * @return Layer 안에서의 Player Index
+     */
+    int32 Play(int32 LayerIndex, UAnimSequence* Sequence, float Weight = 1.f, bool bLooping = true, float PlayRate = 1.f);
+
+    /** BlendTime 동안 Layer의 다른 Sequence를 줄이고 Sequence를 올립니다. 다 줄어든 Sequence는 제거됩니다. */
+    void CrossFade(int32 LayerIndex, UAnimSequence* Sequence, float BlendTime, bool bLooping = true, float PlayRate = 1.f);
+
+    /** BlendTime 동안 Layer의 모든 Sequence를 줄여서 제거합니다. */
+    void StopLayer(int32 LayerIndex, float BlendTime = 0.f);
+
+    /** 재생 시간과 Cross-fade를 진행합니다. */
+    void Update(float DeltaTime);
+
+    /**
+     * 모든 Layer를 합성한 Pose를 OutPose에 씁니다.
+     * OutPose의 크기는 호출하는 쪽의 Bone 수를 따르며, 내부 버퍼는 다음 호출에서 재사용됩니다.
+     * @param RequiredBones nullptr가 아니면 값이 0인 Bone은 계산하지 않고 Identity로 둠 (Bone LOD)
+     */
+    void Evaluate(TArray<FTransform>& OutPose, const TArray<uint8>* RequiredBones = nullptr);
+
+    /** BranchRootBone과 그 자식 Bone은 1, 나머지는 0인 Bone Mask를 만듭니다. */
+    static void BuildBranchMask(const FReferenceSkeleton& RefSkeleton, const FName& BranchRootBone, TArray<float>& OutBoneMask);
+
+private:
+    /**
+     * Layer의 Sequence들을 Weight 비율로 섞어서 LayerPose에 씁니다.
+     * @return Sequence Weight의 합을 1로 자른 값, Layer.Weight와 곱해서 합성함 (0이면 LayerPose를 쓰지 않음)
+     */
+    float EvaluateLayer(const FAnimLayer& Layer, int32 NumBones, const TArray<uint8>* RequiredBones);
+
+    TArray<FAnimLayer> Layers;
+
+    // Evaluate에서 재사용하는 Pose 버퍼
+    TArray<FTransform> SamplePose;
+    TArray<FTransform> LayerPose;
+};
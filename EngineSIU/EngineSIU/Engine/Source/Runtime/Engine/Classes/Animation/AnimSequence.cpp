@@ -1,70 +1,175 @@
-
 #include "AnimSequence.h"
 
 #include "Math/Transform.h"
+#include "Serialization/Archive.h"
+#include "Serialization/Serializer.h"
 
-UAnimSequence::UAnimSequence()
+void UAnimSequence::InitializeTestAnimation()
 {
+    NumFrames = 240;
+    FrameRate = 30;
+
+    TArray<int32> TrackBoneIndices = { 0, 8, 9, 32, 33, 55, 56, 60, 61 };
+
+    TArray<FRawAnimSequenceTrack> RawTracks;
+    RawTracks.SetNum(TrackBoneIndices.Num());
+
     for (int32 i = 0; i < NumFrames; ++i)
     {
-        TMap<int32, FTransform> Track;
-        
-        for (int32 j = 8; j < 10; ++j)
-        {
-            FTransform TF;
-            TF.Rotation = FRotator(
-                    0.f,
-                    0.f,
-                    (FMath::Sin((static_cast<float>(i) / FrameRate) * PI * 1.f) - 1.f) * 30.f
-                ).Quaternion();
-            Track.Add(j, TF);
-        }
-        Track[8].Rotation = FRotator(-70.f, 0.f, 30.f).Quaternion() * Track[8].Rotation;
-        
-        for (int32 j = 32; j < 34; ++j)
-        {
-            FTransform TF;
-            TF.Rotation = FRotator(
-                    0.f,
-                    0.f,
-                    (FMath::Sin((static_cast<float>(i) / FrameRate) * PI * 1.f) + 1.f) * 30.f
-                ).Quaternion();
-            Track.Add(j, TF);
-        }
-        Track[32].Rotation = FRotator(-70.f, 00.f, -30.f).Quaternion() * Track[32].Rotation;
-        
-        for (int32 j = 60; j < 62; ++j)
-        {
-            FTransform TF;
-            TF.Rotation = FRotator(
-                    (FMath::Sin((static_cast<float>(i) / FrameRate) * PI * 1.f) + 1.0f) * 30.f,
-                    0.f,
-                    0.f
-                ).Quaternion();
-            Track.Add(j, TF);
-        }
-        Track[60].Rotation = FRotator(-30.f, 0.f, 0.f).Quaternion() * Track[60].Rotation;
-        
-        for (int32 j = 55; j < 57; ++j)
-        {
-            FTransform TF;
-            TF.Rotation = FRotator(
-                    (FMath::Sin((static_cast<float>(i) / FrameRate) * PI * 1.f) - 1.0f) * -30.f,
-                    0.f,
-                    0.f
-                ).Quaternion();
-            Track.Add(j, TF);
-        }
-        Track[55].Rotation = FRotator(-30.f, 0.f, 0.f).Quaternion() * Track[55].Rotation;
+        const float Wave = FMath::Sin((static_cast<float>(i) / FrameRate) * PI * 1.f);
 
-        FTransform TF;
-        TF.Translation = FVector(
+        RawTracks[0].PosKeys.Add(FVector(
                 0.f,
                 0.f,
                 (FMath::Sin((static_cast<float>(i) / FrameRate) * PI * 2.f + 1.f) + 1.0f) * 2.f
-            );
-        Track.Add(0, TF);
+            ));
+
+        const FQuat Bone8 = FRotator(0.f, 0.f, (Wave - 1.f) * 30.f).Quaternion();
+        RawTracks[1].RotKeys.Add(FRotator(-70.f, 0.f, 30.f).Quaternion() * Bone8);
+        RawTracks[2].RotKeys.Add(Bone8);
+
+        const FQuat Bone32 = FRotator(0.f, 0.f, (Wave + 1.f) * 30.f).Quaternion();
+        RawTracks[3].RotKeys.Add(FRotator(-70.f, 00.f, -30.f).Quaternion() * Bone32);
+        RawTracks[4].RotKeys.Add(Bone32);
+
+        const FQuat Bone55 = FRotator((Wave - 1.0f) * -30.f, 0.f, 0.f).Quaternion();
+        RawTracks[5].RotKeys.Add(FRotator(-30.f, 0.f, 0.f).Quaternion() * Bone55);
+        RawTracks[6].RotKeys.Add(Bone55);
+
+        const FQuat Bone60 = FRotator((Wave + 1.0f) * 30.f, 0.f, 0.f).Quaternion();
+        RawTracks[7].RotKeys.Add(FRotator(-30.f, 0.f, 0.f).Quaternion() * Bone60);
+        RawTracks[8].RotKeys.Add(Bone60);
+    }
+
+    SetAnimationData(RawTracks, TrackBoneIndices, NumFrames, FrameRate);
+}
+
+void UAnimSequence::SetAnimationData(
+    const TArray<FRawAnimSequenceTrack>& RawTracks,
+    const TArray<int32>& TrackBoneIndices,
+    int32 InNumFrames,
+    int32 InFrameRate,
+    const FAnimCompressionSettings& Settings
+)
+{
+    NumFrames = InNumFrames;
+    FrameRate = InFrameRate;
+
+    FAnimationCompression::Compress(RawTracks, TrackBoneIndices, NumFrames, Settings, CompressedData);
+}
+
+void UAnimSequence::GetAnimationPose(float Time, TArray<FTransform>& OutPose, bool bLooping, const TArray<uint8>* RequiredBones) const
+{
+    for (FTransform& Transform : OutPose)
+    {
+        Transform = FTransform::Identity;
+    }
+
+    if (NumFrames <= 0)
+    {
+        return;
+    }
 
-        Anim.Add(Track);
+    float Frame = Time * static_cast<float>(FrameRate);
+    if (bLooping)
+    {
+        Frame = FMath::Fmod(Frame, static_cast<float>(NumFrames));
+        if (Frame < 0.f)
+        {
+            Frame += static_cast<float>(NumFrames);
+        }
+    }
+
+    FAnimationCompression::DecompressPose(CompressedData, Frame, bLooping, OutPose, RequiredBones);
+}
+
+bool UAnimSequence::SaveToBinary(const FWString& FilePath) const
+{
+    std::ofstream File(FilePath, std::ios::binary);
+    if (!File.is_open())
+    {
+        return false;
+    }
+
+    File.write(reinterpret_cast<const char*>(&BinaryMagic), sizeof(BinaryMagic));
+    File.write(reinterpret_cast<const char*>(&BinaryVersion), sizeof(BinaryVersion));
+
+    File.write(reinterpret_cast<const char*>(&FrameRate), sizeof(FrameRate));
+    File.write(reinterpret_cast<const char*>(&NumFrames), sizeof(NumFrames));
+
+    File.write(reinterpret_cast<const char*>(&CompressedData.NumFrames), sizeof(CompressedData.NumFrames));
+    Serializer::WriteArray(File, CompressedData.Tracks);
+    Serializer::WriteArray(File, CompressedData.TranslationFrames);
+    Serializer::WriteArray(File, CompressedData.TranslationKeys);
+    Serializer::WriteArray(File, CompressedData.RotationFrames);
+    Serializer::WriteArray(File, CompressedData.RotationKeys);
+    Serializer::WriteArray(File, CompressedData.ScaleFrames);
+    Serializer::WriteArray(File, CompressedData.ScaleKeys);
+
+    return static_cast<bool>(File);
+}
+
+bool UAnimSequence::LoadFromBinary(const FWString& FilePath)
+{
+    std::ifstream File(FilePath, std::ios::binary);
+    if (!File.is_open())
+    {
+        return false;
+    }
+
+    uint32 Magic = 0;
+    uint32 Version = 0;
+    File.read(reinterpret_cast<char*>(&Magic), sizeof(Magic));
+    File.read(reinterpret_cast<char*>(&Version), sizeof(Version));
+    if (!File || Magic != BinaryMagic || Version != BinaryVersion)
+    {
+        return false;
+    }
+
+    FCompressedAnimData Data;
+    int32 InFrameRate = 0;
+    int32 InNumFrames = 0;
+    File.read(reinterpret_cast<char*>(&InFrameRate), sizeof(InFrameRate));
+    File.read(reinterpret_cast<char*>(&InNumFrames), sizeof(InNumFrames));
+    File.read(reinterpret_cast<char*>(&Data.NumFrames), sizeof(Data.NumFrames));
+
+    const bool bSuccess = File
+        && Serializer::ReadArray(File, Data.Tracks)
+        && Serializer::ReadArray(File, Data.TranslationFrames)
+        && Serializer::ReadArray(File, Data.TranslationKeys)
+        && Serializer::ReadArray(File, Data.RotationFrames)
+        && Serializer::ReadArray(File, Data.RotationKeys)
+        && Serializer::ReadArray(File, Data.ScaleFrames)
+        && Serializer::ReadArray(File, Data.ScaleKeys);
+    if (!bSuccess || !Data.IsValid())
+    {
+        return false;
+    }
+
+    FrameRate = InFrameRate;
+    NumFrames = InNumFrames;
+    CompressedData = std::move(Data);
+    return true;
+}
+
+void UAnimSequence::Serialize(FArchive& Ar)
+{
+    Ar << FrameRate << NumFrames;
+
+    Ar << CompressedData.NumFrames;
+    BulkSerialize(Ar, CompressedData.Tracks);
+    BulkSerialize(Ar, CompressedData.TranslationFrames);
+    BulkSerialize(Ar, CompressedData.TranslationKeys);
+    BulkSerialize(Ar, CompressedData.RotationFrames);
+    BulkSerialize(Ar, CompressedData.RotationKeys);
+    BulkSerialize(Ar, CompressedData.ScaleFrames);
+    BulkSerialize(Ar, CompressedData.ScaleKeys);
+
+    // 깨진 데이터로 Pose를 샘플링하면 Key 배열 밖을 읽으므로, 애니메이션이 없는 것으로 취급
+    if (Ar.IsLoading() && !CompressedData.IsValid())
+    {
+        UE_LOG(ELogLevel::Error, TEXT("Invalid compressed animation data in '%s'"), *GetName());
+        CompressedData.Empty();
+        NumFrames = 0;
     }
 }
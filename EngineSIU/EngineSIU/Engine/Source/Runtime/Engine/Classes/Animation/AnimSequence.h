@@ -1,22 +1,59 @@
 #pragma once
+#include "AnimCompression.h"
 #include "UObject/Object.h"
 #include "UObject/ObjectMacros.h"
 
 struct FTransform;
 
-// TODO: 임시로 만든 클래스
 class UAnimSequence : public UObject
 {
     DECLARE_CLASS(UAnimSequence, UObject)
 
 public:
-    UAnimSequence();
+    UAnimSequence() = default;
     virtual ~UAnimSequence() override = default;
 
-    // TODO: 맵의 key는 int가 아니라 fname이어야 함.
-    TArray<TMap<int32, FTransform>> Anim;
+    // TODO: 임시 애니메이션, Import한 Sequence가 없는 Mesh에서 사용
+    void InitializeTestAnimation();
+
+    /**
+     * Bone별 Raw Track을 압축해서 저장합니다. Raw 데이터는 보관하지 않습니다.
+     * @param TrackBoneIndices RawTracks[i]가 움직이는 Bone의 Index
+     */
+    void SetAnimationData(
+        const TArray<FRawAnimSequenceTrack>& RawTracks,
+        const TArray<int32>& TrackBoneIndices,
+        int32 InNumFrames,
+        int32 InFrameRate,
+        const FAnimCompressionSettings& Settings = FAnimCompressionSettings()
+    );
+
+    /**
+     * Time(초) 위치의 Pose를 샘플링합니다.
+     * OutPose의 크기는 호출하는 쪽의 Bone 수를 따르며, Track이 없는 Bone은 Identity가 됩니다.
+     * @param RequiredBones nullptr가 아니면 값이 0인 Bone은 샘플링하지 않고 Identity로 둠
+     */
+    void GetAnimationPose(float Time, TArray<FTransform>& OutPose, bool bLooping = true, const TArray<uint8>* RequiredBones = nullptr) const;
+
+    float GetPlayLength() const { return FrameRate > 0 ? static_cast<float>(NumFrames) / static_cast<float>(FrameRate) : 0.f; }
+
+    const FCompressedAnimData& GetCompressedData() const { return CompressedData; }
+
+    /** 압축된 데이터를 그대로 .anim 파일에 씁니다. 읽을 때 FBX SDK가 필요 없습니다. */
+    bool SaveToBinary(const FWString& FilePath) const;
+
+    bool LoadFromBinary(const FWString& FilePath);
+
+    /** Frame 정보와 압축된 데이터를 직렬화합니다. Cooked Cache에서 사용 */
+    virtual void Serialize(FArchive& Ar) override;
+
+    static constexpr uint32 BinaryMagic = 0x4D494E41; // "ANIM"
+    static constexpr uint32 BinaryVersion = 1;
 
     int32 FrameRate = 30;
 
-    int32 NumFrames = 240;
+    int32 NumFrames = 0;
+
+private:
+    FCompressedAnimData CompressedData;
 };
@@ -0,0 +1,83 @@
+#include "AnimationLOD.h"
+
+#include "ReferenceSkeleton.h"
+
+
+FAnimLODSettings FAnimationLOD::Settings;
+FVector FAnimationLOD::ViewLocation = FVector::ZeroVector;
+float FAnimationLOD::HalfFOVTan = 0.f;
+FAnimationLOD::FAtomicStats FAnimationLOD::CurrentStats;
+FAnimLODStats FAnimationLOD::LastFrameStats;
+
+
+void FAnimationLOD::SetView(const FVector& InViewLocation, float InFOV)
+{
+    ViewLocation = InViewLocation;
+    HalfFOVTan = FMath::Tan(FMath::DegreesToRadians(InFOV) * 0.5f);
+}
+
+void FAnimationLOD::ClearView()
+{
+    HalfFOVTan = 0.f;
+}
+
+void FAnimationLOD::BeginFrame()
+{
+    LastFrameStats.NumTickedComponents = CurrentStats.NumTickedComponents.exchange(0, std::memory_order_relaxed);
+    LastFrameStats.NumEvaluatedComponents = CurrentStats.NumEvaluatedComponents.exchange(0, std::memory_order_relaxed);
+    LastFrameStats.NumInterpolatedComponents = CurrentStats.NumInterpolatedComponents.exchange(0, std::memory_order_relaxed);
+    LastFrameStats.NumEvaluatedBones = CurrentStats.NumEvaluatedBones.exchange(0, std::memory_order_relaxed);
+    LastFrameStats.NumSkippedBones = CurrentStats.NumSkippedBones.exchange(0, std::memory_order_relaxed);
+}
+
+float FAnimationLOD::ComputeScreenSize(const FVector& Center, float Radius)
+{
+    if (HalfFOVTan <= 0.f)
+    {
+        return 1.f;
+    }
+
+    // 투영 평면에서의 반지름 / 화면 절반 높이
+    const float Distance = FMath::Max((Center - ViewLocation).Length(), 1.f);
+    return Radius / (Distance * HalfFOVTan);
+}
+
+int32 FAnimationLOD::GetLODLevel(float ScreenSize)
+{
+    if (!Settings.bEnabled)
+    {
+        return 0;
+    }
+
+    int32 LODLevel = 0;
+    while (LODLevel < FAnimLODSettings::NumLODs - 1 && ScreenSize < Settings.ScreenSizes[LODLevel])
+    {
+        ++LODLevel;
+    }
+    return LODLevel;
+}
+
+int32 FAnimationLOD::BuildNonLeafRequiredBones(const FReferenceSkeleton& RefSkeleton, TArray<uint8>& OutRequiredBones)
+{
+    const int32 NumBones = RefSkeleton.RawRefBoneInfo.Num();
+    OutRequiredBones.Init(0, NumBones);
+
+    int32 NumRequiredBones = 0;
+    for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+    {
+        const int32 ParentIndex = RefSkeleton.RawRefBoneInfo[BoneIndex].ParentIndex;
+        if (ParentIndex != INDEX_NONE && !OutRequiredBones[ParentIndex])
+        {
+            OutRequiredBones[ParentIndex] = 1;
+            ++NumRequiredBones;
+        }
+    }
+    return NumRequiredBones;
+}
+
+void FAnimationLOD::AddEvaluatedComponent(int32 NumBones, int32 NumSkippedBones)
+{
+    CurrentStats.NumEvaluatedComponents.fetch_add(1, std::memory_order_relaxed);
+    CurrentStats.NumEvaluatedBones.fetch_add(NumBones, std::memory_order_relaxed);
+    CurrentStats.NumSkippedBones.fetch_add(NumSkippedBones, std::memory_order_relaxed);
+}
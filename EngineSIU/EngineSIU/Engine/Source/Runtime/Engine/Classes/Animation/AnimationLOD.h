@@ -0,0 +1,106 @@
+#pragma once
+#include <atomic>
+
+#include "Container/Array.h"
+#include "HAL/PlatformType.h"
+#include "Math/Vector.h"
+
+struct FReferenceSkeleton;
+
+
+/**
+ * 화면 크기별 애니메이션 LOD 설정
+ * LOD 0이 가장 가깝고, ScreenSizes[i]보다 작아지면 LOD i + 1을 사용합니다.
+ */
+struct FAnimLODSettings
+{
+    static constexpr int32 NumLODs = 4;
+
+    // Bounds 지름이 화면 높이에서 차지하는 비율
+    float ScreenSizes[NumLODs - 1] = { 0.4f, 0.15f, 0.05f };
+
+    // 몇 프레임마다 Pose를 계산할지
+    int32 UpdateRates[NumLODs] = { 1, 2, 4, 8 };
+
+    // 이 LOD부터 자식이 없는 Bone은 계산하지 않고 Bind Pose로 둠
+    int32 LeafBoneLOD = 2;
+
+    // Pose를 건너뛰는 프레임에 이전 Pose와 새 Pose 사이를 보간
+    bool bInterpolate = true;
+
+    bool bEnabled = true;
+};
+
+/** 이전 프레임에 Tick한 애니메이션 Component 통계 */
+struct FAnimLODStats
+{
+    uint32 NumTickedComponents = 0;
+
+    // Pose를 새로 계산한 Component
+    uint32 NumEvaluatedComponents = 0;
+
+    // 마지막으로 계산한 두 Pose 사이를 보간한 Component
+    uint32 NumInterpolatedComponents = 0;
+
+    // Pose를 계산한 Bone 수의 합
+    uint32 NumEvaluatedBones = 0;
+
+    // Bone LOD로 건너뛴 Bone 수의 합
+    uint32 NumSkippedBones = 0;
+};
+
+/**
+ * Active Viewport 카메라를 기준으로 애니메이션 LOD를 고르고, 프레임별 통계를 모읍니다.
+ *
+ * View는 Main Thread에서 World Tick 전에 설정하고, Component의 Tick은 Worker Thread에서 읽기만 합니다.
+ * 통계는 원자적으로 누적한 뒤 BeginFrame에서 이전 프레임 값으로 옮깁니다.
+ */
+class FAnimationLOD
+{
+public:
+    static void SetView(const FVector& InViewLocation, float InFOV);
+
+    // View가 없거나 직교 투영이면 모든 Component를 LOD 0으로 계산
+    static void ClearView();
+
+    /** 이전 프레임 통계를 확정하고 이번 프레임 통계를 0으로 되돌립니다. Main Thread에서 호출 */
+    static void BeginFrame();
+
+    /** 구의 지름이 화면 높이에서 차지하는 비율, View가 없으면 1 */
+    static float ComputeScreenSize(const FVector& Center, float Radius);
+
+    static int32 GetLODLevel(float ScreenSize);
+
+    static int32 GetUpdateRate(int32 LODLevel) { return Settings.bEnabled ? Settings.UpdateRates[LODLevel] : 1; }
+
+    static bool ShouldSkipLeafBones(int32 LODLevel) { return Settings.bEnabled && LODLevel >= Settings.LeafBoneLOD; }
+
+    /** 자식이 있는 Bone만 1인 Required Bone 배열을 만듭니다. @return 1인 Bone 수 */
+    static int32 BuildNonLeafRequiredBones(const FReferenceSkeleton& RefSkeleton, TArray<uint8>& OutRequiredBones);
+
+    static void AddTickedComponent() { CurrentStats.NumTickedComponents.fetch_add(1, std::memory_order_relaxed); }
+    static void AddEvaluatedComponent(int32 NumBones, int32 NumSkippedBones);
+    static void AddInterpolatedComponent() { CurrentStats.NumInterpolatedComponents.fetch_add(1, std::memory_order_relaxed); }
+
+    static const FAnimLODStats& GetLastFrameStats() { return LastFrameStats; }
+
+    static FAnimLODSettings Settings;
+
+private:
+    struct FAtomicStats
+    {
+        std::atomic<uint32> NumTickedComponents = 0;
+        std::atomic<uint32> NumEvaluatedComponents = 0;
+        std::atomic<uint32> NumInterpolatedComponents = 0;
+        std::atomic<uint32> NumEvaluatedBones = 0;
+        std::atomic<uint32> NumSkippedBones = 0;
+    };
+
+    static FVector ViewLocation;
+
+    // tan(FOV / 2), 0이면 View 없음
+    static float HalfFOVTan;
+
+    static FAtomicStats CurrentStats;
+    static FAnimLODStats LastFrameStats;
+};
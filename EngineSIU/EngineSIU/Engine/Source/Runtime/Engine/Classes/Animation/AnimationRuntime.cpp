@@ -0,0 +1,198 @@
+#include "AnimationRuntime.h"
+
+#include "ReferenceSkeleton.h"
+#include "Math/MathSSE.h"
+#include "Math/Matrix.h"
+#include "Math/Transform.h"
+
+using namespace SSE;
+
+
+namespace
+{
+    // 레지스터에 올린 FTransform, Translation과 Scale의 W 요소는 0
+    struct FTransformVectorized
+    {
+        VectorRegister4Float Rotation;
+        VectorRegister4Float Translation;
+        VectorRegister4Float Scale;
+    };
+
+    FORCEINLINE FTransformVectorized LoadTransform(const FTransform& Transform)
+    {
+        FTransformVectorized Result;
+        Result.Rotation = _mm_loadu_ps(&Transform.Rotation.X);
+        Result.Translation = VectorSet(Transform.Translation.X, Transform.Translation.Y, Transform.Translation.Z, 0.f);
+        Result.Scale = VectorSet(Transform.Scale3D.X, Transform.Scale3D.Y, Transform.Scale3D.Z, 0.f);
+        return Result;
+    }
+
+    // Local * Parent, Local을 먼저 적용한 뒤 Parent를 적용
+    FORCEINLINE FTransformVectorized Compose(const FTransformVectorized& Local, const FTransformVectorized& Parent)
+    {
+        FTransformVectorized Result;
+        Result.Rotation = VectorQuaternionMultiply(Parent.Rotation, Local.Rotation);
+        Result.Translation = VectorAdd(VectorQuaternionRotateVector(Parent.Rotation, VectorMultiply(Parent.Scale, Local.Translation)), Parent.Translation);
+        Result.Scale = VectorMultiply(Parent.Scale, Local.Scale);
+        return Result;
+    }
+
+    struct FMatrixVectorized
+    {
+        VectorRegister4Float Rows[4];
+    };
+
+    // FTransform::ToMatrixWithScale과 같은 행렬
+    FORCEINLINE FMatrixVectorized ToMatrix(const FTransformVectorized& Transform)
+    {
+        const VectorRegister4Float MaskXYZ = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+        const VectorRegister4Float& Q = Transform.Rotation;
+
+        const VectorRegister4Float Q2 = VectorAdd(Q, Q);                                  // (2x, 2y, 2z, 2w)
+        const VectorRegister4Float QQ2 = VectorBitwiseAnd(VectorMultiply(Q, Q2), MaskXYZ); // (2xx, 2yy, 2zz, 0)
+
+        // (1 - 2(yy + zz), 1 - 2(xx + zz), 1 - 2(xx + yy), 0)
+        VectorRegister4Float Diagonal = VectorSubtract(_mm_setr_ps(1.f, 1.f, 1.f, 0.f), _mm_shuffle_ps(QQ2, QQ2, SHUFFLEMASK(1, 0, 0, 3)));
+        Diagonal = VectorSubtract(Diagonal, _mm_shuffle_ps(QQ2, QQ2, SHUFFLEMASK(2, 2, 1, 3)));
+
+        const VectorRegister4Float XZ_XY_YZ = VectorMultiply(_mm_shuffle_ps(Q, Q, SHUFFLEMASK(0, 0, 1, 3)), _mm_shuffle_ps(Q2, Q2, SHUFFLEMASK(2, 1, 2, 3)));
+        const VectorRegister4Float WY_WZ_WX = VectorMultiply(VectorReplicate(Q, 3), _mm_shuffle_ps(Q2, Q2, SHUFFLEMASK(1, 2, 0, 3)));
+        const VectorRegister4Float Sum = VectorAdd(XZ_XY_YZ, WY_WZ_WX);      // (xz + wy, xy + wz, yz + wx)
+        const VectorRegister4Float Diff = VectorSubtract(XZ_XY_YZ, WY_WZ_WX); // (xz - wy, xy - wz, yz - wx)
+
+        const VectorRegister4Float A = _mm_shuffle_ps(Sum, Diff, SHUFFLEMASK(1, 2, 0, 1)); // (xy + wz, yz + wx, xz - wy, xy - wz)
+        const VectorRegister4Float B = _mm_shuffle_ps(Sum, Diff, SHUFFLEMASK(0, 0, 2, 2)); // (xz + wy, xz + wy, yz - wx, yz - wx)
+
+        VectorRegister4Float Row0 = _mm_shuffle_ps(Diagonal, A, SHUFFLEMASK(0, 3, 0, 2));
+        Row0 = _mm_shuffle_ps(Row0, Row0, SHUFFLEMASK(0, 2, 3, 1));
+        VectorRegister4Float Row1 = _mm_shuffle_ps(Diagonal, A, SHUFFLEMASK(1, 3, 3, 1));
+        Row1 = _mm_shuffle_ps(Row1, Row1, SHUFFLEMASK(2, 0, 3, 1));
+        const VectorRegister4Float Row2 = _mm_shuffle_ps(B, Diagonal, SHUFFLEMASK(0, 2, 2, 3));
+
+        FMatrixVectorized Result;
+        Result.Rows[0] = VectorMultiply(Row0, VectorReplicate(Transform.Scale, 0));
+        Result.Rows[1] = VectorMultiply(Row1, VectorReplicate(Transform.Scale, 1));
+        Result.Rows[2] = VectorMultiply(Row2, VectorReplicate(Transform.Scale, 2));
+        Result.Rows[3] = VectorAdd(Transform.Translation, _mm_setr_ps(0.f, 0.f, 0.f, 1.f));
+        return Result;
+    }
+
+    FORCEINLINE FMatrixVectorized LoadMatrix(const FMatrix& Matrix)
+    {
+        const VectorRegister4Float* Rows = reinterpret_cast<const VectorRegister4Float*>(&Matrix);
+        return { { Rows[0], Rows[1], Rows[2], Rows[3] } };
+    }
+
+    FORCEINLINE void StoreMatrix(const FMatrixVectorized& Matrix, FMatrix& OutMatrix)
+    {
+        VectorRegister4Float* Out = reinterpret_cast<VectorRegister4Float*>(&OutMatrix);
+        Out[0] = Matrix.Rows[0];
+        Out[1] = Matrix.Rows[1];
+        Out[2] = Matrix.Rows[2];
+        Out[3] = Matrix.Rows[3];
+    }
+
+    FORCEINLINE FMatrixVectorized MultiplyMatrix(const FMatrixVectorized& Matrix1, const FMatrixVectorized& Matrix2)
+    {
+        FMatrixVectorized Result;
+        for (int32 Row = 0; Row < 4; ++Row)
+        {
+            VectorRegister4Float Temp = VectorMultiply(VectorReplicate(Matrix1.Rows[Row], 0), Matrix2.Rows[0]);
+            Temp = VectorMultiplyAdd(VectorReplicate(Matrix1.Rows[Row], 1), Matrix2.Rows[1], Temp);
+            Temp = VectorMultiplyAdd(VectorReplicate(Matrix1.Rows[Row], 2), Matrix2.Rows[2], Temp);
+            Result.Rows[Row] = VectorMultiplyAdd(VectorReplicate(Matrix1.Rows[Row], 3), Matrix2.Rows[3], Temp);
+        }
+        return Result;
+    }
+
+    void FillMatrices(
+        const FReferenceSkeleton& RefSkeleton,
+        const TArray<FTransform>& LocalPose,
+        TArray<FMatrix>& OutComponentSpaceMatrices,
+        TArray<FMatrix>* OutSkinningMatrices
+    )
+    {
+        const int32 BoneNum = FMath::Min(RefSkeleton.RawRefBoneInfo.Num(), LocalPose.Num());
+
+        // 부모의 Component Space Transform을 참조하기 위한 버퍼, Worker Thread마다 하나씩 재사용
+        thread_local TArray<FTransformVectorized> ComponentSpacePose;
+        ComponentSpacePose.SetNum(BoneNum);
+        OutComponentSpaceMatrices.SetNum(BoneNum);
+
+        const FMatrix* InverseBindPose = nullptr;
+        FMatrix* Skinning = nullptr;
+        if (OutSkinningMatrices)
+        {
+            if (RefSkeleton.InverseBindPoseMatrices.Num() >= BoneNum)
+            {
+                OutSkinningMatrices->SetNum(BoneNum);
+                InverseBindPose = RefSkeleton.InverseBindPoseMatrices.GetData();
+                Skinning = OutSkinningMatrices->GetData();
+            }
+            else
+            {
+                OutSkinningMatrices->Empty();
+            }
+        }
+
+        // Rotation/Translation/Scale 합성은 비균등 Scale의 Shear를 잃으므로, 그런 Pose는 행렬 곱으로 합성
+        bool bUniformScale = true;
+        for (int32 BoneIndex = 0; BoneIndex < BoneNum && bUniformScale; ++BoneIndex)
+        {
+            bUniformScale = LocalPose[BoneIndex].IsUniform();
+        }
+
+        const FMeshBoneInfo* BoneInfo = RefSkeleton.RawRefBoneInfo.GetData();
+        const FTransform* Local = LocalPose.GetData();
+        FTransformVectorized* Pose = ComponentSpacePose.GetData();
+        FMatrix* ComponentSpace = OutComponentSpaceMatrices.GetData();
+
+        for (int32 BoneIndex = 0; BoneIndex < BoneNum; ++BoneIndex)
+        {
+            const int32 ParentIndex = BoneInfo[BoneIndex].ParentIndex;
+
+            FMatrixVectorized Matrix;
+            if (bUniformScale)
+            {
+                Pose[BoneIndex] = ParentIndex != INDEX_NONE
+                    ? Compose(LoadTransform(Local[BoneIndex]), Pose[ParentIndex])
+                    : LoadTransform(Local[BoneIndex]);
+                Matrix = ToMatrix(Pose[BoneIndex]);
+            }
+            else
+            {
+                Matrix = ToMatrix(LoadTransform(Local[BoneIndex]));
+                if (ParentIndex != INDEX_NONE)
+                {
+                    Matrix = MultiplyMatrix(Matrix, LoadMatrix(ComponentSpace[ParentIndex]));
+                }
+            }
+            StoreMatrix(Matrix, ComponentSpace[BoneIndex]);
+
+            if (Skinning)
+            {
+                StoreMatrix(MultiplyMatrix(LoadMatrix(InverseBindPose[BoneIndex]), Matrix), Skinning[BoneIndex]);
+            }
+        }
+    }
+}
+
+
+void FAnimationRuntime::FillComponentSpaceMatrices(
+    const FReferenceSkeleton& RefSkeleton,
+    const TArray<FTransform>& LocalPose,
+    TArray<FMatrix>& OutComponentSpaceMatrices
+)
+{
+    FillMatrices(RefSkeleton, LocalPose, OutComponentSpaceMatrices, nullptr);
+}
+
+void FAnimationRuntime::FillSkinningMatrices(
+    const FReferenceSkeleton& RefSkeleton,
+    const TArray<FTransform>& LocalPose,
+    TArray<FMatrix>& OutComponentSpaceMatrices,
+    TArray<FMatrix>& OutSkinningMatrices
+)
+{
+    FillMatrices(RefSkeleton, LocalPose, OutComponentSpaceMatrices, &OutSkinningMatrices);
+}
@@ -0,0 +1,34 @@
+#pragma once
+#include "Container/Array.h"
+
+struct FMatrix;
+struct FTransform;
+struct FReferenceSkeleton;
+
+
+class FAnimationRuntime
+{
+public:
+    /**
+     * Local Pose를 부모부터 합성해 Component Space 행렬을 만듭니다.
+     * 합성은 행렬 곱 대신 Rotation/Translation/Scale 형태 그대로 SSE로 처리하므로,
+     * 비균등 Scale 아래에서 생기는 Shear는 표현하지 않습니다. (FTransform::operator*와 같음)
+     * 부모 Bone의 Index는 자식보다 작아야 합니다.
+     */
+    static void FillComponentSpaceMatrices(
+        const FReferenceSkeleton& RefSkeleton,
+        const TArray<FTransform>& LocalPose,
+        TArray<FMatrix>& OutComponentSpaceMatrices
+    );
+
+    /**
+     * FillComponentSpaceMatrices와 같은 순회 안에서 Skinning 행렬(InverseBindPose * Component Space)까지 만듭니다.
+     * InverseBindPoseMatrices가 Bone 수보다 적으면 OutSkinningMatrices는 비워둡니다.
+     */
+    static void FillSkinningMatrices(
+        const FReferenceSkeleton& RefSkeleton,
+        const TArray<FTransform>& LocalPose,
+        TArray<FMatrix>& OutComponentSpaceMatrices,
+        TArray<FMatrix>& OutSkinningMatrices
+    );
+};
@@ -0,0 +1,103 @@
+#include <random>
+
+#include "AnimationRuntime.h"
+#include "AnimBenchmarkUtils.h"
+#include "ReferenceSkeleton.h"
+#include "Math/Rotator.h"
+#include "Misc/Benchmark.h"
+#include "UserInterface/Console.h"
+
+namespace
+{
+    /**
+     * 64/128/256개 Bone의 Skinning 행렬 계산을 이전 방식과 비교합니다.
+     * 이전 방식: Bone마다 ToMatrixWithScale로 행렬을 만들어 부모 행렬과 곱하고, 렌더링에서 다시 InverseBindPose를 곱함
+     */
+    void RunBoneMatrixBenchmark(const FBenchmarkContext& Context)
+    {
+        const int32 NumIterations = Context.Count;
+
+        std::mt19937 Random(1234);
+        std::uniform_real_distribution<float> Angle(-45.f, 45.f);
+
+        for (const int32 NumBones : { 64, 128, 256 })
+        {
+            FReferenceSkeleton RefSkeleton;
+            FAnimBenchmarkUtils::MakeReferenceSkeleton(NumBones, RefSkeleton);
+
+            TArray<FTransform> LocalPose = RefSkeleton.RawRefBonePose;
+            for (FTransform& Transform : LocalPose)
+            {
+                Transform.Rotation = FRotator(Angle(Random), Angle(Random), Angle(Random)).Quaternion();
+            }
+
+            TArray<FMatrix> OldComponentSpace;
+            TArray<FMatrix> OldSkinning;
+            auto FillOld = [&]()
+            {
+                OldComponentSpace.SetNum(NumBones);
+                OldSkinning.SetNum(NumBones);
+                for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+                {
+                    FMatrix LocalMatrix = LocalPose[BoneIndex].ToMatrixWithScale();
+                    const int32 ParentIndex = RefSkeleton.RawRefBoneInfo[BoneIndex].ParentIndex;
+                    if (ParentIndex != INDEX_NONE)
+                    {
+                        LocalMatrix = LocalMatrix * OldComponentSpace[ParentIndex];
+                    }
+                    OldComponentSpace[BoneIndex] = LocalMatrix;
+                }
+                for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+                {
+                    OldSkinning[BoneIndex] = RefSkeleton.InverseBindPoseMatrices[BoneIndex] * OldComponentSpace[BoneIndex];
+                }
+            };
+
+            TArray<FMatrix> NewComponentSpace;
+            TArray<FMatrix> NewSkinning;
+            auto FillNew = [&]()
+            {
+                FAnimationRuntime::FillSkinningMatrices(RefSkeleton, LocalPose, NewComponentSpace, NewSkinning);
+            };
+
+            // 호출 한 번의 평균 시간 (us)
+            float Checksum = 0.f;
+            auto Measure = [&](auto&& Fill, const TArray<FMatrix>& Skinning)
+            {
+                const double ElapsedMs = MeasureMilliseconds([&]
+                {
+                    for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+                    {
+                        Fill();
+                        Checksum += Skinning[Iteration % NumBones].M[3][0];
+                    }
+                });
+                return ElapsedMs * 1e3 / NumIterations;
+            };
+
+            const double OldUs = Measure(FillOld, OldSkinning);
+            const double NewUs = Measure(FillNew, NewSkinning);
+
+            float MaxError = 0.f;
+            for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+            {
+                for (int32 Row = 0; Row < 4; ++Row)
+                {
+                    for (int32 Column = 0; Column < 4; ++Column)
+                    {
+                        MaxError = FMath::Max(MaxError, FMath::Abs(OldSkinning[BoneIndex].M[Row][Column] - NewSkinning[BoneIndex].M[Row][Column]));
+                    }
+                }
+            }
+
+            Context.Console.AddLog(
+                ELogLevel::Display, "%3d bones: %8.2f us old, %8.2f us new (x%.2f), max error %g (checksum %g)",
+                NumBones, OldUs, NewUs, OldUs / NewUs, MaxError, Checksum
+            );
+        }
+    }
+
+    FAutoRegisterBenchmark BoneMatrixBenchmark(
+        "bonematrix bench", "[iterations]: Compare FillSkinningMatrices against the old per-bone matrix path for 64/128/256 bones", 10000, &RunBoneMatrixBenchmark
+    );
+}
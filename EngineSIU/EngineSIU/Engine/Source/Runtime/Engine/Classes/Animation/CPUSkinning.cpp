@@ -0,0 +1,263 @@
+#include "CPUSkinning.h"
+
+#include "Async/JobSystem.h"
+#include "Engine/Asset/SkeletalMeshAsset.h"
+#include "Math/MathSSE.h"
+#include "Math/Matrix.h"
+
+using namespace SSE;
+
+
+namespace
+{
+    // Job 하나가 처리하는 Vertex 수
+    constexpr int32 VerticesPerJob = 1024;
+
+    FORCEINLINE VectorRegister4Float Dot3(
+        const VectorRegister4Float& AX, const VectorRegister4Float& AY, const VectorRegister4Float& AZ,
+        const VectorRegister4Float& BX, const VectorRegister4Float& BY, const VectorRegister4Float& BZ
+    )
+    {
+        return VectorMultiplyAdd(AZ, BZ, VectorMultiplyAdd(AY, BY, VectorMultiply(AX, BX)));
+    }
+
+    FORCEINLINE void Normalize3(VectorRegister4Float& X, VectorRegister4Float& Y, VectorRegister4Float& Z)
+    {
+        const VectorRegister4Float SizeSquared = VectorMax(Dot3(X, Y, Z, X, Y, Z), VectorSetFloat1(1.e-12f));
+        const VectorRegister4Float InvSize = VectorDivide(VectorSetFloat1(1.f), _mm_sqrt_ps(SizeSquared));
+        X = VectorMultiply(X, InvSize);
+        Y = VectorMultiply(Y, InvSize);
+        Z = VectorMultiply(Z, InvSize);
+    }
+
+    /**
+     * Vertex 4개씩 Weight로 섞은 Skinning 행렬을 만든 뒤 위치, Normal, Tangent에 적용합니다.
+     * 행렬의 마지막 열은 (0, 0, 0, 1)로 보고 3x4 부분만 섞습니다.
+     */
+    void SkinVertexRange(
+        const FSkinningSourceStreams& Source,
+        const float* Matrices,
+        FSkinnedVertexStreams& Out,
+        int32 Begin,
+        int32 End
+    )
+    {
+        for (int32 Base = Begin; Base < End; Base += 4)
+        {
+            // Blend[Row * 3 + Column], Vertex 4개의 같은 성분을 한 레지스터에 모음
+            VectorRegister4Float Blend[12];
+            for (VectorRegister4Float& Element : Blend)
+            {
+                Element = VectorZero();
+            }
+
+            for (int32 Influence = 0; Influence < FSkinningSourceStreams::MaxBoneInfluences; ++Influence)
+            {
+                const VectorRegister4Float Weight = _mm_load_ps(Source.BoneWeights[Influence].GetData() + Base);
+                if (VectorMaskBits(VectorCompareGT(Weight, VectorZero())) == 0)
+                {
+                    continue;
+                }
+
+                const uint32* BoneIndices = Source.BoneIndices[Influence].GetData() + Base;
+                const float* Matrix0 = Matrices + BoneIndices[0] * 16;
+                const float* Matrix1 = Matrices + BoneIndices[1] * 16;
+                const float* Matrix2 = Matrices + BoneIndices[2] * 16;
+                const float* Matrix3 = Matrices + BoneIndices[3] * 16;
+
+                for (int32 Row = 0; Row < 4; ++Row)
+                {
+                    VectorRegister4Float R0 = _mm_load_ps(Matrix0 + Row * 4);
+                    VectorRegister4Float R1 = _mm_load_ps(Matrix1 + Row * 4);
+                    VectorRegister4Float R2 = _mm_load_ps(Matrix2 + Row * 4);
+                    VectorRegister4Float R3 = _mm_load_ps(Matrix3 + Row * 4);
+                    _MM_TRANSPOSE4_PS(R0, R1, R2, R3);
+
+                    Blend[Row * 3 + 0] = VectorMultiplyAdd(Weight, R0, Blend[Row * 3 + 0]);
+                    Blend[Row * 3 + 1] = VectorMultiplyAdd(Weight, R1, Blend[Row * 3 + 1]);
+                    Blend[Row * 3 + 2] = VectorMultiplyAdd(Weight, R2, Blend[Row * 3 + 2]);
+                }
+            }
+
+            // 위치: (P, 1) * M
+            {
+                const VectorRegister4Float X = _mm_load_ps(Source.Position[0].GetData() + Base);
+                const VectorRegister4Float Y = _mm_load_ps(Source.Position[1].GetData() + Base);
+                const VectorRegister4Float Z = _mm_load_ps(Source.Position[2].GetData() + Base);
+                _mm_store_ps(Out.Position[0].GetData() + Base, VectorAdd(Dot3(X, Y, Z, Blend[0], Blend[3], Blend[6]), Blend[9]));
+                _mm_store_ps(Out.Position[1].GetData() + Base, VectorAdd(Dot3(X, Y, Z, Blend[1], Blend[4], Blend[7]), Blend[10]));
+                _mm_store_ps(Out.Position[2].GetData() + Base, VectorAdd(Dot3(X, Y, Z, Blend[2], Blend[5], Blend[8]), Blend[11]));
+            }
+
+            // Normal: (N, 0) * M
+            VectorRegister4Float NX, NY, NZ;
+            {
+                const VectorRegister4Float X = _mm_load_ps(Source.Normal[0].GetData() + Base);
+                const VectorRegister4Float Y = _mm_load_ps(Source.Normal[1].GetData() + Base);
+                const VectorRegister4Float Z = _mm_load_ps(Source.Normal[2].GetData() + Base);
+                NX = Dot3(X, Y, Z, Blend[0], Blend[3], Blend[6]);
+                NY = Dot3(X, Y, Z, Blend[1], Blend[4], Blend[7]);
+                NZ = Dot3(X, Y, Z, Blend[2], Blend[5], Blend[8]);
+                Normalize3(NX, NY, NZ);
+                _mm_store_ps(Out.Normal[0].GetData() + Base, NX);
+                _mm_store_ps(Out.Normal[1].GetData() + Base, NY);
+                _mm_store_ps(Out.Normal[2].GetData() + Base, NZ);
+            }
+
+            // Tangent: Normal과 같이 변형한 뒤, Shader처럼 Normal에 수직이 되도록 보정
+            {
+                const VectorRegister4Float X = _mm_load_ps(Source.Tangent[0].GetData() + Base);
+                const VectorRegister4Float Y = _mm_load_ps(Source.Tangent[1].GetData() + Base);
+                const VectorRegister4Float Z = _mm_load_ps(Source.Tangent[2].GetData() + Base);
+                VectorRegister4Float TX = Dot3(X, Y, Z, Blend[0], Blend[3], Blend[6]);
+                VectorRegister4Float TY = Dot3(X, Y, Z, Blend[1], Blend[4], Blend[7]);
+                VectorRegister4Float TZ = Dot3(X, Y, Z, Blend[2], Blend[5], Blend[8]);
+                const VectorRegister4Float NDotT = Dot3(NX, NY, NZ, TX, TY, TZ);
+                TX = VectorSubtract(TX, VectorMultiply(NX, NDotT));
+                TY = VectorSubtract(TY, VectorMultiply(NY, NDotT));
+                TZ = VectorSubtract(TZ, VectorMultiply(NZ, NDotT));
+                Normalize3(TX, TY, TZ);
+                _mm_store_ps(Out.Tangent[0].GetData() + Base, TX);
+                _mm_store_ps(Out.Tangent[1].GetData() + Base, TY);
+                _mm_store_ps(Out.Tangent[2].GetData() + Base, TZ);
+            }
+        }
+    }
+}
+
+
+void FCPUSkinning::BuildSourceStreams(const FSkeletalMeshRenderData& RenderData, FSkinningSourceStreams& OutSource)
+{
+    const TArray<FSkeletalMeshVertex>& Vertices = RenderData.Vertices;
+    const int32 NumVertices = Vertices.Num();
+    const int32 NumPadded = (NumVertices + 3) & ~3;
+
+    OutSource.NumVertices = NumVertices;
+    OutSource.MaxBoneIndex = 0;
+    OutSource.UnskinnedVertices.Empty();
+
+    // 채운 Vertex는 Weight 0, Bone 0으로 두어 결과가 버려지도록 함
+    for (int32 Axis = 0; Axis < 3; ++Axis)
+    {
+        OutSource.Position[Axis].Init(0.f, NumPadded);
+        OutSource.Normal[Axis].Init(0.f, NumPadded);
+        OutSource.Tangent[Axis].Init(0.f, NumPadded);
+    }
+    for (int32 Influence = 0; Influence < FSkinningSourceStreams::MaxBoneInfluences; ++Influence)
+    {
+        OutSource.BoneIndices[Influence].Init(0, NumPadded);
+        OutSource.BoneWeights[Influence].Init(0.f, NumPadded);
+    }
+
+    for (int32 VertexIndex = 0; VertexIndex < NumVertices; ++VertexIndex)
+    {
+        const FSkeletalMeshVertex& Vertex = Vertices[VertexIndex];
+
+        OutSource.Position[0][VertexIndex] = Vertex.X;
+        OutSource.Position[1][VertexIndex] = Vertex.Y;
+        OutSource.Position[2][VertexIndex] = Vertex.Z;
+        OutSource.Normal[0][VertexIndex] = Vertex.NormalX;
+        OutSource.Normal[1][VertexIndex] = Vertex.NormalY;
+        OutSource.Normal[2][VertexIndex] = Vertex.NormalZ;
+        OutSource.Tangent[0][VertexIndex] = Vertex.TangentX;
+        OutSource.Tangent[1][VertexIndex] = Vertex.TangentY;
+        OutSource.Tangent[2][VertexIndex] = Vertex.TangentZ;
+
+        // SkeletalMeshVertexShader의 예외 처리와 같은 규칙
+        float TotalWeight = 0.f;
+        for (int32 Influence = 0; Influence < FSkinningSourceStreams::MaxBoneInfluences; ++Influence)
+        {
+            TotalWeight += Vertex.BoneWeights[Influence];
+        }
+
+        if (TotalWeight < 0.001f)
+        {
+            OutSource.UnskinnedVertices.Add(VertexIndex);
+            continue;
+        }
+
+        const float WeightScale = FMath::Abs(TotalWeight - 1.f) > 0.001f ? 1.f / TotalWeight : 1.f;
+        for (int32 Influence = 0; Influence < FSkinningSourceStreams::MaxBoneInfluences; ++Influence)
+        {
+            const float Weight = Vertex.BoneWeights[Influence];
+            if (Weight > 0.f)
+            {
+                OutSource.BoneIndices[Influence][VertexIndex] = Vertex.BoneIndices[Influence];
+                OutSource.BoneWeights[Influence][VertexIndex] = Weight * WeightScale;
+                OutSource.MaxBoneIndex = FMath::Max(OutSource.MaxBoneIndex, Vertex.BoneIndices[Influence]);
+            }
+        }
+    }
+}
+
+bool FCPUSkinning::SkinVertices(
+    const FSkinningSourceStreams& Source,
+    const TArray<FMatrix>& SkinningMatrices,
+    FSkinnedVertexStreams& OutSkinned,
+    bool bParallel
+)
+{
+    if (Source.NumVertices > 0 && Source.MaxBoneIndex >= static_cast<uint32>(SkinningMatrices.Num()))
+    {
+        return false;
+    }
+
+    const int32 NumPadded = Source.GetNumPaddedVertices();
+    OutSkinned.NumVertices = Source.NumVertices;
+    for (int32 Axis = 0; Axis < 3; ++Axis)
+    {
+        OutSkinned.Position[Axis].SetNum(NumPadded);
+        OutSkinned.Normal[Axis].SetNum(NumPadded);
+        OutSkinned.Tangent[Axis].SetNum(NumPadded);
+    }
+
+    const float* Matrices = reinterpret_cast<const float*>(SkinningMatrices.GetData());
+    const int32 NumJobs = (NumPadded + VerticesPerJob - 1) / VerticesPerJob;
+    const auto SkinJob = [&Source, Matrices, &OutSkinned, NumPadded](int32 JobIndex)
+    {
+        const int32 Begin = JobIndex * VerticesPerJob;
+        SkinVertexRange(Source, Matrices, OutSkinned, Begin, FMath::Min(Begin + VerticesPerJob, NumPadded));
+    };
+
+    if (bParallel)
+    {
+        ParallelFor(NumJobs, SkinJob);
+    }
+    else
+    {
+        for (int32 JobIndex = 0; JobIndex < NumJobs; ++JobIndex)
+        {
+            SkinJob(JobIndex);
+        }
+    }
+
+    for (const int32 VertexIndex : Source.UnskinnedVertices)
+    {
+        for (int32 Axis = 0; Axis < 3; ++Axis)
+        {
+            OutSkinned.Position[Axis][VertexIndex] = Source.Position[Axis][VertexIndex];
+            OutSkinned.Normal[Axis][VertexIndex] = Source.Normal[Axis][VertexIndex];
+            OutSkinned.Tangent[Axis][VertexIndex] = Source.Tangent[Axis][VertexIndex];
+        }
+    }
+
+    return true;
+}
+
+void FCPUSkinning::WriteVertices(const FSkinnedVertexStreams& Skinned, TArray<FSkeletalMeshVertex>& InOutVertices)
+{
+    const int32 NumVertices = FMath::Min(Skinned.NumVertices, InOutVertices.Num());
+    for (int32 VertexIndex = 0; VertexIndex < NumVertices; ++VertexIndex)
+    {
+        FSkeletalMeshVertex& Vertex = InOutVertices[VertexIndex];
+        Vertex.X = Skinned.Position[0][VertexIndex];
+        Vertex.Y = Skinned.Position[1][VertexIndex];
+        Vertex.Z = Skinned.Position[2][VertexIndex];
+        Vertex.NormalX = Skinned.Normal[0][VertexIndex];
+        Vertex.NormalY = Skinned.Normal[1][VertexIndex];
+        Vertex.NormalZ = Skinned.Normal[2][VertexIndex];
+        Vertex.TangentX = Skinned.Tangent[0][VertexIndex];
+        Vertex.TangentY = Skinned.Tangent[1][VertexIndex];
+        Vertex.TangentZ = Skinned.Tangent[2][VertexIndex];
+    }
+}
@@ -0,0 +1,71 @@
+#pragma once
+#include "Container/Array.h"
+#include "HAL/PlatformType.h"
+
+struct FMatrix;
+struct FSkeletalMeshVertex;
+struct FSkeletalMeshRenderData;
+
+
+/**
+ * CPU Skinning의 입력, FSkeletalMeshVertex를 성분별 배열(SoA)로 나눈 것
+ * 배열 길이는 SIMD 한 번에 처리하는 4의 배수로 채우며, 채운 Vertex의 Weight는 0입니다.
+ */
+struct FSkinningSourceStreams
+{
+    static constexpr int32 MaxBoneInfluences = 4;
+
+    // 실제 Vertex 수
+    int32 NumVertices = 0;
+
+    TArray<float> Position[3];
+    TArray<float> Normal[3];
+    TArray<float> Tangent[3];
+
+    // Shader와 같은 규칙으로 합이 1이 되도록 정규화한 Weight
+    TArray<uint32> BoneIndices[MaxBoneInfluences];
+    TArray<float> BoneWeights[MaxBoneInfluences];
+
+    // Weight 합이 0에 가까워서 Shader처럼 원래 값을 그대로 쓰는 Vertex
+    TArray<int32> UnskinnedVertices;
+
+    uint32 MaxBoneIndex = 0;
+
+    int32 GetNumPaddedVertices() const { return Position[0].Num(); }
+};
+
+/** CPU Skinning 결과 (Component Space), Normal과 Tangent는 정규화됨 */
+struct FSkinnedVertexStreams
+{
+    int32 NumVertices = 0;
+
+    TArray<float> Position[3];
+    TArray<float> Normal[3];
+    TArray<float> Tangent[3];
+};
+
+/**
+ * SkeletalMeshVertexShader와 같은 Linear Blend Skinning을 CPU에서 수행합니다.
+ * 렌더링이 없는 환경의 충돌 검사나, 변형된 Vertex가 필요한 툴에서 사용합니다.
+ */
+class FCPUSkinning
+{
+public:
+    /** Render Data의 Vertex를 SoA로 변환합니다. Mesh마다 한 번만 하면 됩니다. */
+    static void BuildSourceStreams(const FSkeletalMeshRenderData& RenderData, FSkinningSourceStreams& OutSource);
+
+    /**
+     * Skinning 행렬(InverseBindPose * Component Space)로 Vertex를 변형합니다.
+     * Vertex 구간을 나눠 Job System의 Worker에서 병렬로 처리하고, 모두 끝나면 반환합니다.
+     * @return Source가 참조하는 Bone이 SkinningMatrices 범위를 벗어나면 false
+     */
+    static bool SkinVertices(
+        const FSkinningSourceStreams& Source,
+        const TArray<FMatrix>& SkinningMatrices,
+        FSkinnedVertexStreams& OutSkinned,
+        bool bParallel = true
+    );
+
+    /** Skinning 결과를 AoS Vertex 배열의 위치, Normal, Tangent에 씁니다. */
+    static void WriteVertices(const FSkinnedVertexStreams& Skinned, TArray<FSkeletalMeshVertex>& InOutVertices);
+};
@@ -0,0 +1,174 @@
+#include <random>
+
+#include "CPUSkinning.h"
+#include "AnimationRuntime.h"
+#include "AnimBenchmarkUtils.h"
+#include "ReferenceSkeleton.h"
+#include "Engine/Asset/SkeletalMeshAsset.h"
+#include "Math/Rotator.h"
+#include "Misc/Benchmark.h"
+#include "UserInterface/Console.h"
+
+namespace
+{
+    /** SkeletalMeshVertexShader의 Skinning을 그대로 옮긴 Scalar 버전, Position과 정규화한 Normal을 씁니다. */
+    void SkinVertexLikeShader(const FSkeletalMeshVertex& Vertex, const TArray<FMatrix>& SkinningMatrices, FVector& OutPosition, FVector& OutNormal)
+    {
+        const float Position[4] = { Vertex.X, Vertex.Y, Vertex.Z, 1.f };
+        const float Normal[4] = { Vertex.NormalX, Vertex.NormalY, Vertex.NormalZ, 0.f };
+
+        float SkinnedPosition[4] = { 0.f, 0.f, 0.f, 0.f };
+        float SkinnedNormal[3] = { 0.f, 0.f, 0.f };
+        float TotalWeight = 0.f;
+        for (int32 Influence = 0; Influence < 4; ++Influence)
+        {
+            const float Weight = Vertex.BoneWeights[Influence];
+            TotalWeight += Weight;
+            if (Weight > 0.f)
+            {
+                // mul(float4, float4x4): 행 벡터 * 행렬
+                const FMatrix& Matrix = SkinningMatrices[Vertex.BoneIndices[Influence]];
+                for (int32 Column = 0; Column < 4; ++Column)
+                {
+                    float Pos = 0.f;
+                    float Norm = 0.f;
+                    for (int32 Row = 0; Row < 4; ++Row)
+                    {
+                        Pos += Position[Row] * Matrix.M[Row][Column];
+                        Norm += Normal[Row] * Matrix.M[Row][Column];
+                    }
+                    SkinnedPosition[Column] += Weight * Pos;
+                    if (Column < 3)
+                    {
+                        SkinnedNormal[Column] += Weight * Norm;
+                    }
+                }
+            }
+        }
+
+        if (TotalWeight < 0.001f)
+        {
+            OutPosition = FVector(Vertex.X, Vertex.Y, Vertex.Z);
+            OutNormal = FVector(Vertex.NormalX, Vertex.NormalY, Vertex.NormalZ);
+        }
+        else
+        {
+            const float Scale = FMath::Abs(TotalWeight - 1.f) > 0.001f ? 1.f / TotalWeight : 1.f;
+            OutPosition = FVector(SkinnedPosition[0], SkinnedPosition[1], SkinnedPosition[2]) * Scale;
+            OutNormal = FVector(SkinnedNormal[0], SkinnedNormal[1], SkinnedNormal[2]) * Scale;
+        }
+        OutNormal = OutNormal.GetSafeNormal();
+    }
+
+    /**
+     * 임의의 Vertex와 Pose로 FCPUSkinning의 SSE 경로와 Shader를 옮긴 Scalar 경로를 비교합니다.
+     * Weight 합이 1이 아니거나 0인 Vertex도 섞어서 Shader의 예외 처리까지 확인합니다.
+     */
+    void RunSkinningBenchmark(const FBenchmarkContext& Context)
+    {
+        constexpr int32 NumBones = 64;
+        const int32 NumVertices = Context.Count;
+
+        std::mt19937 Random(1234);
+        std::uniform_real_distribution<float> Unit(-1.f, 1.f);
+        std::uniform_int_distribution<uint32> BoneIndex(0, NumBones - 1);
+
+        FReferenceSkeleton RefSkeleton;
+        FAnimBenchmarkUtils::MakeReferenceSkeleton(NumBones, RefSkeleton);
+
+        TArray<FTransform> LocalPose = RefSkeleton.RawRefBonePose;
+        for (FTransform& Transform : LocalPose)
+        {
+            Transform.Rotation = FRotator(Unit(Random) * 45.f, Unit(Random) * 45.f, Unit(Random) * 45.f).Quaternion();
+        }
+        TArray<FMatrix> ComponentSpaceMatrices;
+        TArray<FMatrix> SkinningMatrices;
+        FAnimationRuntime::FillSkinningMatrices(RefSkeleton, LocalPose, ComponentSpaceMatrices, SkinningMatrices);
+
+        FSkeletalMeshRenderData RenderData;
+        RenderData.Vertices.SetNum(NumVertices);
+        for (int32 VertexIndex = 0; VertexIndex < NumVertices; ++VertexIndex)
+        {
+            FSkeletalMeshVertex& Vertex = RenderData.Vertices[VertexIndex];
+            Vertex.X = Unit(Random) * 100.f;
+            Vertex.Y = Unit(Random) * 100.f;
+            Vertex.Z = Unit(Random) * 100.f;
+
+            const FVector Normal = FVector(Unit(Random), Unit(Random), Unit(Random)).GetSafeNormal();
+            Vertex.NormalX = Normal.X;
+            Vertex.NormalY = Normal.Y;
+            Vertex.NormalZ = Normal.Z;
+            Vertex.TangentX = 1.f;
+            Vertex.TangentW = 1.f;
+
+            // 16개 중 하나는 Weight 없음, 하나는 합이 1이 아닌 Weight
+            const int32 Kind = VertexIndex % 16;
+            if (Kind == 0)
+            {
+                continue;
+            }
+
+            float TotalWeight = 0.f;
+            const int32 NumInfluences = 1 + VertexIndex % 4;
+            for (int32 Influence = 0; Influence < NumInfluences; ++Influence)
+            {
+                Vertex.BoneIndices[Influence] = BoneIndex(Random);
+                Vertex.BoneWeights[Influence] = 0.1f + (Unit(Random) + 1.f) * 0.5f;
+                TotalWeight += Vertex.BoneWeights[Influence];
+            }
+            if (Kind != 1)
+            {
+                for (int32 Influence = 0; Influence < NumInfluences; ++Influence)
+                {
+                    Vertex.BoneWeights[Influence] /= TotalWeight;
+                }
+            }
+        }
+
+        FSkinningSourceStreams Source;
+        FCPUSkinning::BuildSourceStreams(RenderData, Source);
+
+        // 첫 호출은 출력 버퍼를 할당하므로 측정에서 제외
+        FSkinnedVertexStreams Skinned;
+        FCPUSkinning::SkinVertices(Source, SkinningMatrices, Skinned, false);
+
+        TArray<FVector> ShaderPositions;
+        TArray<FVector> ShaderNormals;
+        ShaderPositions.SetNum(NumVertices);
+        ShaderNormals.SetNum(NumVertices);
+        Context.Measure("Scalar (shader port)", NumVertices, [&]
+        {
+            for (int32 VertexIndex = 0; VertexIndex < NumVertices; ++VertexIndex)
+            {
+                SkinVertexLikeShader(RenderData.Vertices[VertexIndex], SkinningMatrices, ShaderPositions[VertexIndex], ShaderNormals[VertexIndex]);
+            }
+        }, "vertex");
+        Context.Measure("SSE", NumVertices, [&]
+        {
+            FCPUSkinning::SkinVertices(Source, SkinningMatrices, Skinned, false);
+        }, "vertex");
+        Context.Measure("SSE + ParallelFor", NumVertices, [&]
+        {
+            FCPUSkinning::SkinVertices(Source, SkinningMatrices, Skinned, true);
+        }, "vertex");
+
+        float MaxPositionError = 0.f;
+        float MaxNormalError = 0.f;
+        for (int32 VertexIndex = 0; VertexIndex < NumVertices; ++VertexIndex)
+        {
+            const FVector Position(Skinned.Position[0][VertexIndex], Skinned.Position[1][VertexIndex], Skinned.Position[2][VertexIndex]);
+            const FVector Normal(Skinned.Normal[0][VertexIndex], Skinned.Normal[1][VertexIndex], Skinned.Normal[2][VertexIndex]);
+            MaxPositionError = FMath::Max(MaxPositionError, (Position - ShaderPositions[VertexIndex]).Length());
+            MaxNormalError = FMath::Max(MaxNormalError, (Normal - ShaderNormals[VertexIndex]).Length());
+        }
+
+        Context.Console.AddLog(
+            ELogLevel::Display, "Skinning bench: %d vertices, %d bones, max position error %g units, max normal error %g",
+            NumVertices, NumBones, MaxPositionError, MaxNormalError
+        );
+    }
+
+    FAutoRegisterBenchmark SkinningBenchmark(
+        "skinning bench", "[vertices]: Skin random vertices with FCPUSkinning and a scalar port of the vertex shader, reporting time and max error", 100000, &RunSkinningBenchmark
+    );
+}
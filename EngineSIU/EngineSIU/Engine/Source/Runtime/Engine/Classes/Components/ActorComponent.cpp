@@ -10,6 +10,8 @@ UObject* UActorComponent::Duplicate(UObject* InOuter)
     NewComponent->OwnerPrivate = OwnerPrivate;
     NewComponent->bIsActive = bIsActive;
     NewComponent->bAutoActive = bAutoActive;
+    NewComponent->bRunTickOnAnyThread = bRunTickOnAnyThread;
+    NewComponent->TickGroup = TickGroup;
 
     return NewComponent;
 }
@@ -90,6 +92,10 @@ void UActorComponent::TickComponent(float DeltaTime)
 {
 }
 
+void UActorComponent::PrepareTickOnAnyThread()
+{
+}
+
 void UActorComponent::OnComponentDestroyed()
 {
 }
@@ -39,6 +39,12 @@ public:
     /** 매 틱마다 호출됩니다. */
     virtual void TickComponent(float DeltaTime);
 
+    /**
+     * CanTickOnAnyThread인 Component의 TickComponent 직전에 Main Thread에서 호출됩니다.
+     * World Transform처럼 Worker Thread에서 읽으면 안 되는 값을 여기서 미리 저장합니다.
+     */
+    virtual void PrepareTickOnAnyThread();
+
     /** Component가 제거되었을 때 호출됩니다. */
     virtual void OnComponentDestroyed();
 
@@ -67,6 +73,13 @@ public:
     void Activate();
     void Deactivate();
 
+    ETickingGroup GetTickGroup() const { return TickGroup; }
+    void SetTickGroup(ETickingGroup InTickGroup) { TickGroup = InTickGroup; }
+
+    /** Worker Thread에서 다른 Component의 Tick과 동시에 Tick할 수 있는지 여부를 반환합니다. */
+    bool CanTickOnAnyThread() const { return bRunTickOnAnyThread; }
+    void SetTickOnAnyThread(bool bInRunTickOnAnyThread) { bRunTickOnAnyThread = bInRunTickOnAnyThread; }
+
 private:
     AActor* OwnerPrivate;
 
@@ -82,6 +95,14 @@ private:
     /** Component가 현재 활성화 중인지 여부 */
     uint8 bIsActive : 1 = true;
 
+    /**
+     * true면 Owner Actor의 Tick 대신 World의 Tick에서 Worker Thread로 Tick합니다.
+     * TickComponent에서 자기 데이터만 읽고 써야 합니다.
+     */
+    uint8 bRunTickOnAnyThread : 1 = false;
+
+    ETickingGroup TickGroup = TG_PrePhysics;
+
 public:
     /** Component가 초기화 되었을 때, 자동으로 활성화할지 여부 */
     uint8 bAutoActive : 1 = true;
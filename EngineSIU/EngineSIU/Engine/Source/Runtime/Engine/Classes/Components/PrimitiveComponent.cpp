@@ -183,6 +183,14 @@ void UPrimitiveComponent::TickComponent(float DeltaTime)
     Super::TickComponent(DeltaTime);
 }
 
+void UPrimitiveComponent::OnComponentDestroyed()
+{
+    Super::OnComponentDestroyed();
+
+    // 다른 Component의 Overlap 목록에 제거될 Component가 남지 않도록 정리
+    ClearComponentOverlaps(true, true);
+}
+
 bool UPrimitiveComponent::IntersectRayTriangle(const FVector& RayOrigin, const FVector& RayDirection, const FVector& v0, const FVector& v1, const FVector& v2, float& OutHitDistance) const
 {
     const FVector Edge1 = v1 - v0;
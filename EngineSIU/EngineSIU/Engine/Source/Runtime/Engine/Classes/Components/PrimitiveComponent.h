@@ -17,6 +17,7 @@ public:
 
     virtual void InitializeComponent() override;
     virtual void TickComponent(float DeltaTime) override;
+    virtual void OnComponentDestroyed() override;
     
     bool IntersectRayTriangle(
         const FVector& RayOrigin, const FVector& RayDirection,
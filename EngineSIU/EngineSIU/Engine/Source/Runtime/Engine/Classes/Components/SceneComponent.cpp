@@ -1,5 +1,6 @@
 #include "Components/SceneComponent.h"
 
+#include "Async/JobSystem.h"
 #include "Math/Rotator.h"
 #include "Math/JungleMath.h"
 #include "UObject/Casts.h"
@@ -7,6 +8,8 @@
 #include "Engine/HitResult.h"
 #include "GameFramework/Actor.h"
 #include "Math/Transform.h"
+#include "World/TransformHierarchy.h"
+#include "World/World.h"
 
 USceneComponent::USceneComponent()
     : RelativeLocation(FVector(0.f, 0.f, 0.f))
@@ -15,6 +18,14 @@ USceneComponent::USceneComponent()
 {
 }
 
+USceneComponent::~USceneComponent()
+{
+    if (TransformHierarchy)
+    {
+        TransformHierarchy->Unregister(HierarchyIndex);
+    }
+}
+
 UObject* USceneComponent::Duplicate(UObject* InOuter)
 {
     ThisClass* NewComponent = Cast<ThisClass>(Super::Duplicate(InOuter));
@@ -22,6 +33,7 @@ UObject* USceneComponent::Duplicate(UObject* InOuter)
     NewComponent->RelativeLocation = RelativeLocation;
     NewComponent->RelativeRotation = RelativeRotation;
     NewComponent->RelativeScale3D = RelativeScale3D;
+    NewComponent->MarkComponentToWorldDirty();
 
     return NewComponent;
 }
@@ -63,12 +75,15 @@ void USceneComponent::SetProperties(const TMap<FString, FString>& InProperties)
     {
         RelativeScale3D.InitFromString(*TempStr);
     }
+    MarkComponentToWorldDirty();
 }
 
 void USceneComponent::InitializeComponent()
 {
     Super::InitializeComponent();
 
+    // World의 FTransformHierarchy에 새 Component 등록
+    NotifyHierarchyStructureChanged();
 }
 
 void USceneComponent::TickComponent(float DeltaTime)
@@ -156,7 +171,7 @@ FVector USceneComponent::GetUpVector() const
 void USceneComponent::AddLocation(const FVector& InAddValue)
 {
     RelativeLocation = RelativeLocation + InAddValue;
-
+    MarkComponentToWorldDirty();
 }
 
 void USceneComponent::AddRotation(const FRotator& InAddValue)
@@ -174,6 +189,7 @@ void USceneComponent::AddRotation(const FQuat& InAddValue)
 void USceneComponent::AddScale(const FVector& InAddValue)
 {
     RelativeScale3D = RelativeScale3D + InAddValue;
+    MarkComponentToWorldDirty();
 }
 
 void USceneComponent::AttachToComponent(USceneComponent* InParent)
@@ -184,6 +200,9 @@ void USceneComponent::AttachToComponent(USceneComponent* InParent)
         AttachParent->AttachChildren.Remove(this);
     }
 
+    MarkComponentToWorldDirty();
+    NotifyHierarchyStructureChanged();
+
     // InParent도 nullptr이면 부모를 nullptr로 설정
     if (InParent == nullptr)
     {
@@ -194,6 +213,7 @@ void USceneComponent::AttachToComponent(USceneComponent* InParent)
 
     // 새로운 부모 설정
     AttachParent = InParent;
+    NotifyHierarchyStructureChanged();
 
     // 부모의 자식 리스트에 추가
     if (!InParent->AttachChildren.Contains(this))
@@ -218,6 +238,7 @@ void USceneComponent::SetWorldLocation(const FVector& InLocation)
     }
     FVector NewRelativeLocation = NewRelativeMatrix.GetTranslationVector();
     RelativeLocation = NewRelativeLocation;
+    MarkComponentToWorldDirty();
 }
 
 void USceneComponent::SetWorldRotation(const FRotator& InRotation)
@@ -236,7 +257,8 @@ void USceneComponent::SetWorldRotation(const FQuat& InQuat)
     }
     FQuat NewRelativeRotation = FQuat(NewRelativeMatrix);
     RelativeRotation = FRotator(NewRelativeRotation);
-    RelativeRotation.Normalize();   
+    RelativeRotation.Normalize();
+    MarkComponentToWorldDirty();
 }
 
 void USceneComponent::SetWorldScale3D(const FVector& InScale)
@@ -250,28 +272,29 @@ void USceneComponent::SetWorldScale3D(const FVector& InScale)
     }
     FVector NewRelativeScale = NewRelativeMatrix.GetScaleVector();
     RelativeScale3D = NewRelativeScale;
+    MarkComponentToWorldDirty();
 }
 
 FVector USceneComponent::GetComponentLocation() const
 {
-    return GetWorldMatrix().GetTranslationVector();
+    return GetComponentTransform().GetTranslation();
 }
 
 FRotator USceneComponent::GetComponentRotation() const
 {
-    FMatrix WorldMatrix = GetWorldMatrix().GetMatrixWithoutScale();
-    FQuat Quat = WorldMatrix.ToQuat();
-    return FRotator(Quat);
+    ConditionalUpdateComponentToWorld();
+    return TransformHierarchy ? TransformHierarchy->WorldRotations[HierarchyIndex] : WorldRotation;
 }
 
 FVector USceneComponent::GetComponentScale3D() const
 {
-    return GetWorldMatrix().GetScaleVector();
+    return GetComponentTransform().GetScale3D();
 }
 
 FTransform USceneComponent::GetComponentTransform() const
 {
-    return FTransform(GetComponentRotation(), GetComponentLocation(), GetComponentScale3D());
+    ConditionalUpdateComponentToWorld();
+    return TransformHierarchy ? TransformHierarchy->ComponentToWorlds[HierarchyIndex] : ComponentToWorld;
 }
 
 FMatrix USceneComponent::GetScaleMatrix() const
@@ -289,29 +312,109 @@ FMatrix USceneComponent::GetTranslationMatrix() const
     return FMatrix::GetTranslationMatrix(RelativeLocation);
 }
 
-FMatrix USceneComponent::GetWorldMatrix() const
+const FMatrix& USceneComponent::GetWorldMatrix() const
 {
-    FMatrix ScaleMat = GetScaleMatrix();
-    FMatrix RotationMat = GetRotationMatrix();
-    FMatrix TranslationMat = GetTranslationMatrix();
+    ConditionalUpdateComponentToWorld();
+    return TransformHierarchy ? TransformHierarchy->WorldMatrices[HierarchyIndex] : WorldMatrix;
+}
 
-    FMatrix RTMat = RotationMat * TranslationMat;
+void USceneComponent::MarkComponentToWorldDirty()
+{
+    // 자식과 TransformHierarchy까지 고치므로 AnyThread Tick에서 Transform을 바꾸면 안 됨
+    assert(FJobSystem::IsInMainThread() && "Transform은 Main Thread에서만 바꿀 수 있습니다.");
 
-    USceneComponent* Parent = AttachParent;
-    while (Parent)
+    // 이미 Dirty라면 자식들도 모두 Dirty 상태
+    if (bComponentToWorldDirty)
     {
-        FMatrix ParentScaleMat = Parent->GetScaleMatrix();
-        FMatrix ParentRotationMat = Parent->GetRotationMatrix();
-        FMatrix ParentTranslationMat = Parent->GetTranslationMatrix();
-        
-        ScaleMat = ScaleMat * ParentScaleMat;
-        
-        FMatrix ParentRTMat = ParentRotationMat * ParentTranslationMat;
-        RTMat = RTMat * ParentRTMat;
+        return;
+    }
+
+    bComponentToWorldDirty = true;
+    if (TransformHierarchy)
+    {
+        TransformHierarchy->MarkDirty(HierarchyIndex);
+    }
+
+    for (USceneComponent* Child : AttachChildren)
+    {
+        if (Child)
+        {
+            Child->MarkComponentToWorldDirty();
+        }
+    }
+}
+
+void USceneComponent::ConditionalUpdateComponentToWorld() const
+{
+    if (!bComponentToWorldDirty)
+    {
+        return;
+    }
+
+    // 캐시와 TransformHierarchy를 고치므로 Worker Thread에서는 이미 갱신된 Transform만 읽어야 함
+    assert(FJobSystem::IsInMainThread() && "Dirty Transform은 Main Thread에서만 갱신할 수 있습니다.");
+
+    if (TransformHierarchy)
+    {
+        TransformHierarchy->UpdateEntry(HierarchyIndex);
+        return;
+    }
+
+    const FMatrix* ParentScaleMatrix = nullptr;
+    const FMatrix* ParentRTMatrix = nullptr;
+    if (AttachParent)
+    {
+        AttachParent->ConditionalUpdateComponentToWorld();
+        ParentScaleMatrix = &AttachParent->GetCachedWorldScaleMatrix();
+        ParentRTMatrix = &AttachParent->GetCachedWorldRTMatrix();
+    }
+
+    CalculateComponentToWorld(ParentScaleMatrix, ParentRTMatrix, WorldScaleMatrix, WorldRTMatrix, WorldMatrix, WorldRotation, ComponentToWorld);
+    bComponentToWorldDirty = false;
+}
 
-        Parent = Parent->AttachParent;
+void USceneComponent::CalculateComponentToWorld(
+    const FMatrix* ParentScaleMatrix, const FMatrix* ParentRTMatrix,
+    FMatrix& OutScaleMatrix, FMatrix& OutRTMatrix, FMatrix& OutWorldMatrix, FRotator& OutRotation, FTransform& OutTransform
+) const
+{
+    // Scale은 부모의 회전과 관계없이 누적하고, 회전과 이동은 부모의 회전, 이동 행렬을 이어서 곱합니다.
+    OutScaleMatrix = GetScaleMatrix();
+    OutRTMatrix = GetRotationMatrix() * GetTranslationMatrix();
+    if (ParentScaleMatrix && ParentRTMatrix)
+    {
+        OutScaleMatrix = OutScaleMatrix * *ParentScaleMatrix;
+        OutRTMatrix = OutRTMatrix * *ParentRTMatrix;
+    }
+
+    OutWorldMatrix = OutScaleMatrix * OutRTMatrix;
+    OutRotation = FRotator(OutWorldMatrix.GetMatrixWithoutScale().ToQuat());
+    OutTransform = FTransform(OutRotation, OutWorldMatrix.GetTranslationVector(), OutWorldMatrix.GetScaleVector());
+}
+
+const FMatrix& USceneComponent::GetCachedWorldScaleMatrix() const
+{
+    return TransformHierarchy ? TransformHierarchy->WorldScaleMatrices[HierarchyIndex] : WorldScaleMatrix;
+}
+
+const FMatrix& USceneComponent::GetCachedWorldRTMatrix() const
+{
+    return TransformHierarchy ? TransformHierarchy->WorldRTMatrices[HierarchyIndex] : WorldRTMatrix;
+}
+
+void USceneComponent::NotifyHierarchyStructureChanged() const
+{
+    if (TransformHierarchy)
+    {
+        TransformHierarchy->MarkStructureDirty();
+    }
+    else if (const UWorld* World = GetWorld())
+    {
+        if (FTransformHierarchy* WorldHierarchy = World->GetTransformHierarchy())
+        {
+            WorldHierarchy->MarkStructureDirty();
+        }
     }
-    return ScaleMat * RTMat;
 }
 
 void USceneComponent::SetupAttachment(USceneComponent* InParent)
@@ -330,6 +433,9 @@ void USceneComponent::SetupAttachment(USceneComponent* InParent)
 
         // TODO: .AddUnique의 실행 위치를 RegisterComponent로 바꾸거나 해야할 듯
         InParent->AttachChildren.AddUnique(this);
+
+        MarkComponentToWorldDirty();
+        NotifyHierarchyStructureChanged();
     }
 }
 
@@ -343,6 +449,14 @@ void USceneComponent::DetachFromComponent(USceneComponent* Target)
     }
 
     Target->AttachChildren.Remove(this);
+
+    // 부모의 움직임이 더 이상 전파되지 않으므로, 상대 Transform을 그대로 World Transform으로 사용
+    if (AttachParent == Target)
+    {
+        AttachParent = nullptr;
+    }
+    MarkComponentToWorldDirty();
+    NotifyHierarchyStructureChanged();
 }
 
 void USceneComponent::SetRelativeRotation(const FRotator& InRotation)
@@ -356,6 +470,7 @@ void USceneComponent::SetRelativeRotation(const FQuat& InQuat)
 
     RelativeRotation = NormalizedQuat.Rotator();
     RelativeRotation.Normalize();
+    MarkComponentToWorldDirty();
 }
 
 void USceneComponent::SetRelativeTransform(const FTransform& InTransform)
@@ -363,6 +478,7 @@ void USceneComponent::SetRelativeTransform(const FTransform& InTransform)
     RelativeLocation = InTransform.GetTranslation();
     RelativeRotation = InTransform.GetRotation().GetNormalized().Rotator();
     RelativeScale3D = InTransform.GetScale3D();
+    MarkComponentToWorldDirty();
 
     UpdateOverlaps();
 }
@@ -6,13 +6,17 @@
 
 struct FHitResult;
 struct FOverlapInfo;
+class FTransformHierarchy;
 
 class USceneComponent : public UActorComponent
 {
     DECLARE_CLASS(USceneComponent, UActorComponent)
 
+    friend class FTransformHierarchy;
+
 public:
     USceneComponent();
+    virtual ~USceneComponent() override;
 
     virtual UObject* Duplicate(UObject* InOuter) override;
     
@@ -41,10 +45,10 @@ public:
     void DetachFromComponent(USceneComponent* Target);
     
 public:
-    void SetRelativeLocation(const FVector& InLocation) { RelativeLocation = InLocation; }
+    void SetRelativeLocation(const FVector& InLocation) { RelativeLocation = InLocation; MarkComponentToWorldDirty(); }
     void SetRelativeRotation(const FRotator& InRotation);
     void SetRelativeRotation(const FQuat& InQuat);
-    void SetRelativeScale3D(const FVector& InScale) { RelativeScale3D = InScale; }
+    void SetRelativeScale3D(const FVector& InScale) { RelativeScale3D = InScale; MarkComponentToWorldDirty(); }
     void SetRelativeTransform(const FTransform& InTransform);
     
     FVector GetRelativeLocation() const { return RelativeLocation; }
@@ -68,7 +72,8 @@ public:
     FMatrix GetRotationMatrix() const;
     FMatrix GetTranslationMatrix() const;
 
-    FMatrix GetWorldMatrix() const;
+    /** 캐시된 World 행렬, 상대 Transform이나 부모가 바뀐 뒤 처음 호출될 때만 다시 계산합니다. */
+    const FMatrix& GetWorldMatrix() const;
 
     void UpdateOverlaps(const TArray<FOverlapInfo>* PendingOverlaps = nullptr, bool bDoNotifies = true, const TArray<const FOverlapInfo>* OverlapsAtEndLocation = nullptr);
 
@@ -98,6 +103,12 @@ protected:
 
     virtual bool MoveComponentImpl(const FVector& Delta, const FQuat& NewRotation, bool bSweep, FHitResult* OutHit = nullptr);
 
+    /**
+     * 이 컴포넌트와 모든 자식의 World Transform 캐시를 무효화합니다.
+     * Relative 값을 직접 수정했다면 반드시 호출해야 합니다.
+     */
+    void MarkComponentToWorldDirty();
+
 public:
     bool IsUsingAbsoluteRotation() const;
     void SetUsingAbsoluteRotation(const bool bInAbsoluteRotation);
@@ -105,8 +116,37 @@ protected:
     uint8 bAbsoluteRotation : 1;
     
 private:
-    // TODO: 캐싱해서 사용하기
-    bool bComponentToWorldUpdated = true;
-
-    FTransform ComponentToWorld;
+    /** Dirty일 때만 부모의 캐시를 이용해 World Transform을 다시 계산합니다. */
+    void ConditionalUpdateComponentToWorld() const;
+
+    /** 부모의 누적 행렬로 World Transform을 계산합니다. 부모가 없으면 Parent 행렬은 nullptr */
+    void CalculateComponentToWorld(
+        const FMatrix* ParentScaleMatrix, const FMatrix* ParentRTMatrix,
+        FMatrix& OutScaleMatrix, FMatrix& OutRTMatrix, FMatrix& OutWorldMatrix, FRotator& OutRotation, FTransform& OutTransform
+    ) const;
+
+    /** World의 FTransformHierarchy에 등록되어 있으면 그 배열의 값을, 아니면 Component의 캐시를 반환합니다. */
+    const FMatrix& GetCachedWorldScaleMatrix() const;
+    const FMatrix& GetCachedWorldRTMatrix() const;
+
+    /** 구조 변경을 등록된 FTransformHierarchy나 World의 FTransformHierarchy에 알립니다. */
+    void NotifyHierarchyStructureChanged() const;
+
+    /**
+     * World Transform 캐시를 다시 계산해야 하는지 여부
+     * 부모가 Dirty면 자식도 항상 Dirty입니다.
+     */
+    mutable bool bComponentToWorldDirty = true;
+
+    /** 부모까지 누적된 Scale 행렬과 회전, 이동 행렬, 자식의 World 행렬 계산에 사용합니다. */
+    mutable FMatrix WorldScaleMatrix;
+    mutable FMatrix WorldRTMatrix;
+
+    mutable FMatrix WorldMatrix;
+    mutable FRotator WorldRotation;
+    mutable FTransform ComponentToWorld;
+
+    /** 등록된 FTransformHierarchy, 등록되어 있는 동안에는 위의 캐시 대신 HierarchyIndex의 값을 사용합니다. */
+    FTransformHierarchy* TransformHierarchy = nullptr;
+    int32 HierarchyIndex = INDEX_NONE;
 };
@@ -0,0 +1,126 @@
+#include "SceneComponent.h"
+
+#include "Math/Rotator.h"
+#include "Misc/Benchmark.h"
+#include "UObject/ObjectFactory.h"
+#include "UObject/UObjectArray.h"
+#include "UserInterface/Console.h"
+
+namespace
+{
+    /** 캐시 전의 GetWorldMatrix처럼, 호출할 때마다 부모를 따라 올라가며 World 행렬을 다시 계산합니다. */
+    FMatrix CalculateWorldMatrixWithoutCache(const USceneComponent* Component)
+    {
+        FMatrix ScaleMat = Component->GetScaleMatrix();
+        FMatrix RTMat = Component->GetRotationMatrix() * Component->GetTranslationMatrix();
+        for (const USceneComponent* Parent = Component->GetAttachParent(); Parent; Parent = Parent->GetAttachParent())
+        {
+            ScaleMat = ScaleMat * Parent->GetScaleMatrix();
+            RTMat = RTMat * (Parent->GetRotationMatrix() * Parent->GetTranslationMatrix());
+        }
+        return ScaleMat * RTMat;
+    }
+
+    /**
+     * Count 길이의 USceneComponent 사슬을 만들고, 캐시된 World Transform 조회와 이전 방식(매번 부모를 따라 계산)을 비교합니다.
+     * 루트만 움직인 뒤 끝의 Component 하나를 조회하는 경우와, 사슬의 모든 Component를 조회하는 경우를 측정합니다.
+     */
+    void RunTransformBenchmark(const FBenchmarkContext& Context)
+    {
+        constexpr int32 NumIterations = 1000;
+        const int32 Depth = Context.Count;
+
+        TArray<USceneComponent*> Chain;
+        Chain.Reserve(Depth);
+        for (int32 Index = 0; Index < Depth; ++Index)
+        {
+            USceneComponent* Component = FObjectFactory::ConstructObject<USceneComponent>(nullptr);
+            Component->SetRelativeLocation(FVector(1.0f, 0.0f, 0.5f));
+            Component->SetRelativeRotation(FRotator(0.0f, 5.0f, 1.0f));
+            Component->SetRelativeScale3D(FVector(1.01f, 1.0f, 0.99f));
+            if (Index > 0)
+            {
+                Component->SetupAttachment(Chain[Index - 1]);
+            }
+            Chain.Add(Component);
+        }
+
+        USceneComponent* Root = Chain[0];
+        const USceneComponent* Leaf = Chain[Depth - 1];
+
+        float Checksum = 0.0f;
+        auto Measure = [&Context](const char* Label, int32 NumQueries, auto&& Body)
+        {
+            Context.Measure(Label, static_cast<double>(NumIterations) * NumQueries, [&]
+            {
+                for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+                {
+                    Body(Iteration);
+                }
+            }, "query");
+        };
+
+        auto MoveRoot = [Root](int32 Iteration)
+        {
+            Root->SetRelativeLocation(FVector(static_cast<float>(Iteration & 0xFF), 0.0f, 0.0f));
+        };
+
+        Measure("Leaf, unchanged", 1, [&](int32)
+        {
+            Checksum += Leaf->GetComponentLocation().X;
+        });
+        Measure("Leaf, unchanged (old)", 1, [&](int32)
+        {
+            Checksum += CalculateWorldMatrixWithoutCache(Leaf).GetTranslationVector().X;
+        });
+        Measure("Leaf, root moved", 1, [&](int32 Iteration)
+        {
+            MoveRoot(Iteration);
+            Checksum += Leaf->GetComponentLocation().X;
+        });
+        Measure("Leaf, root moved (old)", 1, [&](int32 Iteration)
+        {
+            MoveRoot(Iteration);
+            Checksum += CalculateWorldMatrixWithoutCache(Leaf).GetTranslationVector().X;
+        });
+        Measure("All, root moved", Depth, [&](int32 Iteration)
+        {
+            MoveRoot(Iteration);
+            for (const USceneComponent* Component : Chain)
+            {
+                Checksum += Component->GetComponentLocation().X;
+            }
+        });
+        Measure("All, root moved (old)", Depth, [&](int32 Iteration)
+        {
+            MoveRoot(Iteration);
+            for (const USceneComponent* Component : Chain)
+            {
+                Checksum += CalculateWorldMatrixWithoutCache(Component).GetTranslationVector().X;
+            }
+        });
+
+        // 두 방식의 결과가 같은지 확인
+        float MaxError = 0.0f;
+        for (const USceneComponent* Component : Chain)
+        {
+            const FVector Cached = Component->GetWorldMatrix().GetTranslationVector();
+            const FVector Uncached = CalculateWorldMatrixWithoutCache(Component).GetTranslationVector();
+            MaxError = FMath::Max(MaxError, (Cached - Uncached).Length());
+        }
+
+        for (USceneComponent* Component : Chain)
+        {
+            GUObjectArray.MarkRemoveObject(Component);
+        }
+
+        Context.Console.AddLog(
+            ELogLevel::Display, "Transform bench: depth %d, %d iterations, max location error %g (checksum %g)",
+            Depth, NumIterations, MaxError, Checksum
+        );
+    }
+
+    FAutoRegisterBenchmark TransformBenchmark(
+        "transform bench", "[depth]: Compare cached world transforms on an attach chain against recomputing the parent chain", 64, &RunTransformBenchmark
+    );
+}
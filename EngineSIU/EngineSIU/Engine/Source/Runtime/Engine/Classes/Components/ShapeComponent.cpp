@@ -4,10 +4,3 @@
 UShapeComponent::UShapeComponent()
 {
 }
-
-void UShapeComponent::TickComponent(float DeltaTime)
-{
-    UPrimitiveComponent::TickComponent(DeltaTime);
-
-    UpdateOverlaps();
-}
@@ -18,8 +18,8 @@ class UShapeComponent : public UPrimitiveComponent
 public:
     UShapeComponent();
 
-    virtual void TickComponent(float DeltaTime) override;
-    
+    // Overlap은 매 틱 UWorld::Tick에서 FCollisionManager::UpdateOverlaps가 한 번에 갱신합니다.
+
     FColor ShapeColor = FColor(180, 180, 180, 255);
     bool bDrawOnlyIfSelected = true;
 
@@ -2,7 +2,10 @@
 #include "SkeletalMeshComponent.h"
 
 #include "ReferenceSkeleton.h"
+#include "Animation/AnimationLOD.h"
+#include "Animation/AnimationRuntime.h"
 #include "Animation/AnimSequence.h"
+#include "Animation/CPUSkinning.h"
 #include "Animation/Skeleton.h"
 #include "Engine/SkeletalMesh.h"
 #include "Engine/Asset/SkeletalMeshAsset.h"
@@ -10,6 +13,13 @@
 USkeletalMeshComponent::USkeletalMeshComponent()
 {
     AnimSequence = new UAnimSequence();
+    AnimSequence->InitializeTestAnimation();
+    AnimGraph.Play(0, AnimSequence);
+
+    // Pose 샘플링과 Bone 행렬 계산은 이 Component의 데이터만 쓰므로 Worker Thread에서 동시에 Tick
+    // World Transform은 TransformHierarchy가 갱신한 뒤에 읽도록 PostPhysics에서 Tick
+    SetTickOnAnyThread(true);
+    SetTickGroup(TG_PostPhysics);
 }
 
 USkeletalMeshComponent::~USkeletalMeshComponent()
@@ -29,46 +39,101 @@ void USkeletalMeshComponent::TickComponent(float DeltaTime)
 
     if (bPlayAnimation)
     {
-        ElapsedTime += DeltaTime;
+        AnimGraph.Update(DeltaTime);
     }
-    
-    BoneTransforms = BoneBindPoseTransforms;
-    
-    if (bPlayAnimation && AnimSequence && SkeletalMeshAsset && SkeletalMeshAsset->GetSkeleton())
-    {
-        const FReferenceSkeleton& RefSkeleton = SkeletalMeshAsset->GetSkeleton()->GetReferenceSkeleton();
 
-        const int32 AnimationFrameRate = AnimSequence->FrameRate;
-        const int32 AnimationLength = AnimSequence->NumFrames;
+    // 버퍼 크기는 SetSkeletalMeshAsset에서 정해지므로, 아래 대입과 샘플링은 힙 할당 없이 기존 버퍼를 덮어씀
+    if (bPlayAnimation && SkeletalMeshAsset && SkeletalMeshAsset->GetSkeleton())
+    {
+        FAnimationLOD::AddTickedComponent();
 
-        const float TargetKeyFrame = ElapsedTime * static_cast<float>(AnimationFrameRate);
-        const int32 CurrentKey = static_cast<int32>(TargetKeyFrame) % AnimationLength;
-        const int32 NextKey = (CurrentKey + 1) % AnimationLength;
-        const float Alpha = TargetKeyFrame - static_cast<float>(static_cast<int32>(TargetKeyFrame)); // [0 ~ 1]
-        
-        TMap<int32, FTransform> CurrentFrameTransforms = AnimSequence->Anim[CurrentKey];
-        TMap<int32, FTransform> NextFrameTransforms = AnimSequence->Anim[NextKey];
+        const int32 UpdateRate = bEnableUpdateRateOptimizations ? FAnimationLOD::GetUpdateRate(AnimLODLevel) : 1;
+        const int32 NumBones = BoneTransforms.Num();
 
-        for (auto& [BoneIdx, CurrentTransform] : CurrentFrameTransforms)
+        if (FramesUntilEvaluation <= 0 || UpdateRate != EvaluationUpdateRate)
         {
-            // 다음 키프레임에 해당 본 데이터가 있는지 확인
-            if (NextFrameTransforms.Contains(BoneIdx))
+            // 같은 틱에 생성되거나 같은 LOD로 바뀐 Component들이 같은 틱에 몰려서 계산하지 않도록,
+            // Update Rate가 정해질 때 UUID로 Component마다 다른 위상을 줌
+            if (UpdateRate != EvaluationUpdateRate)
             {
-                FTransform NextTransform = NextFrameTransforms[BoneIdx];
-                // 두 트랜스폼 사이를 Alpha 비율로 선형 보간
-                FTransform InterpolatedTransform = FTransform::Identity;
-                InterpolatedTransform.Blend(CurrentTransform, NextTransform, Alpha);
-        
-                // 보간된 트랜스폼 적용 (로컬 포즈 * 애니메이션 트랜스폼)
-                BoneTransforms[BoneIdx] =BoneBindPoseTransforms[BoneIdx] * InterpolatedTransform;
+                EvaluationUpdateRate = UpdateRate;
+                FramesUntilEvaluation = static_cast<int32>(GetUUID() % static_cast<uint32>(UpdateRate));
             }
             else
             {
-                // 다음 키프레임에 본 데이터가 없으면 현재 트랜스폼만 사용
-                BoneTransforms[BoneIdx] = BoneBindPoseTransforms[BoneIdx] * CurrentTransform;
+                FramesUntilEvaluation = UpdateRate - 1;
+            }
+
+            // 멀리 있으면 말단 Bone은 Bind Pose로 두고 나머지만 계산
+            const bool bSkipLeafBones = bEnableUpdateRateOptimizations && FAnimationLOD::ShouldSkipLeafBones(AnimLODLevel);
+            AnimGraph.Evaluate(AnimPose, bSkipLeafBones ? &NonLeafRequiredBones : nullptr);
+
+            const int32 NumEvaluatedBones = bSkipLeafBones ? NumNonLeafBones : NumBones;
+            FAnimationLOD::AddEvaluatedComponent(NumEvaluatedBones, NumBones - NumEvaluatedBones);
+
+            // 보간하면 새 Pose는 다음 계산까지의 프레임에 걸쳐 나타나므로, 지금 보이는 Pose에서 출발
+            InterpolationFrames = UpdateRate > 1 && FAnimationLOD::Settings.bInterpolate ? FramesUntilEvaluation + 1 : 0;
+            TArray<FTransform>& TargetPose = InterpolationFrames > 0 ? InterpolationTargetPose : BoneTransforms;
+            if (InterpolationFrames > 0)
+            {
+                InterpolationStartPose = BoneTransforms;
+            }
+
+            // 로컬 포즈 * 애니메이션 트랜스폼
+            for (int32 BoneIdx = 0; BoneIdx < NumBones; ++BoneIdx)
+            {
+                TargetPose[BoneIdx] = BoneBindPoseTransforms[BoneIdx] * AnimPose[BoneIdx];
+            }
+        }
+        else
+        {
+            --FramesUntilEvaluation;
+
+            // 보간하지 않으면 이전 Pose와 행렬을 그대로 사용
+            if (InterpolationFrames <= 0)
+            {
+                return;
+            }
+        }
+
+        if (InterpolationFrames > 0)
+        {
+            FAnimationLOD::AddInterpolatedComponent();
+
+            const float Alpha = FMath::Min(static_cast<float>(InterpolationFrames - FramesUntilEvaluation) / static_cast<float>(InterpolationFrames), 1.f);
+            for (int32 BoneIdx = 0; BoneIdx < NumBones; ++BoneIdx)
+            {
+                BoneTransforms[BoneIdx].Blend(InterpolationStartPose[BoneIdx], InterpolationTargetPose[BoneIdx], Alpha);
             }
         }
     }
+    else
+    {
+        BoneTransforms = BoneBindPoseTransforms;
+    }
+
+    RefreshBoneMatrices();
+}
+
+void USkeletalMeshComponent::PrepareTickOnAnyThread()
+{
+    USkinnedMeshComponent::PrepareTickOnAnyThread();
+
+    UpdateAnimLODLevel();
+}
+
+void USkeletalMeshComponent::UpdateAnimLODLevel()
+{
+    if (!bEnableUpdateRateOptimizations)
+    {
+        AnimLODLevel = 0;
+        return;
+    }
+
+    const FVector Scale = GetComponentScale3D();
+    const float MaxScale = FMath::Max(FMath::Abs(Scale.X), FMath::Max(FMath::Abs(Scale.Y), FMath::Abs(Scale.Z)));
+    const float ScreenSize = FAnimationLOD::ComputeScreenSize(GetComponentLocation(), BoundsRadius * MaxScale);
+    AnimLODLevel = FAnimationLOD::GetLODLevel(ScreenSize);
 }
 
 void USkeletalMeshComponent::SetSkeletalMeshAsset(USkeletalMesh* InSkeletalMeshAsset)
@@ -84,47 +149,68 @@ void USkeletalMeshComponent::SetSkeletalMeshAsset(USkeletalMesh* InSkeletalMeshA
         BoneTransforms.Add(RefSkeleton.RawRefBonePose[i]);
         BoneBindPoseTransforms.Add(RefSkeleton.RawRefBonePose[i]);
     }
+
+    AnimPose.SetNum(BoneTransforms.Num());
+    InterpolationStartPose.SetNum(BoneTransforms.Num());
+    InterpolationTargetPose.SetNum(BoneTransforms.Num());
+    NumNonLeafBones = FAnimationLOD::BuildNonLeafRequiredBones(RefSkeleton, NonLeafRequiredBones);
+    FramesUntilEvaluation = 0;
+    EvaluationUpdateRate = 0;
+    InterpolationFrames = 0;
+
+    RefreshBoneMatrices();
+
+    // 화면 크기 계산에 쓰는 반지름, Bind Pose의 Bone 위치로 근사
+    BoundsRadius = 0.f;
+    for (const FMatrix& BoneMatrix : ComponentSpaceBoneMatrices)
+    {
+        BoundsRadius = FMath::Max(BoundsRadius, BoneMatrix.GetOrigin().Length());
+    }
 }
 
 void USkeletalMeshComponent::GetCurrentGlobalBoneMatrices(TArray<FMatrix>& OutBoneMatrices) const
 {
     const FReferenceSkeleton& RefSkeleton = SkeletalMeshAsset->GetSkeleton()->GetReferenceSkeleton();
-    const TArray<FTransform>& BindPose = RefSkeleton.RawRefBonePose; // 로컬
-    const int32 BoneNum = RefSkeleton.RawRefBoneInfo.Num();
 
-    // 1. 현재 애니메이션 본 행렬 계산 (계층 구조 적용)
-    OutBoneMatrices.Empty();
-    OutBoneMatrices.SetNum(BoneNum);
+    // 현재 애니메이션 본 행렬 계산 (계층 구조 적용)
+    FAnimationRuntime::FillComponentSpaceMatrices(RefSkeleton, BoneTransforms, OutBoneMatrices);
+}
 
-    for (int32 BoneIndex = 0; BoneIndex < BoneNum; ++BoneIndex)
+bool USkeletalMeshComponent::GetCPUSkinnedVertices(FSkinnedVertexStreams& OutVertices, bool bParallel) const
+{
+    if (!SkeletalMeshAsset || !SkeletalMeshAsset->GetRenderData())
     {
-        // 현재 본의 로컬 변환
-        FTransform CurrentLocalTransform = BoneTransforms[BoneIndex];
-        FMatrix LocalMatrix = CurrentLocalTransform.ToMatrixWithScale(); // FTransform -> FMatrix
-        
-        // 부모 본의 영향을 적용하여 월드 변환 구성
-        int32 ParentIndex = RefSkeleton.RawRefBoneInfo[BoneIndex].ParentIndex;
-        if (ParentIndex != INDEX_NONE)
-        {
-            // 로컬 변환에 부모 월드 변환 적용
-            LocalMatrix = LocalMatrix * OutBoneMatrices[ParentIndex];
-        }
-        
-        // 결과 행렬 저장
-        OutBoneMatrices[BoneIndex] = LocalMatrix;
+        return false;
     }
+
+    return FCPUSkinning::SkinVertices(SkeletalMeshAsset->GetSkinningSourceStreams(), SkinningMatrices, OutVertices, bParallel);
 }
 
 void USkeletalMeshComponent::SetAnimationEnabled(bool bEnable)
 {
     bPlayAnimation = bEnable;
 
+    // 다음 Tick에서 바로 Pose를 계산
+    FramesUntilEvaluation = 0;
+    EvaluationUpdateRate = 0;
+    InterpolationFrames = 0;
+
     if (!bPlayAnimation)
     {
         if (SkeletalMeshAsset && SkeletalMeshAsset->GetSkeleton())
         {
             const FReferenceSkeleton& RefSkeleton = SkeletalMeshAsset->GetSkeleton()->GetReferenceSkeleton();
             BoneTransforms = RefSkeleton.RawRefBonePose;
+            RefreshBoneMatrices();
         }
     }
 }
+
+void USkeletalMeshComponent::RefreshBoneMatrices()
+{
+    if (SkeletalMeshAsset && SkeletalMeshAsset->GetSkeleton())
+    {
+        const FReferenceSkeleton& RefSkeleton = SkeletalMeshAsset->GetSkeleton()->GetReferenceSkeleton();
+        FAnimationRuntime::FillSkinningMatrices(RefSkeleton, BoneTransforms, ComponentSpaceBoneMatrices, SkinningMatrices);
+    }
+}
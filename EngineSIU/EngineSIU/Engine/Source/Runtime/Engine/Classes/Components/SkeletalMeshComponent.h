@@ -1,9 +1,11 @@
 #pragma once
 #include "SkinnedMeshComponent.h"
+#include "Animation/AnimGraph.h"
 #include "Engine/AssetManager.h"
 
 class UAnimSequence;
 class USkeletalMesh;
+struct FSkinnedVertexStreams;
 
 class USkeletalMeshComponent : public USkinnedMeshComponent
 {
@@ -13,27 +15,86 @@ public:
     USkeletalMeshComponent();
     virtual ~USkeletalMeshComponent() override;
 
+    /**
+     * Worker Thread에서 다른 Component와 동시에 호출됩니다. (CanTickOnAnyThread)
+     * 이 Component의 애니메이션 데이터만 쓰고, Transform을 바꾸거나 다른 UObject의 상태를 바꾸면 안 됩니다.
+     */
     void TickComponent(float DeltaTime) override;
 
+    /** 이번 Tick의 AnimLODLevel을 World Transform과 View로 계산합니다. */
+    void PrepareTickOnAnyThread() override;
+
     USkeletalMesh* GetSkeletalMeshAsset() const { return SkeletalMeshAsset; }
 
     void SetSkeletalMeshAsset(USkeletalMesh* InSkeletalMeshAsset);
 
     UAnimSequence* AnimSequence = nullptr;
 
+    // 재생할 Sequence와 Layer, 기본으로 Base Layer에서 AnimSequence를 재생
+    FAnimGraph& GetAnimGraph() { return AnimGraph; }
+    const FAnimGraph& GetAnimGraph() const { return AnimGraph; }
+
     TArray<FTransform> BoneTransforms;
 
     TArray<FTransform> BoneBindPoseTransforms; // 원본 BindPose에서 복사해온 에디팅을 위한 Transform
 
     void GetCurrentGlobalBoneMatrices(TArray<FMatrix>& OutBoneMatrices) const;
 
+    // 마지막 Tick에서 계산한 Component Space Bone 행렬
+    const TArray<FMatrix>& GetComponentSpaceBoneMatrices() const { return ComponentSpaceBoneMatrices; }
+
+    // 마지막 Tick에서 계산한 Skinning 행렬 (InverseBindPose * Component Space), 렌더링에서 그대로 사용
+    const TArray<FMatrix>& GetSkinningMatrices() const { return SkinningMatrices; }
+
+    // 현재 Pose로 CPU Skinning한 Vertex (Component Space), 렌더링 없이 충돌 검사나 툴에서 사용
+    bool GetCPUSkinnedVertices(FSkinnedVertexStreams& OutVertices, bool bParallel = true) const;
+
     void SetAnimationEnabled(bool bEnable);
+
+    // false면 거리와 관계없이 매 틱 모든 Bone의 Pose를 계산
+    bool bEnableUpdateRateOptimizations = true;
+
+    int32 GetAnimLODLevel() const { return AnimLODLevel; }
     
 private:
-    
+    // BoneTransforms가 바뀐 뒤 ComponentSpaceBoneMatrices와 SkinningMatrices를 다시 계산
+    void RefreshBoneMatrices();
+
+    // Active Viewport 카메라에서 본 화면 크기로 AnimLODLevel을 갱신, World Transform을 읽으므로 Main Thread에서만 호출
+    void UpdateAnimLODLevel();
+
     USkeletalMesh* SkeletalMeshAsset = nullptr;
 
-    float ElapsedTime = 0.f;
+    TArray<FMatrix> ComponentSpaceBoneMatrices;
+    TArray<FMatrix> SkinningMatrices;
+
+    FAnimGraph AnimGraph;
+
+    // AnimGraph에서 합성한 Pose, Bone 수 크기로 매 틱 재사용
+    TArray<FTransform> AnimPose;
+
+    /** Update Rate Optimization */
+    int32 AnimLODLevel = 0;
+
+    // 0이 되는 틱에 Pose를 계산, SetAnimationEnabled에서 0으로 되돌림
+    int32 FramesUntilEvaluation = 0;
+
+    // FramesUntilEvaluation을 정할 때의 Update Rate, 바뀌면 바로 계산하고 UUID로 다음 계산 시점을 흩음 (0이면 아직 정해지지 않음)
+    int32 EvaluationUpdateRate = 0;
+
+    // 보간 중이면 보간에 걸리는 프레임 수, 아니면 0
+    int32 InterpolationFrames = 0;
+
+    // 마지막 계산 직전에 보이던 Pose와 새로 계산한 Pose, 건너뛰는 프레임에 둘 사이를 보간
+    TArray<FTransform> InterpolationStartPose;
+    TArray<FTransform> InterpolationTargetPose;
+
+    // Bone LOD에서 계산할 Bone (자식이 있는 Bone만 1)
+    TArray<uint8> NonLeafRequiredBones;
+    int32 NumNonLeafBones = 0;
+
+    // Bind Pose에서 Component 원점으로부터 가장 먼 Bone까지의 거리
+    float BoundsRadius = 0.f;
 
     bool bPlayAnimation = false;
 };
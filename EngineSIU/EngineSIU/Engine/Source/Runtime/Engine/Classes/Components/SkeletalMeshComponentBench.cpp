@@ -0,0 +1,122 @@
+#include "SkeletalMeshComponent.h"
+
+#include "Animation/AnimBenchmarkUtils.h"
+#include "Animation/AnimSequence.h"
+#include "Animation/Skeleton.h"
+#include "Async/JobSystem.h"
+#include "Engine/SkeletalMesh.h"
+#include "HAL/PlatformMemory.h"
+#include "Misc/Benchmark.h"
+#include "UObject/ObjectFactory.h"
+#include "UObject/UObjectArray.h"
+#include "UserInterface/Console.h"
+
+namespace
+{
+    uint64 GetTotalAllocationCount()
+    {
+        return FPlatformMemory::GetTotalAllocationCount<EAT_Container>() + FPlatformMemory::GetTotalAllocationCount<EAT_Object>();
+    }
+
+    /**
+     * 렌더링 없이 Count개의 USkeletalMeshComponent를 한 Thread에서, 그리고 ParallelFor로 Tick합니다.
+     * 하나의 Sequence를 공유하며, Update Rate Optimization을 꺼서 매 Tick 모든 Bone을 계산하고,
+     * FPlatformMemory의 누적 할당 횟수로 Tick 동안의 힙 할당을 셉니다.
+     */
+    void RunSkeletalMeshBenchmark(const FBenchmarkContext& Context)
+    {
+        constexpr int32 NumBones = 60;
+        constexpr int32 NumTicks = 100;
+        constexpr float DeltaTime = 1.f / 60.f;
+        const int32 NumComponents = Context.Count;
+
+        FReferenceSkeleton RefSkeleton;
+        FAnimBenchmarkUtils::MakeReferenceSkeleton(NumBones, RefSkeleton);
+
+        USkeleton* Skeleton = FObjectFactory::ConstructObject<USkeleton>(nullptr);
+        Skeleton->SetReferenceSkeleton(RefSkeleton);
+
+        USkeletalMesh* SkeletalMesh = FObjectFactory::ConstructObject<USkeletalMesh>(nullptr);
+        SkeletalMesh->SetSkeleton(Skeleton);
+
+        UAnimSequence* Sequence = FObjectFactory::ConstructObject<UAnimSequence>(nullptr);
+        FAnimBenchmarkUtils::MakeAnimSequence(NumBones, 120, 30, *Sequence);
+
+        TArray<USkeletalMeshComponent*> Components;
+        Components.Reserve(NumComponents);
+        for (int32 Index = 0; Index < NumComponents; ++Index)
+        {
+            USkeletalMeshComponent* Component = FObjectFactory::ConstructObject<USkeletalMeshComponent>(nullptr);
+            Component->SetSkeletalMeshAsset(SkeletalMesh);
+            Component->bEnableUpdateRateOptimizations = false;
+
+            // 생성자에서 재생하는 테스트 Sequence 대신 공유 Sequence를 재생
+            Component->GetAnimGraph().GetLayer(0).Players.Empty();
+            Component->GetAnimGraph().Play(0, Sequence);
+            Component->SetAnimationEnabled(true);
+            Components.Add(Component);
+        }
+
+        // 첫 Tick에서 AnimGraph의 내부 버퍼가 Bone 수에 맞춰지므로 측정에서 제외
+        for (USkeletalMeshComponent* Component : Components)
+        {
+            Component->TickComponent(DeltaTime);
+        }
+
+        float Checksum = 0.f;
+        auto Measure = [&](const char* Label, auto&& TickAll)
+        {
+            const uint64 StartAllocations = GetTotalAllocationCount();
+            const double ElapsedMs = MeasureMilliseconds([&]
+            {
+                for (int32 Tick = 0; Tick < NumTicks; ++Tick)
+                {
+                    TickAll();
+                }
+            });
+            const uint64 Allocations = GetTotalAllocationCount() - StartAllocations;
+
+            for (USkeletalMeshComponent* Component : Components)
+            {
+                Checksum += Component->GetComponentSpaceBoneMatrices()[NumBones - 1].M[3][2];
+            }
+            Context.Console.AddLog(
+                ELogLevel::Display, "%-24s %8.2f ms/tick (%.2f us/component, %.1f allocations/tick)",
+                Label, ElapsedMs / NumTicks, ElapsedMs * 1e3 / (static_cast<double>(NumTicks) * NumComponents),
+                static_cast<double>(Allocations) / NumTicks
+            );
+        };
+
+        Measure("Serial", [&]()
+        {
+            for (USkeletalMeshComponent* Component : Components)
+            {
+                Component->TickComponent(DeltaTime);
+            }
+        });
+        Measure("ParallelFor", [&]()
+        {
+            FJobSystem::Get().ParallelFor(Components.Num(), [&Components, DeltaTime](int32 Index)
+            {
+                Components[Index]->TickComponent(DeltaTime);
+            }, 8);
+        });
+
+        for (USkeletalMeshComponent* Component : Components)
+        {
+            GUObjectArray.MarkRemoveObject(Component);
+        }
+        GUObjectArray.MarkRemoveObject(Sequence);
+        GUObjectArray.MarkRemoveObject(SkeletalMesh);
+        GUObjectArray.MarkRemoveObject(Skeleton);
+
+        Context.Console.AddLog(
+            ELogLevel::Display, "SkelMesh bench: %d components, %d bones, %d ticks, %d workers (checksum %g)",
+            NumComponents, NumBones, NumTicks, FJobSystem::Get().GetNumWorkers(), Checksum
+        );
+    }
+
+    FAutoRegisterBenchmark SkeletalMeshBenchmark(
+        "skelmesh bench", "[count]: Tick headless skeletal mesh components serially and with ParallelFor, counting heap allocations per tick", 1000, &RunSkeletalMeshBenchmark
+    );
+}
@@ -159,15 +159,15 @@ int UStaticMeshComponent::CheckRayIntersection(const FVector& InRayOrigin, const
 
     FStaticMeshRenderData* RenderData = StaticMesh->GetRenderData();
 
-    const TArray<FStaticMeshVertex>& Vertices = RenderData->Vertices;
-    const int32 VertexNum = Vertices.Num();
+    const FStaticMeshVertex* Vertices = RenderData->GetVertexData();
+    const int32 VertexNum = RenderData->GetNumVertices();
     if (VertexNum == 0)
     {
         return 0;
     }
     
-    const TArray<UINT>& Indices = RenderData->Indices;
-    const int32 IndexNum = Indices.Num();
+    const UINT* Indices = RenderData->GetIndexData();
+    const int32 IndexNum = RenderData->GetNumIndices();
     const bool bHasIndices = (IndexNum > 0);
     
     int32 TriangleNum = bHasIndices ? (IndexNum / 3) : (VertexNum / 3);
@@ -1,8 +1,11 @@
 #pragma once
 
+#include <memory>
+
 #include "Define.h"
 #include "Hal/PlatformType.h"
 #include "Container/Array.h"
+#include "Engine/StaticMeshPackage.h"
 
 struct FStaticMeshVertex
 {
@@ -27,4 +30,13 @@ struct FStaticMeshRenderData
 
     FVector BoundingBoxMin;
     FVector BoundingBoxMax;
+
+    // .smesh에서 읽었으면 Vertices/Indices는 비어 있고, Vertex/Index는 이 Package의 Mapping을 가리킴
+    std::shared_ptr<const FStaticMeshPackage> Package;
+
+    const FStaticMeshVertex* GetVertexData() const { return Package ? Package->GetVertices() : Vertices.GetData(); }
+    int32 GetNumVertices() const { return Package ? Package->GetNumVertices() : Vertices.Num(); }
+
+    const UINT* GetIndexData() const { return Package ? Package->GetIndices() : Indices.GetData(); }
+    int32 GetNumIndices() const { return Package ? Package->GetNumIndices() : Indices.Num(); }
 };
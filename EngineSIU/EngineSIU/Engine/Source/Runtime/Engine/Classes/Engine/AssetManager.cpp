@@ -1,16 +1,40 @@
 #include "AssetManager.h"
 #include "Engine.h"
 
+#include <cstring>
 #include <filesystem>
 
+#include "FbxCookedCache.h"
 #include "FbxLoader.h"
+#include "WindowsPlatformTime.h"
+#include "Animation/AnimSequence.h"
 #include "Animation/Skeleton.h"
 #include "SkeletalMesh.h"
 #include "Components/Material/Material.h"
 #include "Engine/FObjLoader.h"
 #include "UObject/Casts.h"
+#include "UObject/ObjectFactory.h"
+#include "UObject/UObjectArray.h"
 #include "Asset/SkeletalMeshAsset.h"
 
+namespace
+{
+    /** FBX의 AnimStack 이름은 "Armature|Action"처럼 파일 이름에 쓸 수 없는 문자를 포함하므로 '_'로 바꿈 */
+    FString SanitizeAssetFileName(const FString& Name)
+    {
+        FString Result = Name;
+        for (int32 Index = 0; Index < Result.Len(); ++Index)
+        {
+            TCHAR& Char = Result[Index];
+            if (Char < 0x20 || (Char < 0x80 && std::strchr("<>:\"/\\|?*", static_cast<char>(Char)) != nullptr))
+            {
+                Char = '_';
+            }
+        }
+        return Result;
+    }
+}
+
 UAssetManager::~UAssetManager()
 {
     for (auto& [Name, Object] : SkeletonMap)
@@ -52,6 +76,16 @@ UAssetManager::~UAssetManager()
         }
     }
     MaterialMap.Empty();
+
+    for (auto& [Name, Object] : AnimationMap)
+    {
+        if (Object)
+        {
+            delete Object;
+            Object = nullptr;
+        }
+    }
+    AnimationMap.Empty();
 }
 
 bool UAssetManager::IsInitialized()
@@ -131,6 +165,15 @@ UMaterial* UAssetManager::GetMaterial(const FName& Name)
     return nullptr;
 }
 
+UAnimSequence* UAssetManager::GetAnimation(const FName& Name)
+{
+    if (AnimationMap.Contains(Name))
+    {
+        return AnimationMap[Name];
+    }
+    return nullptr;
+}
+
 void UAssetManager::AddAssetInfo(const FAssetInfo& Info)
 {
     AssetRegistry->PathNameToAssetInfo.Add(Info.AssetName, Info);
@@ -151,9 +194,18 @@ void UAssetManager::AddMaterial(const FName& Key, UMaterial* Material)
     MaterialMap.Add(Key, Material);
 }
 
+void UAssetManager::AddAnimation(const FName& Key, UAnimSequence* Animation)
+{
+    AnimationMap.Add(Key, Animation);
+}
+
 void UAssetManager::LoadContentFiles()
 {
     const std::string BasePathName = "Contents/";
+    const uint64 StartCycles = FPlatformTime::Cycles64();
+
+    // -nofbxcache: Cooked Cache를 읽지 않고 모든 FBX를 Import, Cache 적용 전후의 시작 시간을 같은 환경에서 비교할 때 사용
+    const bool bUseFbxCookedCache = std::strstr(GetCommandLineA(), "-nofbxcache") == nullptr;
 
     // Obj 파일 로드
     
@@ -181,9 +233,21 @@ void UAssetManager::LoadContentFiles()
             const FString FilePath = Entry.path().parent_path().string() + "/" + Entry.path().filename().string();
             const FString FileNameWithoutExt = Entry.path().stem().filename().string();
 
-            // FBX 로더로 파일 읽기
-            FFbxLoader Loader;
-            FFbxLoadResult Result = Loader.LoadFBX(FilePath);
+            // Cooked Cache가 유효하면 FBX SDK Import를 건너뜀
+            const uint64 FbxStartCycles = FPlatformTime::Cycles64();
+            FFbxLoadResult Result;
+            const bool bLoadedFromCache = bUseFbxCookedCache && FFbxCookedCache::Load(FilePath, Result);
+            if (!bLoadedFromCache)
+            {
+                FFbxLoader Loader;
+                Result = Loader.LoadFBX(FilePath);
+                FFbxCookedCache::Save(FilePath, Result);
+            }
+            UE_LOG(
+                ELogLevel::Display, TEXT("%s %s: %.2f ms"),
+                bLoadedFromCache ? TEXT("Loaded cooked") : TEXT("Imported"), *FilePath,
+                FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - FbxStartCycles)
+            );
 
             // AssetInfo 기본 필드 세팅
             FAssetInfo AssetInfo = {};
@@ -245,6 +309,66 @@ void UAssetManager::LoadContentFiles()
                 FString Key = Info.PackagePath.ToString() + "/" + Info.AssetName.ToString();
                 MaterialMap.Add(Key, Material);
             }
+
+            // 로드된 Animation 등록, 런타임에 FBX SDK 없이 읽을 수 있도록 .anim으로 구워둠
+            for (int32 i = 0; i < Result.Animations.Num(); ++i)
+            {
+                UAnimSequence* Animation = Result.Animations[i];
+
+                FAssetInfo Info = AssetInfo;
+                Info.AssetName = FName(SanitizeAssetFileName(FileNameWithoutExt + "_" + Animation->GetName()));
+                Info.AssetType = EAssetType::Animation;
+                AssetRegistry->PathNameToAssetInfo.Add(Info.AssetName, Info);
+
+                FString Key = Info.PackagePath.ToString() + "/" + Info.AssetName.ToString();
+                AnimationMap.Add(Key, Animation);
+
+                // Cache에서 읽었으면 .anim도 이미 구워져 있음
+                if (bLoadedFromCache)
+                {
+                    continue;
+                }
+
+                const std::filesystem::path BinaryPath = Entry.path().parent_path() / (Info.AssetName.ToString() + ".anim").ToWideString();
+                if (!Animation->SaveToBinary(BinaryPath.wstring()))
+                {
+                    UE_LOG(ELogLevel::Warning, TEXT("Failed to save animation: %s"), *Key);
+                }
+            }
         }
     }
+
+    // FBX에서 Import하지 않은 .anim 파일 로드 (FBX 원본이 없는 경우)
+    for (const auto& Entry : std::filesystem::recursive_directory_iterator(BasePathName))
+    {
+        if (!Entry.is_regular_file() || Entry.path().extension() != ".anim")
+        {
+            continue;
+        }
+
+        FAssetInfo Info = {};
+        Info.AssetName = FName(Entry.path().stem().string());
+        Info.PackagePath = FName(Entry.path().parent_path().wstring());
+        Info.AssetType = EAssetType::Animation;
+        Info.Size = static_cast<uint32>(std::filesystem::file_size(Entry.path()));
+
+        FString Key = Info.PackagePath.ToString() + "/" + Info.AssetName.ToString();
+        if (AnimationMap.Contains(Key))
+        {
+            continue;
+        }
+
+        UAnimSequence* Animation = FObjectFactory::ConstructObject<UAnimSequence>(nullptr, Info.AssetName);
+        if (!Animation->LoadFromBinary(Entry.path().wstring()))
+        {
+            UE_LOG(ELogLevel::Warning, TEXT("Failed to load animation: %s"), *Key);
+            GUObjectArray.MarkRemoveObject(Animation);
+            continue;
+        }
+
+        AssetRegistry->PathNameToAssetInfo.Add(Info.AssetName, Info);
+        AnimationMap.Add(Key, Animation);
+    }
+
+    UE_LOG(ELogLevel::Display, TEXT("Content files loaded: %.2f ms"), FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles));
 }
@@ -5,6 +5,7 @@
 
 class USkeleton;
 class USkeletalMesh;
+class UAnimSequence;
 
 enum class EAssetType : uint8
 {
@@ -35,7 +36,7 @@ struct FFbxLoadResult
     TArray<USkeletalMesh*> SkeletalMeshes;
     TArray<UStaticMesh*> StaticMeshes;
     TArray<UMaterial*> Materials;
-    // TArray<UAnimation*> Animations;
+    TArray<UAnimSequence*> Animations;
 };
 
 class UAssetManager : public UObject
@@ -66,11 +67,13 @@ public:
     UStaticMesh* GetStaticMesh(const FName& Name);
     USkeleton* GetSkeleton(const FName& Name);
     UMaterial* GetMaterial(const FName& Name);
+    UAnimSequence* GetAnimation(const FName& Name);
 
     void AddAssetInfo(const FAssetInfo& Info);
     void AddSkeleton(const FName& Key, USkeleton* Skeleton);
     void AddSkeletalMesh(const FName& Key, USkeletalMesh* Mesh);
     void AddMaterial(const FName& Key, UMaterial* Material);
+    void AddAnimation(const FName& Key, UAnimSequence* Animation);
 
 private:
     void LoadContentFiles();
@@ -79,5 +82,5 @@ private:
     inline static TMap<FName, USkeletalMesh*> SkeletalMeshMap;
     inline static TMap<FName, UStaticMesh*> StaticMeshMap;
     inline static TMap<FName, UMaterial*> MaterialMap;
-    // inline static TMap<FName, UAnimation*> AnimationMap;
+    inline static TMap<FName, UAnimSequence*> AnimationMap;
 };
@@ -66,20 +66,10 @@ void UEditorEngine::Tick(float DeltaTime)
             if (UWorld* World = WorldContext->World())
             {
                 // TODO: World에서 EditorPlayer 제거 후 Tick 호출 제거 필요.
-                World->Tick(DeltaTime);
                 EditorPlayer->Tick(DeltaTime);
-                ULevel* Level = World->GetActiveLevel();
-                TArray CachedActors = Level->Actors;
-                if (Level)
-                {
-                    for (AActor* Actor : CachedActors)
-                    {
-                        if (Actor && Actor->IsActorTickInEditor())
-                        {
-                            Actor->Tick(DeltaTime);
-                        }
-                    }
-                }
+
+                // Actor들의 Tick은 World의 Tick에서 ETickingGroup 순서대로 실행
+                World->Tick(DeltaTime);
             }
         }
         else if (WorldContext->WorldType == EWorldType::PIE)
@@ -87,38 +77,14 @@ void UEditorEngine::Tick(float DeltaTime)
             if (UWorld* World = WorldContext->World())
             {
                 World->Tick(DeltaTime);
-                ULevel* Level = World->GetActiveLevel();
-                TArray CachedActors = Level->Actors;
-                if (Level)
-                {
-                    for (AActor* Actor : CachedActors)
-                    {
-                        if (Actor)
-                        {
-                            Actor->Tick(DeltaTime);
-                        }
-                    }
-                }
             }
         }
         else if (WorldContext->WorldType == EWorldType::SkeletalViewer)
         {
             if (UWorld* World = WorldContext->World())
             {
-                World->Tick(DeltaTime);
                 EditorPlayer->Tick(DeltaTime);
-                ULevel* Level = World->GetActiveLevel();
-                TArray CachedActors = Level->Actors;
-                if (Level)
-                {
-                    for (AActor* Actor : CachedActors)
-                    {
-                        if (Actor && Actor->IsActorTickInEditor())
-                        {
-                            Actor->Tick(DeltaTime);
-                        }
-                    }
-                }
+                World->Tick(DeltaTime);
             }
         }
     }
@@ -13,3 +13,21 @@ namespace EEndPlayReason
         Quit,
     };
 }
+
+/**
+ * World의 Tick에서 Actor와 Component의 Tick이 실행되는 단계
+ * 그룹 순서대로 실행되며, 같은 그룹 안의 AnyThread Component Tick은 동시에 실행될 수 있습니다.
+ */
+enum ETickingGroup : uint8
+{
+    /** World의 Transform, Overlap을 갱신하기 전 */
+    TG_PrePhysics,
+
+    /** World의 Transform, Overlap을 갱신한 후 */
+    TG_PostPhysics,
+
+    /** 다른 모든 Tick이 끝난 후, Camera처럼 이번 프레임의 최종 결과를 사용하는 작업 */
+    TG_PostUpdateWork,
+
+    TG_MAX,
+};
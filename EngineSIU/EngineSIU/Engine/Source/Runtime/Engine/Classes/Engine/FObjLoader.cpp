@@ -5,10 +5,25 @@
 #include "Engine/StaticMesh.h"
 
 #include "Asset/StaticMeshAsset.h"
+#include "StaticMeshPackage.h"
 
+#include <cstring>
 #include <fstream>
 #include <sstream>
 
+namespace
+{
+    // 변환해서 저장한 직후에는 Checksum까지 검사하고, 통과하면 방금 만든 Vertices/Indices 대신 Mapping을 사용
+    void SavePackageAndMap(const FWString& PackagePath, FStaticMeshRenderData& StaticMesh)
+    {
+        FStaticMeshRenderData MappedStaticMesh;
+        if (FStaticMeshPackage::Save(PackagePath, StaticMesh) && FStaticMeshPackage::Load(PackagePath, MappedStaticMesh, true))
+        {
+            StaticMesh = std::move(MappedStaticMesh);
+        }
+    }
+}
+
 bool FObjLoader::ParseOBJ(const FString& ObjFilePath, FObjInfo& OutObjInfo)
 {
     std::ifstream OBJ(ObjFilePath.ToWideString());
@@ -643,11 +658,25 @@ FStaticMeshRenderData* FObjManager::LoadObjStaticMeshAsset(const FString& PathFi
         return *It;
     }
 
-    FWString BinaryPath = (PathFileName + ".bin").ToWideString();
+    // 이미 변환된 .smesh는 Header/Section만 검사, -verifysmesh를 주면 Checksum까지 검사
+    static const bool bVerifyPackageChecksum = std::strstr(GetCommandLineA(), "-verifysmesh") != nullptr;
+
+    const FWString PackagePath = (PathFileName + ".smesh").ToWideString();
+    if (FStaticMeshPackage::Load(PackagePath, *NewStaticMesh, bVerifyPackageChecksum))
+    {
+        LoadTextures(*NewStaticMesh);
+        ObjStaticMeshMap.Add(PathFileName, NewStaticMesh);
+        return NewStaticMesh;
+    }
+
+    // 이전 형식의 .bin만 있으면 .smesh로 변환
+    const FWString BinaryPath = (PathFileName + ".bin").ToWideString();
     if (std::ifstream(BinaryPath).good())
     {
         if (LoadStaticMeshFromBinary(BinaryPath, *NewStaticMesh))
         {
+            SavePackageAndMap(PackagePath, *NewStaticMesh);
+            LoadTextures(*NewStaticMesh);
             ObjStaticMeshMap.Add(PathFileName, NewStaticMesh);
             return NewStaticMesh;
         }
@@ -689,7 +718,7 @@ FStaticMeshRenderData* FObjManager::LoadObjStaticMeshAsset(const FString& PathFi
         return nullptr;
     }
 
-    SaveStaticMeshToBinary(BinaryPath, *NewStaticMesh); 
+    SavePackageAndMap(PackagePath, *NewStaticMesh);
     ObjStaticMeshMap.Add(PathFileName, NewStaticMesh);
     return NewStaticMesh;
 }
@@ -710,82 +739,6 @@ void FObjManager::CombineMaterialIndex(FStaticMeshRenderData& OutFStaticMesh)
     }
 }
 
-bool FObjManager::SaveStaticMeshToBinary(const FWString& FilePath, const FStaticMeshRenderData& StaticMesh)
-{
-    std::ofstream File(FilePath, std::ios::binary);
-    if (!File.is_open())
-    {
-        assert("CAN'T SAVE STATIC MESH BINARY FILE");
-        return false;
-    }
-
-    // Object Name
-    Serializer::WriteFWString(File, StaticMesh.ObjectName);
-
-    // Display Name
-    Serializer::WriteFString(File, StaticMesh.DisplayName);
-
-    // Vertices
-    uint32 VertexCount = StaticMesh.Vertices.Num();
-    File.write(reinterpret_cast<const char*>(&VertexCount), sizeof(VertexCount));
-    File.write(reinterpret_cast<const char*>(StaticMesh.Vertices.GetData()), VertexCount * sizeof(FStaticMeshVertex));
-
-    // Indices
-    uint32 IndexCount = StaticMesh.Indices.Num();
-    File.write(reinterpret_cast<const char*>(&IndexCount), sizeof(IndexCount));
-    File.write(reinterpret_cast<const char*>(StaticMesh.Indices.GetData()), IndexCount * sizeof(UINT));
-
-    // Materials
-    uint32 MaterialCount = StaticMesh.Materials.Num();
-    File.write(reinterpret_cast<const char*>(&MaterialCount), sizeof(MaterialCount));
-    for (const FMaterialInfo& Material : StaticMesh.Materials)
-    {
-        Serializer::WriteFString(File, Material.MaterialName);
-        
-        File.write(reinterpret_cast<const char*>(&Material.TextureFlag), sizeof(Material.TextureFlag));
-        
-        File.write(reinterpret_cast<const char*>(&Material.bTransparent), sizeof(Material.bTransparent));
-        File.write(reinterpret_cast<const char*>(&Material.DiffuseColor), sizeof(Material.DiffuseColor));
-        File.write(reinterpret_cast<const char*>(&Material.SpecularColor), sizeof(Material.SpecularColor));
-        File.write(reinterpret_cast<const char*>(&Material.AmbientColor), sizeof(Material.AmbientColor));
-        File.write(reinterpret_cast<const char*>(&Material.EmissiveColor), sizeof(Material.EmissiveColor));
-        
-        File.write(reinterpret_cast<const char*>(&Material.Shininess), sizeof(Material.Shininess));
-        File.write(reinterpret_cast<const char*>(&Material.IOR), sizeof(Material.IOR));
-        File.write(reinterpret_cast<const char*>(&Material.Transparency), sizeof(Material.Transparency));
-        File.write(reinterpret_cast<const char*>(&Material.BumpMultiplier), sizeof(Material.BumpMultiplier));
-        File.write(reinterpret_cast<const char*>(&Material.IlluminanceModel), sizeof(Material.IlluminanceModel));
-
-        File.write(reinterpret_cast<const char*>(&Material.Metallic), sizeof(Material.Metallic));
-        File.write(reinterpret_cast<const char*>(&Material.Roughness), sizeof(Material.Roughness));
-
-        for (uint8 i = 0; i < static_cast<uint8>(EMaterialTextureSlots::MTS_MAX); ++i)
-        {
-            Serializer::WriteFString(File, Material.TextureInfos[i].TextureName);
-            Serializer::WriteFWString(File, Material.TextureInfos[i].TexturePath);
-            File.write(reinterpret_cast<const char*>(&Material.TextureInfos[i].bIsSRGB), sizeof(Material.TextureInfos[i].bIsSRGB));
-        }
-    }
-
-    // Material Subsets
-    uint32 SubsetCount = StaticMesh.MaterialSubsets.Num();
-    File.write(reinterpret_cast<const char*>(&SubsetCount), sizeof(SubsetCount));
-    for (const FMaterialSubset& Subset : StaticMesh.MaterialSubsets)
-    {
-        Serializer::WriteFString(File, Subset.MaterialName);
-        File.write(reinterpret_cast<const char*>(&Subset.IndexStart), sizeof(Subset.IndexStart));
-        File.write(reinterpret_cast<const char*>(&Subset.IndexCount), sizeof(Subset.IndexCount));
-        File.write(reinterpret_cast<const char*>(&Subset.MaterialIndex), sizeof(Subset.MaterialIndex));
-    }
-
-    // Bounding Box
-    File.write(reinterpret_cast<const char*>(&StaticMesh.BoundingBoxMin), sizeof(FVector));
-    File.write(reinterpret_cast<const char*>(&StaticMesh.BoundingBoxMax), sizeof(FVector));
-
-    File.close();
-    return true;
-}
-
 bool FObjManager::LoadStaticMeshFromBinary(const FWString& FilePath, FStaticMeshRenderData& OutStaticMesh)
 {
     std::ifstream File(FilePath, std::ios::binary);
@@ -795,8 +748,6 @@ bool FObjManager::LoadStaticMeshFromBinary(const FWString& FilePath, FStaticMesh
         return false;
     }
 
-    TArray<TPair<FWString, bool>> Textures;
-
     // Object Name
     Serializer::ReadFWString(File, OutStaticMesh.ObjectName);
 
@@ -849,8 +800,6 @@ bool FObjManager::LoadStaticMeshFromBinary(const FWString& FilePath, FStaticMesh
             Serializer::ReadFString(File, Material.TextureInfos[i].TextureName);
             Serializer::ReadFWString(File, Material.TextureInfos[i].TexturePath);
             File.read(reinterpret_cast<char*>(&Material.TextureInfos[i].bIsSRGB), sizeof(Material.TextureInfos[i].bIsSRGB));
-
-            Textures.AddUnique({Material.TextureInfos[i].TexturePath, Material.TextureInfos[i].bIsSRGB});
         }
     }
 
@@ -870,21 +819,21 @@ bool FObjManager::LoadStaticMeshFromBinary(const FWString& FilePath, FStaticMesh
     File.read(reinterpret_cast<char*>(&OutStaticMesh.BoundingBoxMin), sizeof(FVector));
     File.read(reinterpret_cast<char*>(&OutStaticMesh.BoundingBoxMax), sizeof(FVector));
 
-    File.close();
+    return static_cast<bool>(File);
+}
 
-    // Texture Load
-    if (Textures.Num() > 0)
+void FObjManager::LoadTextures(const FStaticMeshRenderData& StaticMesh)
+{
+    for (const FMaterialInfo& Material : StaticMesh.Materials)
     {
-        for (const TPair<FWString, bool>& Texture : Textures)
+        for (const FTextureInfo& Texture : Material.TextureInfos)
         {
-            if (FEngineLoop::ResourceManager.GetTexture(Texture.Key) == nullptr)
+            if (!Texture.TexturePath.empty() && FEngineLoop::ResourceManager.GetTexture(Texture.TexturePath) == nullptr)
             {
-                FEngineLoop::ResourceManager.LoadTextureFromFile(FEngineLoop::GraphicDevice.Device, Texture.Key.c_str(), Texture.Value);
+                FEngineLoop::ResourceManager.LoadTextureFromFile(FEngineLoop::GraphicDevice.Device, Texture.TexturePath.c_str(), Texture.bIsSRGB);
             }
         }
     }
-
-    return true;
 }
 
 UMaterial* FObjManager::CreateMaterial(FMaterialInfo materialInfo)
@@ -37,8 +37,7 @@ public:
 
     static void CombineMaterialIndex(FStaticMeshRenderData& OutFStaticMesh);
 
-    static bool SaveStaticMeshToBinary(const FWString& FilePath, const FStaticMeshRenderData& StaticMesh);
-
+    // 이전 형식의 .bin, 새로 저장할 때는 FStaticMeshPackage(.smesh)를 사용
     static bool LoadStaticMeshFromBinary(const FWString& FilePath, FStaticMeshRenderData& OutStaticMesh);
 
     static UMaterial* CreateMaterial(FMaterialInfo materialInfo);
@@ -58,6 +57,8 @@ public:
     static int GetStaticMeshNum() { return StaticMeshMap.Num(); }
 
 private:
+    static void LoadTextures(const FStaticMeshRenderData& StaticMesh);
+
     inline static TMap<FString, FStaticMeshRenderData*> ObjStaticMeshMap;
     inline static TMap<FWString, UStaticMesh*> StaticMeshMap;
     inline static TMap<FString, UMaterial*> MaterialMap;
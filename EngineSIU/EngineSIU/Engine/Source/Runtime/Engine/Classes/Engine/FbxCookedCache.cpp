@@ -0,0 +1,379 @@
+#include "FbxCookedCache.h"
+
+#include <filesystem>
+#include <fstream>
+
+#include "AssetManager.h"
+#include "FObjLoader.h"
+#include "SkeletalMesh.h"
+#include "StaticMesh.h"
+#include "Animation/AnimSequence.h"
+#include "Animation/Skeleton.h"
+#include "Asset/SkeletalMeshAsset.h"
+#include "Asset/StaticMeshAsset.h"
+#include "Components/Material/Material.h"
+#include "Misc/Hash.h"
+#include "Serialization/MemoryArchive.h"
+#include "UObject/ObjectFactory.h"
+#include "UObject/UObjectArray.h"
+
+
+namespace
+{
+    /** Trivially Copyable이 아닌 원소의 배열을 원소별 함수로 직렬화 */
+    template <typename T, typename FuncType>
+    void SerializeEach(FArchive& Ar, TArray<T>& Array, FuncType&& SerializeElement)
+    {
+        int32 Num = Array.Num();
+        Ar << Num;
+
+        if (Ar.IsLoading())
+        {
+            Ar.CheckLoadedNum(Num, 1);
+            Array.SetNum(Num);
+        }
+        for (T& Element : Array)
+        {
+            SerializeElement(Ar, Element);
+        }
+    }
+
+    template <typename RenderDataType>
+    void SerializeRenderData(FArchive& Ar, RenderDataType& RenderData)
+    {
+        Ar << RenderData.ObjectName << RenderData.DisplayName;
+
+        BulkSerialize(Ar, RenderData.Vertices);
+        BulkSerialize(Ar, RenderData.Indices);
+
+        Ar << RenderData.Materials << RenderData.MaterialSubsets;
+        Ar << RenderData.BoundingBoxMin << RenderData.BoundingBoxMax;
+    }
+
+    void SerializeReferenceSkeleton(FArchive& Ar, FReferenceSkeleton& RefSkeleton)
+    {
+        Ar << RefSkeleton.RawRefBoneInfo;
+        BulkSerialize(Ar, RefSkeleton.RawRefBonePose);
+        BulkSerialize(Ar, RefSkeleton.InverseBindPoseMatrices);
+
+        // Name -> Index Map은 저장하지 않고 Bone 순서로 다시 만듦
+        if (Ar.IsLoading())
+        {
+            RefSkeleton.RawNameToIndexMap.Empty();
+            for (int32 BoneIndex = 0; BoneIndex < RefSkeleton.RawRefBoneInfo.Num(); ++BoneIndex)
+            {
+                RefSkeleton.RawNameToIndexMap.Add(RefSkeleton.RawRefBoneInfo[BoneIndex].Name, BoneIndex);
+            }
+        }
+    }
+
+    void LoadMaterialTextures(const FMaterialInfo& Info)
+    {
+        for (const FTextureInfo& TextureInfo : Info.TextureInfos)
+        {
+            if (!TextureInfo.TexturePath.empty())
+            {
+                FObjLoader::CreateTextureFromFile(TextureInfo.TexturePath, TextureInfo.bIsSRGB);
+            }
+        }
+    }
+}
+
+
+bool FFbxCookedCache::Load(const FString& FbxFilePath, FFbxLoadResult& OutResult)
+{
+    const FWString SourcePath = FbxFilePath.ToWideString();
+    uint64 CurrentSourceSize = 0;
+    int64 CurrentSourceWriteTime = 0;
+    TArray<uint8> CacheData;
+    if (!GetSourceStamp(SourcePath, CurrentSourceSize, CurrentSourceWriteTime) || !ReadFile(GetCachePath(FbxFilePath), CacheData))
+    {
+        return false;
+    }
+
+    struct FCookedMaterial
+    {
+        FString Name;
+        FMaterialInfo Info;
+    };
+
+    struct FCookedSkeletalMesh
+    {
+        int32 SkeletonIndex = INDEX_NONE;
+        std::unique_ptr<FSkeletalMeshRenderData> RenderData;
+    };
+
+    // 끝까지 읽은 뒤에 UObject를 만들어서, 중간에 실패해도 등록된 Asset이 남지 않게 함
+    TArray<FCookedMaterial> Materials;
+    TArray<FReferenceSkeleton> Skeletons;
+    TArray<FCookedSkeletalMesh> SkeletalMeshes;
+    TArray<std::unique_ptr<FStaticMeshRenderData>> StaticMeshes;
+    TArray<UAnimSequence*> Animations;
+
+    // 수정 시각만 바뀌고 내용이 같으면 Cache의 수정 시각을 갱신해서 다음부터 Hash를 건너뜀
+    bool bRefreshSourceWriteTime = false;
+
+    FMemoryReader Reader(CacheData);
+    FArchive& Ar = Reader;
+    try
+    {
+        uint32 Magic = 0;
+        uint32 InCacheVersion = 0;
+        uint32 InImporterVersion = 0;
+        uint64 SourceSize = 0;
+        int64 SourceWriteTime = 0;
+        uint64 SourceHash = 0;
+        Ar << Magic << InCacheVersion << InImporterVersion << SourceSize << SourceWriteTime << SourceHash;
+
+        if (Magic != CacheMagic
+            || InCacheVersion != CacheVersion
+            || InImporterVersion != ImporterVersion
+            || SourceSize != CurrentSourceSize)
+        {
+            return false;
+        }
+
+        if (SourceWriteTime != CurrentSourceWriteTime)
+        {
+            TArray<uint8> SourceData;
+            if (!ReadFile(SourcePath, SourceData)
+                || static_cast<uint64>(SourceData.Num()) != SourceSize
+                || FHash::Fnv1a64(SourceData.GetData(), SourceData.Num()) != SourceHash)
+            {
+                return false;
+            }
+            bRefreshSourceWriteTime = true;
+        }
+
+        SerializeEach(Ar, Materials, [](FArchive& Ar, FCookedMaterial& Material)
+        {
+            Ar << Material.Name << Material.Info;
+        });
+
+        SerializeEach(Ar, Skeletons, SerializeReferenceSkeleton);
+
+        SerializeEach(Ar, SkeletalMeshes, [](FArchive& Ar, FCookedSkeletalMesh& Mesh)
+        {
+            Ar << Mesh.SkeletonIndex;
+            Mesh.RenderData = std::make_unique<FSkeletalMeshRenderData>();
+            SerializeRenderData(Ar, *Mesh.RenderData);
+        });
+
+        SerializeEach(Ar, StaticMeshes, [](FArchive& Ar, std::unique_ptr<FStaticMeshRenderData>& RenderData)
+        {
+            RenderData = std::make_unique<FStaticMeshRenderData>();
+            SerializeRenderData(Ar, *RenderData);
+        });
+
+        int32 NumAnimations = 0;
+        Ar << NumAnimations;
+        Ar.CheckLoadedNum(NumAnimations, 1);
+        for (int32 AnimIndex = 0; AnimIndex < NumAnimations; ++AnimIndex)
+        {
+            FString Name;
+            Ar << Name;
+
+            UAnimSequence* Animation = FObjectFactory::ConstructObject<UAnimSequence>(nullptr, FName(Name));
+            Animations.Add(Animation);
+            Animation->Serialize(Ar);
+        }
+
+        if (Ar.Tell() != CacheData.Num())
+        {
+            throw std::runtime_error("Unexpected data at the end of the cooked cache.");
+        }
+    }
+    catch (const std::exception& Exception)
+    {
+        UE_LOG(ELogLevel::Warning, TEXT("Invalid cooked cache for %s: %s"), *FbxFilePath, Exception.what());
+        for (UAnimSequence* Animation : Animations)
+        {
+            GUObjectArray.MarkRemoveObject(Animation);
+        }
+        return false;
+    }
+
+    FFbxLoadResult Result;
+
+    for (FCookedMaterial& Material : Materials)
+    {
+        LoadMaterialTextures(Material.Info);
+
+        UMaterial* NewMaterial = FObjectFactory::ConstructObject<UMaterial>(nullptr, FName(Material.Name));
+        NewMaterial->SetMaterialInfo(Material.Info);
+        Result.Materials.Add(NewMaterial);
+    }
+
+    for (const FReferenceSkeleton& RefSkeleton : Skeletons)
+    {
+        USkeleton* NewSkeleton = FObjectFactory::ConstructObject<USkeleton>(nullptr);
+        NewSkeleton->SetReferenceSkeleton(RefSkeleton);
+        Result.Skeletons.Add(NewSkeleton);
+    }
+
+    for (FCookedSkeletalMesh& Mesh : SkeletalMeshes)
+    {
+        for (const FMaterialInfo& Info : Mesh.RenderData->Materials)
+        {
+            LoadMaterialTextures(Info);
+        }
+
+        USkeletalMesh* NewMesh = FObjectFactory::ConstructObject<USkeletalMesh>(nullptr);
+        NewMesh->SetRenderData(std::move(Mesh.RenderData));
+        NewMesh->SetSkeleton(Result.Skeletons.IsValidIndex(Mesh.SkeletonIndex) ? Result.Skeletons[Mesh.SkeletonIndex] : nullptr);
+        Result.SkeletalMeshes.Add(NewMesh);
+    }
+
+    for (std::unique_ptr<FStaticMeshRenderData>& RenderData : StaticMeshes)
+    {
+        for (const FMaterialInfo& Info : RenderData->Materials)
+        {
+            LoadMaterialTextures(Info);
+        }
+
+        // FFbxLoader와 같이 UStaticMesh가 RenderData를 가짐
+        UStaticMesh* NewMesh = FObjectFactory::ConstructObject<UStaticMesh>(nullptr);
+        NewMesh->SetData(RenderData.release());
+        Result.StaticMeshes.Add(NewMesh);
+    }
+
+    Result.Animations = std::move(Animations);
+
+    if (bRefreshSourceWriteTime)
+    {
+        std::fstream File(GetCachePath(FbxFilePath), std::ios::binary | std::ios::in | std::ios::out);
+        if (File.is_open())
+        {
+            File.seekp(SourceWriteTimeOffset);
+            File.write(reinterpret_cast<const char*>(&CurrentSourceWriteTime), sizeof(CurrentSourceWriteTime));
+        }
+    }
+
+    OutResult = std::move(Result);
+    return true;
+}
+
+bool FFbxCookedCache::Save(const FString& FbxFilePath, const FFbxLoadResult& Result)
+{
+    const FWString SourcePath = FbxFilePath.ToWideString();
+    uint64 SourceSize = 0;
+    int64 SourceWriteTime = 0;
+    TArray<uint8> SourceData;
+    if (!GetSourceStamp(SourcePath, SourceSize, SourceWriteTime) || !ReadFile(SourcePath, SourceData))
+    {
+        return false;
+    }
+
+    TArray<uint8> CacheData;
+    FMemoryWriter Ar(CacheData);
+
+    uint32 Magic = CacheMagic;
+    uint32 OutCacheVersion = CacheVersion;
+    uint32 OutImporterVersion = ImporterVersion;
+    uint64 SourceHash = FHash::Fnv1a64(SourceData.GetData(), SourceData.Num());
+    Ar << Magic << OutCacheVersion << OutImporterVersion << SourceSize << SourceWriteTime << SourceHash;
+
+    int32 NumMaterials = Result.Materials.Num();
+    Ar << NumMaterials;
+    for (UMaterial* Material : Result.Materials)
+    {
+        FString Name = Material->GetName();
+        Ar << Name << Material->GetMaterialInfo();
+    }
+
+    int32 NumSkeletons = Result.Skeletons.Num();
+    Ar << NumSkeletons;
+    for (USkeleton* Skeleton : Result.Skeletons)
+    {
+        FReferenceSkeleton RefSkeleton = Skeleton->GetReferenceSkeleton();
+        SerializeReferenceSkeleton(Ar, RefSkeleton);
+    }
+
+    int32 NumSkeletalMeshes = Result.SkeletalMeshes.Num();
+    Ar << NumSkeletalMeshes;
+    for (USkeletalMesh* Mesh : Result.SkeletalMeshes)
+    {
+        int32 SkeletonIndex = INDEX_NONE;
+        for (int32 Index = 0; Index < Result.Skeletons.Num(); ++Index)
+        {
+            if (Result.Skeletons[Index] == Mesh->GetSkeleton())
+            {
+                SkeletonIndex = Index;
+                break;
+            }
+        }
+        Ar << SkeletonIndex;
+
+        // 저장할 때는 RenderData를 읽기만 함
+        SerializeRenderData(Ar, *const_cast<FSkeletalMeshRenderData*>(Mesh->GetRenderData()));
+    }
+
+    int32 NumStaticMeshes = Result.StaticMeshes.Num();
+    Ar << NumStaticMeshes;
+    for (UStaticMesh* Mesh : Result.StaticMeshes)
+    {
+        SerializeRenderData(Ar, *Mesh->GetRenderData());
+    }
+
+    int32 NumAnimations = Result.Animations.Num();
+    Ar << NumAnimations;
+    for (UAnimSequence* Animation : Result.Animations)
+    {
+        FString Name = Animation->GetName();
+        Ar << Name;
+        Animation->Serialize(Ar);
+    }
+
+    std::ofstream File(GetCachePath(FbxFilePath), std::ios::binary);
+    if (!File.is_open())
+    {
+        return false;
+    }
+    File.write(reinterpret_cast<const char*>(CacheData.GetData()), CacheData.Num());
+    return static_cast<bool>(File);
+}
+
+FWString FFbxCookedCache::GetCachePath(const FString& FbxFilePath)
+{
+    return FbxFilePath.ToWideString() + L".bin";
+}
+
+bool FFbxCookedCache::ReadFile(const FWString& FilePath, TArray<uint8>& OutData)
+{
+    std::ifstream File(FilePath, std::ios::binary | std::ios::ate);
+    if (!File.is_open())
+    {
+        return false;
+    }
+
+    const std::streamsize Size = File.tellg();
+    if (Size < 0)
+    {
+        return false;
+    }
+
+    OutData.SetNum(static_cast<int32>(Size));
+    File.seekg(0, std::ios::beg);
+    File.read(reinterpret_cast<char*>(OutData.GetData()), Size);
+    return static_cast<bool>(File);
+}
+
+bool FFbxCookedCache::GetSourceStamp(const FWString& FilePath, uint64& OutSize, int64& OutWriteTime)
+{
+    std::error_code Error;
+    const uint64 Size = std::filesystem::file_size(FilePath, Error);
+    if (Error)
+    {
+        return false;
+    }
+
+    const std::filesystem::file_time_type WriteTime = std::filesystem::last_write_time(FilePath, Error);
+    if (Error)
+    {
+        return false;
+    }
+
+    OutSize = Size;
+    OutWriteTime = static_cast<int64>(WriteTime.time_since_epoch().count());
+    return true;
+}
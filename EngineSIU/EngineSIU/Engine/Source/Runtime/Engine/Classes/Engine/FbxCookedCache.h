@@ -0,0 +1,45 @@
+#pragma once
+#include "Container/Array.h"
+#include "Container/String.h"
+#include "HAL/PlatformType.h"
+
+struct FFbxLoadResult;
+
+
+/**
+ * FFbxLoader의 Import 결과(Vertex/Index, Skeleton, Inverse Bind Pose, Material, Animation)를
+ * FBX 옆의 .bin 파일로 구워두고, 다음 실행부터 FBX SDK 없이 한 번에 읽습니다.
+ *
+ * Cache는 원본 FBX의 크기와 내용 Hash, Importer 버전이 모두 같을 때만 사용합니다.
+ * 크기와 수정 시각이 Cache에 기록된 값과 같으면 FBX를 읽지 않고, 수정 시각만 다를 때 Hash를 비교합니다.
+ */
+class FFbxCookedCache
+{
+public:
+    /**
+     * Cache가 유효하면 읽어서 OutResult를 채웁니다.
+     * @return Cache가 없거나 오래됐거나 깨졌으면 false, 이때 OutResult는 건드리지 않음
+     */
+    static bool Load(const FString& FbxFilePath, FFbxLoadResult& OutResult);
+
+    static bool Save(const FString& FbxFilePath, const FFbxLoadResult& Result);
+
+    static FWString GetCachePath(const FString& FbxFilePath);
+
+    static constexpr uint32 CacheMagic = 0x43584246; // "FBXC"
+
+    // Cache 파일 형식이 바뀌면 올림
+    static constexpr uint32 CacheVersion = 2;
+
+    // FFbxLoader의 Import 결과가 바뀌면 올려서 기존 Cache를 무효화
+    static constexpr uint32 ImporterVersion = 1;
+
+private:
+    static bool ReadFile(const FWString& FilePath, TArray<uint8>& OutData);
+
+    /** 원본 FBX의 크기와 마지막 수정 시각을 읽음 */
+    static bool GetSourceStamp(const FWString& FilePath, uint64& OutSize, int64& OutWriteTime);
+
+    // Cache Header에서 SourceWriteTime의 위치 (Magic, CacheVersion, ImporterVersion, SourceSize 뒤)
+    static constexpr int64 SourceWriteTimeOffset = sizeof(uint32) * 3 + sizeof(uint64);
+};
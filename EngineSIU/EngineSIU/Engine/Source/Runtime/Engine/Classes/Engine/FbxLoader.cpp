@@ -7,6 +7,7 @@
 #include "Asset/SkeletalMeshAsset.h"
 #include "UObject/ObjectFactory.h"
 #include "Math/transform.h"
+#include "Animation/AnimSequence.h"
 #include "Animation/Skeleton.h"
 #include "SkeletalMesh.h"
 #include "Asset/StaticMeshAsset.h"
@@ -312,6 +313,8 @@ FFbxLoadResult FFbxLoader::LoadFBX(const FString& InFilePath)
 
     ProcessSkeletonHierarchy(RootNode, Result);
 
+    ProcessAnimations(Result);
+
     ProcessMeshes(RootNode, Result);
     
     return Result;
@@ -729,6 +732,119 @@ void FFbxLoader::CollectBoneData(FbxNode* Node, FReferenceSkeleton& OutReference
     }
 }
 
+void FFbxLoader::ProcessAnimations(FFbxLoadResult& OutResult)
+{
+    if (OutResult.Skeletons.IsEmpty() || AnimationSampleRate <= 0)
+    {
+        return;
+    }
+
+    const int32 AnimStackCount = Scene->GetSrcObjectCount<FbxAnimStack>();
+    for (int32 StackIndex = 0; StackIndex < AnimStackCount; ++StackIndex)
+    {
+        FbxAnimStack* AnimStack = Scene->GetSrcObject<FbxAnimStack>(StackIndex);
+        if (!AnimStack)
+        {
+            continue;
+        }
+
+        // EvaluateLocalTransform은 현재 Anim Stack의 Curve를 사용
+        Scene->SetCurrentAnimationStack(AnimStack);
+
+        // Take 정보가 있으면 Take의 구간을 우선 사용
+        FbxTimeSpan TimeSpan = AnimStack->GetLocalTimeSpan();
+        if (const FbxTakeInfo* TakeInfo = Scene->GetTakeInfo(AnimStack->GetName()))
+        {
+            TimeSpan = TakeInfo->mLocalTimeSpan;
+        }
+        if (TimeSpan.GetDuration().GetSecondDouble() <= 0.0)
+        {
+            continue;
+        }
+
+        for (int32 SkeletonIndex = 0; SkeletonIndex < OutResult.Skeletons.Num(); ++SkeletonIndex)
+        {
+            FString SequenceName = AnimStack->GetName();
+            if (SkeletonIndex > 0)
+            {
+                SequenceName += FString::FromInt(SkeletonIndex);
+            }
+
+            if (UAnimSequence* Sequence = CreateAnimSequence(TimeSpan, OutResult.Skeletons[SkeletonIndex], FName(SequenceName)))
+            {
+                OutResult.Animations.Add(Sequence);
+            }
+        }
+    }
+}
+
+UAnimSequence* FFbxLoader::CreateAnimSequence(const FbxTimeSpan& TimeSpan, USkeleton* Skeleton, const FName& SequenceName)
+{
+    const FReferenceSkeleton& RefSkeleton = Skeleton->GetReferenceSkeleton();
+    const int32 BoneNum = RefSkeleton.RawRefBoneInfo.Num();
+
+    const double StartSeconds = TimeSpan.GetStart().GetSecondDouble();
+    const double Duration = TimeSpan.GetDuration().GetSecondDouble();
+    const int32 NumFrames = FMath::Clamp(static_cast<int32>(Duration * AnimationSampleRate + 0.5) + 1, 1, 0xFFFF);
+
+    TArray<FRawAnimSequenceTrack> RawTracks;
+    TArray<int32> TrackBoneIndices;
+    for (int32 BoneIndex = 0; BoneIndex < BoneNum; ++BoneIndex)
+    {
+        const FMeshBoneInfo& BoneInfo = RefSkeleton.RawRefBoneInfo[BoneIndex];
+        FbxNode* BoneNode = Scene->FindNodeByName(*BoneInfo.Name.ToString());
+        if (!BoneNode)
+        {
+            continue;
+        }
+
+        // 엔진의 Pose는 Bind Pose 기준 (Bind * AnimPose = Local)
+        const FTransform InverseBindPose = RefSkeleton.RawRefBonePose[BoneIndex].Inverse();
+
+        FRawAnimSequenceTrack& RawTrack = RawTracks[RawTracks.Add(FRawAnimSequenceTrack())];
+        TrackBoneIndices.Add(BoneIndex);
+        RawTrack.PosKeys.SetNum(NumFrames);
+        RawTrack.RotKeys.SetNum(NumFrames);
+        RawTrack.ScaleKeys.SetNum(NumFrames);
+
+        for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+        {
+            FbxTime Time;
+            Time.SetSecondDouble(FMath::Min(StartSeconds + static_cast<double>(Frame) / AnimationSampleRate, StartSeconds + Duration));
+
+            // Root Bone의 Reference Pose는 Global Transform이므로 같은 기준으로 샘플링
+            const FbxAMatrix LocalMatrix = BoneInfo.ParentIndex == INDEX_NONE
+                ? BoneNode->EvaluateGlobalTransform(Time)
+                : BoneNode->EvaluateLocalTransform(Time);
+            const FTransform Delta = InverseBindPose * FTransform(ConvertFbxMatrixToFMatrix(LocalMatrix));
+
+            RawTrack.PosKeys[Frame] = Delta.Translation;
+            RawTrack.ScaleKeys[Frame] = Delta.Scale3D;
+
+            // 행렬에서 뽑은 쿼터니언은 부호가 튈 수 있으므로, 보간이 최단 경로가 되도록 이전 Key와 같은 반구로 맞춤
+            FQuat Rotation = Delta.Rotation;
+            if (Frame > 0)
+            {
+                const FQuat& Previous = RawTrack.RotKeys[Frame - 1];
+                if (Rotation.X * Previous.X + Rotation.Y * Previous.Y + Rotation.Z * Previous.Z + Rotation.W * Previous.W < 0.f)
+                {
+                    Rotation = FQuat(-Rotation.X, -Rotation.Y, -Rotation.Z, -Rotation.W);
+                }
+            }
+            RawTrack.RotKeys[Frame] = Rotation;
+        }
+    }
+
+    if (RawTracks.IsEmpty())
+    {
+        return nullptr;
+    }
+
+    UAnimSequence* Sequence = FObjectFactory::ConstructObject<UAnimSequence>(nullptr, SequenceName);
+    Sequence->SetAnimationData(RawTracks, TrackBoneIndices, NumFrames, AnimationSampleRate);
+    return Sequence;
+}
+
 FTransform FFbxLoader::ConvertFbxTransformToFTransform(FbxNode* Node) const
 {
     FbxAMatrix LocalMatrix = Node->EvaluateLocalTransform();
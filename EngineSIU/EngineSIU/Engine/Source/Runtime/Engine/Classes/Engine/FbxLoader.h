@@ -13,6 +13,7 @@ struct FReferenceSkeleton;
 struct FTransform;
 struct FMeshBoneInfo;
 class USkeleton;
+class UAnimSequence;
 class FString;
 class USkeletalMesh;
 struct FSkeletalMeshRenderData;
@@ -27,6 +28,9 @@ public:
 
     FFbxLoadResult LoadFBX(const FString& InFilePath);
 
+    // Animation Curve를 샘플링하는 Frame Rate
+    int32 AnimationSampleRate = 30;
+
 private:
     FbxManager* Manager;
     FbxImporter* Importer;
@@ -61,6 +65,12 @@ private:
 
     FTransform ConvertFbxTransformToFTransform(FbxNode* Node) const;
     // End Skeleton
+
+    // Begin Animation
+    void ProcessAnimations(FFbxLoadResult& OutResult);
+
+    UAnimSequence* CreateAnimSequence(const FbxTimeSpan& TimeSpan, USkeleton* Skeleton, const FName& SequenceName);
+    // End Animation
     
     // Begin Mesh
     void ProcessMeshes(FbxNode* Node, FFbxLoadResult& OutResult);
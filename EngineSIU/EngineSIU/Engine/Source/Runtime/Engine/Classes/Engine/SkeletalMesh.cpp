@@ -1,6 +1,7 @@
 
 #include "Asset/SkeletalMeshAsset.h"
 #include "SkeletalMesh.h"
+#include "Animation/CPUSkinning.h"
 
 
 USkeletalMesh::~USkeletalMesh()
@@ -11,6 +12,9 @@ USkeletalMesh::~USkeletalMesh()
 void USkeletalMesh::SetRenderData(std::unique_ptr<FSkeletalMeshRenderData> InRenderData)
 {
     RenderData = std::move(InRenderData);
+
+    std::lock_guard Lock(SkinningSourceMutex);
+    SkinningSource.reset();
 }
 
 const FSkeletalMeshRenderData* USkeletalMesh::GetRenderData() const
@@ -18,4 +22,18 @@ const FSkeletalMeshRenderData* USkeletalMesh::GetRenderData() const
     return RenderData.get(); 
 }
 
+const FSkinningSourceStreams& USkeletalMesh::GetSkinningSourceStreams() const
+{
+    std::lock_guard Lock(SkinningSourceMutex);
+    if (!SkinningSource)
+    {
+        SkinningSource = std::make_unique<FSkinningSourceStreams>();
+        if (RenderData)
+        {
+            FCPUSkinning::BuildSourceStreams(*RenderData, *SkinningSource);
+        }
+    }
+    return *SkinningSource;
+}
+
 
@@ -1,7 +1,10 @@
 #pragma once
+#include <mutex>
+
 #include "SkinnedAsset.h"
 #include "Asset/SkeletalMeshAsset.h" 
 class USkeleton;
+struct FSkinningSourceStreams;
 //struct FSkeletalMeshRenderData;
 
 class USkeletalMesh : public USkinnedAsset
@@ -20,9 +23,16 @@ public:
 
     void SetSkeleton(USkeleton* InSkeleton) { Skeleton = InSkeleton; }
 
+    // CPU Skinning 입력, 처음 요청한 Thread에서 RenderData로부터 만듦
+    const FSkinningSourceStreams& GetSkinningSourceStreams() const;
+
   
 protected:
     std::unique_ptr<FSkeletalMeshRenderData> RenderData;
 
     USkeleton* Skeleton;
+
+private:
+    mutable std::mutex SkinningSourceMutex;
+    mutable std::unique_ptr<FSkinningSourceStreams> SkinningSource;
 };
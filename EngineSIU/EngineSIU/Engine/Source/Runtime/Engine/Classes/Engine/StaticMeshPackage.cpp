@@ -0,0 +1,229 @@
+#include "StaticMeshPackage.h"
+
+#include <fstream>
+
+#include "Asset/StaticMeshAsset.h"
+#include "Misc/Hash.h"
+#include "Serialization/MemoryArchive.h"
+
+
+namespace
+{
+    FORCEINLINE uint64 AlignSection(uint64 Offset)
+    {
+        return (Offset + FStaticMeshPackage::SectionAlignment - 1) & ~(FStaticMeshPackage::SectionAlignment - 1);
+    }
+
+    void SerializeMetadata(FArchive& Ar, FStaticMeshRenderData& StaticMesh)
+    {
+        Ar << StaticMesh.ObjectName << StaticMesh.DisplayName;
+        Ar << StaticMesh.Materials << StaticMesh.MaterialSubsets;
+        Ar << StaticMesh.BoundingBoxMin << StaticMesh.BoundingBoxMax;
+    }
+
+    uint32 GetElementSize(EStaticMeshPackageSection Type)
+    {
+        switch (Type)
+        {
+        case EStaticMeshPackageSection::Vertices:
+            return sizeof(FStaticMeshVertex);
+        case EStaticMeshPackageSection::Indices:
+            return sizeof(UINT);
+        default:
+            return 1;
+        }
+    }
+}
+
+
+bool FStaticMeshPackage::Save(const FWString& FilePath, const FStaticMeshRenderData& StaticMesh)
+{
+    // 저장할 때는 RenderData를 읽기만 함
+    TArray<uint8> Metadata;
+    FMemoryWriter MetadataWriter(Metadata);
+    SerializeMetadata(MetadataWriter, const_cast<FStaticMeshRenderData&>(StaticMesh));
+
+    struct FSectionSource
+    {
+        EStaticMeshPackageSection Type;
+        const void* Data;
+        uint64 Size;
+    };
+
+    const FSectionSource Sources[] = {
+        { EStaticMeshPackageSection::Vertices, StaticMesh.GetVertexData(), StaticMesh.GetNumVertices() * sizeof(FStaticMeshVertex) },
+        { EStaticMeshPackageSection::Indices, StaticMesh.GetIndexData(), StaticMesh.GetNumIndices() * sizeof(UINT) },
+        { EStaticMeshPackageSection::Metadata, Metadata.GetData(), static_cast<uint64>(Metadata.Num()) },
+    };
+    constexpr uint32 NumSections = static_cast<uint32>(std::size(Sources));
+
+    // Header, Section Table 뒤에 Section을 정렬해서 배치
+    FStaticMeshPackageSection SectionTable[NumSections];
+    uint64 Offset = AlignSection(sizeof(FStaticMeshPackageHeader) + sizeof(SectionTable));
+    for (uint32 Index = 0; Index < NumSections; ++Index)
+    {
+        SectionTable[Index].Type = Sources[Index].Type;
+        SectionTable[Index].ElementSize = GetElementSize(Sources[Index].Type);
+        SectionTable[Index].Offset = Offset;
+        SectionTable[Index].Size = Sources[Index].Size;
+        Offset = AlignSection(Offset + Sources[Index].Size);
+    }
+
+    TArray<uint8> FileData;
+    FileData.Init(0, static_cast<int32>(Offset));
+
+    FPlatformMemory::Memcpy(FileData.GetData() + sizeof(FStaticMeshPackageHeader), SectionTable, sizeof(SectionTable));
+    for (uint32 Index = 0; Index < NumSections; ++Index)
+    {
+        if (Sources[Index].Size > 0)
+        {
+            FPlatformMemory::Memcpy(FileData.GetData() + SectionTable[Index].Offset, Sources[Index].Data, Sources[Index].Size);
+        }
+    }
+
+    FStaticMeshPackageHeader PackageHeader = {};
+    PackageHeader.Magic = PackageMagic;
+    PackageHeader.Version = PackageVersion;
+    PackageHeader.NumSections = NumSections;
+    PackageHeader.FileSize = Offset;
+    PackageHeader.Checksum = FHash::Fnv1a64(FileData.GetData() + sizeof(FStaticMeshPackageHeader), Offset - sizeof(FStaticMeshPackageHeader));
+    FPlatformMemory::Memcpy(FileData.GetData(), &PackageHeader, sizeof(PackageHeader));
+
+    std::ofstream File(FilePath, std::ios::binary);
+    if (!File.is_open())
+    {
+        return false;
+    }
+    File.write(reinterpret_cast<const char*>(FileData.GetData()), FileData.Num());
+    return static_cast<bool>(File);
+}
+
+bool FStaticMeshPackage::Open(const FWString& FilePath, bool bVerifyChecksum)
+{
+    Close();
+
+    if (!MappedFile.Open(FilePath))
+    {
+        return false;
+    }
+
+    const uint8* Data = MappedFile.GetData();
+    const uint64 FileSize = MappedFile.GetSize();
+    const auto* InHeader = reinterpret_cast<const FStaticMeshPackageHeader*>(Data);
+    const auto* InSections = reinterpret_cast<const FStaticMeshPackageSection*>(Data + sizeof(FStaticMeshPackageHeader));
+
+    bool bValid = FileSize >= sizeof(FStaticMeshPackageHeader)
+        && InHeader->Magic == PackageMagic
+        && InHeader->Version == PackageVersion
+        && InHeader->FileSize == FileSize
+        && InHeader->NumSections <= MaxSections
+        && sizeof(FStaticMeshPackageHeader) + InHeader->NumSections * sizeof(FStaticMeshPackageSection) <= FileSize;
+
+    if (bValid && bVerifyChecksum)
+    {
+        bValid = FHash::Fnv1a64(Data + sizeof(FStaticMeshPackageHeader), FileSize - sizeof(FStaticMeshPackageHeader)) == InHeader->Checksum;
+    }
+
+    for (uint32 Index = 0; bValid && Index < InHeader->NumSections; ++Index)
+    {
+        const FStaticMeshPackageSection& Section = InSections[Index];
+        bValid = Section.Offset % SectionAlignment == 0
+            && Section.Offset <= FileSize
+            && Section.Size <= FileSize - Section.Offset
+            && Section.ElementSize == GetElementSize(Section.Type)
+            && Section.Size % Section.ElementSize == 0;
+    }
+
+    if (!bValid)
+    {
+        MappedFile.Close();
+        return false;
+    }
+
+    Header = InHeader;
+    Sections = InSections;
+    return true;
+}
+
+void FStaticMeshPackage::Close()
+{
+    Header = nullptr;
+    Sections = nullptr;
+    MappedFile.Close();
+}
+
+const FStaticMeshVertex* FStaticMeshPackage::GetVertices() const
+{
+    const FStaticMeshPackageSection* Section = FindSection(EStaticMeshPackageSection::Vertices);
+    return Section ? reinterpret_cast<const FStaticMeshVertex*>(MappedFile.GetData() + Section->Offset) : nullptr;
+}
+
+int32 FStaticMeshPackage::GetNumVertices() const
+{
+    const FStaticMeshPackageSection* Section = FindSection(EStaticMeshPackageSection::Vertices);
+    return Section ? static_cast<int32>(Section->Size / sizeof(FStaticMeshVertex)) : 0;
+}
+
+const UINT* FStaticMeshPackage::GetIndices() const
+{
+    const FStaticMeshPackageSection* Section = FindSection(EStaticMeshPackageSection::Indices);
+    return Section ? reinterpret_cast<const UINT*>(MappedFile.GetData() + Section->Offset) : nullptr;
+}
+
+int32 FStaticMeshPackage::GetNumIndices() const
+{
+    const FStaticMeshPackageSection* Section = FindSection(EStaticMeshPackageSection::Indices);
+    return Section ? static_cast<int32>(Section->Size / sizeof(UINT)) : 0;
+}
+
+bool FStaticMeshPackage::Load(const FWString& FilePath, FStaticMeshRenderData& OutStaticMesh, bool bVerifyChecksum)
+{
+    auto Package = std::make_shared<FStaticMeshPackage>();
+    if (!Package->Open(FilePath, bVerifyChecksum) || !Package->ReadMetadata(OutStaticMesh))
+    {
+        return false;
+    }
+
+    OutStaticMesh.Package = std::move(Package);
+    return true;
+}
+
+bool FStaticMeshPackage::ReadMetadata(FStaticMeshRenderData& OutStaticMesh) const
+{
+    const FStaticMeshPackageSection* MetadataSection = FindSection(EStaticMeshPackageSection::Metadata);
+    if (!MetadataSection)
+    {
+        return false;
+    }
+
+    FStaticMeshRenderData StaticMesh;
+    try
+    {
+        FMemoryReaderView MetadataReader(MappedFile.GetData() + MetadataSection->Offset, static_cast<int64>(MetadataSection->Size));
+        SerializeMetadata(MetadataReader, StaticMesh);
+    }
+    catch (const std::exception&)
+    {
+        return false;
+    }
+
+    OutStaticMesh = std::move(StaticMesh);
+    return true;
+}
+
+const FStaticMeshPackageSection* FStaticMeshPackage::FindSection(EStaticMeshPackageSection Type) const
+{
+    if (!Header)
+    {
+        return nullptr;
+    }
+
+    for (uint32 Index = 0; Index < Header->NumSections; ++Index)
+    {
+        if (Sections[Index].Type == Type)
+        {
+            return &Sections[Index];
+        }
+    }
+    return nullptr;
+}
@@ -0,0 +1,92 @@
+#pragma once
+#include "Container/String.h"
+#include "HAL/PlatformType.h"
+#include "WindowsMappedFile.h"
+
+struct FStaticMeshVertex;
+struct FStaticMeshRenderData;
+
+
+enum class EStaticMeshPackageSection : uint32
+{
+    Vertices,
+    Indices,
+
+    // 이름, Material, Subset, Bounds (FArchive로 직렬화)
+    Metadata,
+};
+
+/** 파일 맨 앞, 바로 뒤에 Section Table이 이어짐 */
+struct FStaticMeshPackageHeader
+{
+    uint32 Magic;
+    uint32 Version;
+    uint32 NumSections;
+    uint32 Reserved;
+    uint64 FileSize;
+
+    // Header 뒤부터 파일 끝까지의 FNV-1a
+    uint64 Checksum;
+};
+
+struct FStaticMeshPackageSection
+{
+    EStaticMeshPackageSection Type;
+
+    // 원소 하나의 크기, 읽는 쪽의 구조체 크기와 다르면 파일을 쓰지 않음
+    uint32 ElementSize;
+
+    // 파일 처음부터의 위치, SectionAlignment의 배수
+    uint64 Offset;
+    uint64 Size;
+};
+
+static_assert(sizeof(FStaticMeshPackageHeader) == 32);
+static_assert(sizeof(FStaticMeshPackageSection) == 24);
+
+/**
+ * Static Mesh 바이너리 (.smesh)
+ *
+ * Vertex/Index Section은 정렬된 위치에 그대로 저장되므로, 파일을 Memory-map한 뒤
+ * 복사나 Parsing 없이 GetVertices/GetIndices로 바로 가리킬 수 있습니다.
+ */
+class FStaticMeshPackage
+{
+public:
+    static bool Save(const FWString& FilePath, const FStaticMeshRenderData& StaticMesh);
+
+    /** 파일을 Memory-map하고 Header와 Section Table, Checksum을 검사합니다. */
+    bool Open(const FWString& FilePath, bool bVerifyChecksum = true);
+    void Close();
+
+    bool IsOpen() const { return Header != nullptr; }
+
+    // Mapping을 그대로 가리킴, Close 전까지 유효
+    const FStaticMeshVertex* GetVertices() const;
+    int32 GetNumVertices() const;
+
+    const UINT* GetIndices() const;
+    int32 GetNumIndices() const;
+
+    /**
+     * 파일을 열고 Metadata만 읽습니다.
+     * Vertex/Index는 복사하지 않고, OutStaticMesh.Package가 Mapping을 들고 있으면서 가리킵니다.
+     */
+    static bool Load(const FWString& FilePath, FStaticMeshRenderData& OutStaticMesh, bool bVerifyChecksum);
+
+    static constexpr uint32 PackageMagic = 0x48534D53; // "SMSH"
+    static constexpr uint32 PackageVersion = 1;
+
+    static constexpr uint64 SectionAlignment = 16;
+    static constexpr uint32 MaxSections = 16;
+
+private:
+    bool ReadMetadata(FStaticMeshRenderData& OutStaticMesh) const;
+
+    const FStaticMeshPackageSection* FindSection(EStaticMeshPackageSection Type) const;
+
+    FMappedFile MappedFile;
+
+    const FStaticMeshPackageHeader* Header = nullptr;
+    const FStaticMeshPackageSection* Sections = nullptr;
+};
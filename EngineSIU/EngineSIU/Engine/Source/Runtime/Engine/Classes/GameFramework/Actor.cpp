@@ -17,6 +17,7 @@ UObject* AActor::Duplicate(UObject* InOuter)
 
     NewActor->Owner = Owner;
     NewActor->bTickInEditor = bTickInEditor;
+    NewActor->TickGroup = TickGroup;
     // 기본적으로 있던 컴포넌트 제거
     TSet CopiedComponents = NewActor->OwnedComponents;
 
@@ -112,9 +113,21 @@ void AActor::Tick(float DeltaTime)
     // TODO: 나중에 삭제를 Pending으로 하던가 해서 복사비용 줄이기
     const auto CopyComponents = OwnedComponents;
 
+    // AnyThread Component는 World의 FTickTaskManager가 Worker Thread에서 Tick, 없으면 여기서 같이 Tick
+    const UWorld* World = GetWorld();
+    const bool bTickAnyThreadComponents = !World || !World->GetTickTaskManager();
+
     for (UActorComponent* Comp : CopyComponents)
     {
-        Comp->TickComponent(DeltaTime);
+        if (!Comp->CanTickOnAnyThread())
+        {
+            Comp->TickComponent(DeltaTime);
+        }
+        else if (bTickAnyThreadComponents)
+        {
+            Comp->PrepareTickOnAnyThread();
+            Comp->TickComponent(DeltaTime);
+        }
     }
 }
 
@@ -136,7 +149,9 @@ void AActor::Destroyed()
 void AActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
     // 본인이 소유하고 있는 모든 컴포넌트의 EndPlay 호출
-    for (UActorComponent* Component : GetComponents())
+    // EndPlay에서 Component를 제거하면 TSet의 요소가 옮겨지므로 복사본을 순회
+    const TSet<UActorComponent*> Components = OwnedComponents;
+    for (UActorComponent* Component : Components)
     {
         if (Component->HasBegunPlay())
         {
@@ -139,12 +139,17 @@ public:
     bool IsActorTickInEditor() const { return bTickInEditor; }
     void SetActorTickInEditor(bool InbInTickInEditor);
 
+    ETickingGroup GetTickGroup() const { return TickGroup; }
+    void SetTickGroup(ETickingGroup InTickGroup) { TickGroup = InTickGroup; }
+
     bool IsHidden() const { return bHidden; }
     void SetHidden(bool InbHidden) { bHidden = InbHidden; }
 
 private:
     bool bTickInEditor = false;     // Editor Tick을 수행 여부
 
+    ETickingGroup TickGroup = TG_PrePhysics;
+
     bool bHidden = false;
     
 public:
@@ -26,6 +26,11 @@ struct FMeshBoneInfo
     }
 };
 
+inline FArchive& operator<<(FArchive& Ar, FMeshBoneInfo& BoneInfo)
+{
+    return Ar << BoneInfo.Name << BoneInfo.ParentIndex;
+}
+
 struct FReferenceSkeleton
 {
 public:
@@ -1,17 +1,62 @@
 #include "Console.h"
 #include <cstdarg>
 #include <cstdio>
+#include <cstring>
 
 #include "Actors/PointLightActor.h"
 #include "Actors/SpotLightActor.h"
+#include "Animation/AnimationLOD.h"
+#include "Async/JobSystem.h"
 #include "Components/Light/LightComponent.h"
 #include "Engine/Engine.h"
+#include "Misc/Benchmark.h"
 #include "Renderer/UpdateLightBufferPass.h"
 #include "Stats/GPUTimingManager.h"
 #include "Stats/ProfilerStatsManager.h"
 #include "UnrealEd/EditorViewportClient.h"
 #include "UObject/UObjectIterator.h"
 
+namespace
+{
+    void LogNamePoolStats(FConsole& Console, const FNamePoolStats& Stats)
+    {
+        Console.AddLog(ELogLevel::Display, "Names: %u", Stats.NumNames);
+        Console.AddLog(ELogLevel::Display, "Entry Memory: %llu Byte (%.1f Byte/Name)",
+            Stats.EntryBytes, Stats.NumNames ? static_cast<double>(Stats.EntryBytes) / Stats.NumNames : 0.0);
+        Console.AddLog(ELogLevel::Display, "Block Memory: %llu Byte", Stats.BlockBytes);
+        Console.AddLog(ELogLevel::Display, "Hash Table Memory: %llu Byte", Stats.HashTableBytes);
+        Console.AddLog(ELogLevel::Display, "Index Table Memory: %llu Byte", Stats.IndexBytes);
+        Console.AddLog(ELogLevel::Display, "Total: %.2f MB", Stats.GetTotalBytes() / (1024.0 * 1024.0));
+    }
+
+    const char* GetLogLevelName(ELogLevel Level)
+    {
+        switch (Level)
+        {
+        case ELogLevel::Display:
+            return "Display";
+        case ELogLevel::Warning:
+            return "Warning";
+        case ELogLevel::Error:
+            return "Error";
+        }
+        return "";
+    }
+
+    bool ParseLogLevel(const char* Name, ELogLevel& OutLevel)
+    {
+        for (const ELogLevel Level : {ELogLevel::Display, ELogLevel::Warning, ELogLevel::Error})
+        {
+            if (_stricmp(Name, GetLogLevelName(Level)) == 0)
+            {
+                OutLevel = Level;
+                return true;
+            }
+        }
+        return false;
+    }
+}
+
 
 void FStatOverlay::ToggleStat(const std::string& Command)
 {
@@ -30,6 +75,16 @@ void FStatOverlay::ToggleStat(const std::string& Command)
         bShowLight = true;
         bShowRender = true;
     }
+    else if (Command == "stat jobs")
+    {
+        bShowJobs = true;
+        bShowRender = true;
+    }
+    else if (Command == "stat anim")
+    {
+        bShowAnim = true;
+        bShowRender = true;
+    }
     else if (Command == "stat all")
     {
         StatFlags = 0xFF;
@@ -82,6 +137,10 @@ void FStatOverlay::Render(ID3D11DeviceContext* Context, UINT Width, UINT Height)
         ImGui::Text("Allocated Object Memory: %llu Byte", FPlatformMemory::GetAllocationBytes<EAT_Object>());
         ImGui::Text("Allocated Container Count: %llu", FPlatformMemory::GetAllocationCount<EAT_Container>());
         ImGui::Text("Allocated Container Memory: %llu Byte", FPlatformMemory::GetAllocationBytes<EAT_Container>());
+
+        const FNamePoolStats NameStats = FName::GetNamePoolStats();
+        ImGui::Text("Name Count: %u", NameStats.NumNames);
+        ImGui::Text("Name Pool Memory: %llu Byte", NameStats.GetTotalBytes());
     }
 
     if (bShowLight)
@@ -91,6 +150,31 @@ void FStatOverlay::Render(ID3D11DeviceContext* Context, UINT Width, UINT Height)
         ImGui::Text("Spot Light: %d", GetNumOfObjectsByClass(ASpotLight::StaticClass()));
     }
 
+    if (bShowJobs)
+    {
+        ImGui::SeparatorText("Job System");
+        const TArray<FJobThreadStats>& ThreadStats = FJobSystem::Get().GetThreadStats();
+        for (int32 Index = 0; Index < ThreadStats.Num(); ++Index)
+        {
+            const FJobThreadStats& Stats = ThreadStats[Index];
+            ImGui::Text(
+                "%s %d: %5.1f%% (%.2f ms) Jobs: %u Stolen: %u",
+                Index == 0 ? "Main  " : "Worker", Index, Stats.Utilization * 100.f, Stats.BusyMs, Stats.NumJobs, Stats.NumStolenJobs
+            );
+        }
+    }
+
+    if (bShowAnim)
+    {
+        ImGui::SeparatorText("Animation");
+        const FAnimLODStats& Stats = FAnimationLOD::GetLastFrameStats();
+        ImGui::Text("Update Rate Optimization: %s", FAnimationLOD::Settings.bEnabled ? "On" : "Off");
+        ImGui::Text("Ticked Components: %u", Stats.NumTickedComponents);
+        ImGui::Text("Evaluated Components: %u", Stats.NumEvaluatedComponents);
+        ImGui::Text("Interpolated Components: %u", Stats.NumInterpolatedComponents);
+        ImGui::Text("Evaluated Bones: %u (Skipped by Bone LOD: %u)", Stats.NumEvaluatedBones, Stats.NumSkippedBones);
+    }
+
     ImGui::PopStyleColor();
     ImGui::End();
 }
@@ -156,16 +240,107 @@ void FEngineProfiler::Render(ID3D11DeviceContext* Context, UINT Width, UINT Heig
         ImGui::EndTable();
     }
 
+    if (ImGui::CollapsingHeader("CPU Scopes"))
+    {
+        if (FProfilerStatsManager::IsTracing())
+        {
+            ImGui::TextColored(ImVec4(1.0f, 0.4f, 0.4f, 1.0f), "Tracing...");
+        }
 
+        constexpr ImGuiTableFlags TableFlags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_Resizable;
+        if (ImGui::BeginTable("ScopeTreeTable", 6, TableFlags))
+        {
+            ImGui::TableSetupColumn("Scope", ImGuiTableColumnFlags_WidthStretch);
+            ImGui::TableSetupColumn("ms", ImGuiTableColumnFlags_WidthFixed, 55.0f);
+            ImGui::TableSetupColumn("Avg", ImGuiTableColumnFlags_WidthFixed, 55.0f);
+            ImGui::TableSetupColumn("Min", ImGuiTableColumnFlags_WidthFixed, 55.0f);
+            ImGui::TableSetupColumn("Max", ImGuiTableColumnFlags_WidthFixed, 55.0f);
+            ImGui::TableSetupColumn("Calls", ImGuiTableColumnFlags_WidthFixed, 40.0f);
+            ImGui::TableHeadersRow();
+
+            for (const FProfilerThreadTree& Tree : FProfilerStatsManager::GetThreadTrees())
+            {
+                // Scope를 한 번도 기록하지 않은 Thread는 생략
+                if (Tree.Nodes.Num() <= 1)
+                {
+                    continue;
+                }
+
+                ImGui::TableNextRow();
+                ImGui::TableSetColumnIndex(0);
+                ImGui::PushID(static_cast<int>(Tree.ThreadId));
+                const bool bOpen = ImGui::TreeNodeEx(*Tree.ThreadName, ImGuiTreeNodeFlags_SpanFullWidth | ImGuiTreeNodeFlags_DefaultOpen);
+                if (bOpen)
+                {
+                    for (const int32 ChildIndex : Tree.Nodes[0].Children)
+                    {
+                        RenderScopeNode(Tree, ChildIndex);
+                    }
+                    ImGui::TreePop();
+                }
+                ImGui::PopID();
+            }
+
+            ImGui::EndTable();
+        }
+    }
 
     ImGui::End();
 }
 
+void FEngineProfiler::RenderScopeNode(const FProfilerThreadTree& Tree, int32 NodeIndex)
+{
+    const FProfilerScopeNode& Node = Tree.Nodes[NodeIndex];
+
+    ImGui::TableNextRow();
+    ImGui::TableSetColumnIndex(0);
+
+    ImGuiTreeNodeFlags NodeFlags = ImGuiTreeNodeFlags_SpanFullWidth | ImGuiTreeNodeFlags_DefaultOpen;
+    if (Node.Children.Num() == 0)
+    {
+        NodeFlags |= ImGuiTreeNodeFlags_Leaf | ImGuiTreeNodeFlags_NoTreePushOnOpen;
+    }
+
+    ImGui::PushID(NodeIndex);
+    TCHAR NameBuffer[NAME_SIZE];
+    const bool bOpen = ImGui::TreeNodeEx(Node.StatName.ToCString(NameBuffer), NodeFlags);
+    ImGui::PopID();
+
+    ImGui::TableSetColumnIndex(1);
+    ImGui::Text("%.3f", Node.LastMs);
+    ImGui::TableSetColumnIndex(2);
+    ImGui::Text("%.3f", Node.AvgMs);
+    ImGui::TableSetColumnIndex(3);
+    ImGui::Text("%.3f", Node.MinMs);
+    ImGui::TableSetColumnIndex(4);
+    ImGui::Text("%.3f", Node.MaxMs);
+    ImGui::TableSetColumnIndex(5);
+    ImGui::Text("%u", Node.LastCalls);
+
+    if (bOpen && Node.Children.Num() > 0)
+    {
+        for (const int32 ChildIndex : Node.Children)
+        {
+            RenderScopeNode(Tree, ChildIndex);
+        }
+        ImGui::TreePop();
+    }
+}
+
 void FEngineProfiler::RegisterStatScope(const FString& DisplayName, const FName& CPUStatName, const FName& GPUStatName)
 {
     TrackedScopes.Add({ DisplayName, CPUStatName, GPUStatName });
 }
 
+FConsole::FConsole()
+{
+    // Sink Thread가 포맷한 로그를 받아 두었다가 Draw에서 표시
+    FLog::AddSink([this](const FLogMessage& Message)
+    {
+        AddPendingItem(Message.Level, Message.Text, Message.Len);
+    });
+}
+
 // 싱글톤 인스턴스 반환
 FConsole& FConsole::GetInstance() {
     static FConsole Instance;
@@ -175,37 +350,87 @@ FConsole& FConsole::GetInstance() {
 // 로그 초기화
 void FConsole::Clear() {
     Items.Empty();
+    FirstItem = 0;
 }
 
-// 로그 추가
+// 로그 추가, 콘솔 명령의 응답이므로 Log Ring을 거치지 않고 바로 콘솔에 표시
 void FConsole::AddLog(ELogLevel Level, const ANSICHAR* Fmt, ...)
 {
     va_list Args;
     va_start(Args, Fmt);
-    // AddLog(Level, Fmt, Args);
 
     char Buf[1024];
-    vsnprintf_s(Buf, sizeof(Buf), _TRUNCATE, Fmt, Args);
-
-    Items.Emplace(Level, std::string(Buf));
+    const int32 Len = vsnprintf(Buf, sizeof(Buf), Fmt, Args);
     va_end(Args);
+
+    AddItem(Level, FString(Buf, Len < 0 ? static_cast<int32>(strlen(Buf)) : FMath::Min(Len, static_cast<int32>(sizeof(Buf)) - 1)));
 }
 
 void FConsole::AddLog(ELogLevel Level, const WIDECHAR* Fmt, ...)
 {
     va_list Args;
     va_start(Args, Fmt);
-    // AddLog(Level, Fmt, Args);
 
     wchar_t Buf[1024];
-    _vsnwprintf_s(Buf, sizeof(Buf), _TRUNCATE, Fmt, Args);
-
-    Items.Emplace(Level, FString(Buf).ToAnsiString());
+    const int32 Len = _vsnwprintf_s(Buf, _countof(Buf), _TRUNCATE, Fmt, Args);
     va_end(Args);
+
+    AddItem(Level, FString(FWideStringView(Buf, Len < 0 ? static_cast<int32>(wcslen(Buf)) : Len)));
+}
+
+void FConsole::AddItem(ELogLevel Level, FString&& Message)
+{
+    // 먼저 남긴 UE_LOG가 응답보다 위에 오도록 Sink Thread에서 받은 로그부터 옮김
+    FlushPendingItems();
+    AppendItem({ Level, std::move(Message) });
+}
+
+void FConsole::AppendItem(LogEntry&& Entry)
+{
+    if (Items.Num() < MaxItems)
+    {
+        Items.Add(std::move(Entry));
+    }
+    else
+    {
+        Items[FirstItem] = std::move(Entry);
+        FirstItem = (FirstItem + 1) % MaxItems;
+    }
+}
+
+void FConsole::AddPendingItem(ELogLevel Level, const char* Message, int32 Len)
+{
+    FString Entry(Message, Len);
+
+    std::lock_guard Lock(PendingMutex);
+    if (PendingItems.Num() >= MaxItems)
+    {
+        // Draw가 한동안 불리지 않으면 어차피 밀려날 로그이므로 버림
+        return;
+    }
+    PendingItems.Emplace(Level, std::move(Entry));
+}
+
+void FConsole::FlushPendingItems()
+{
+    TArray<LogEntry> NewItems;
+    {
+        std::lock_guard Lock(PendingMutex);
+        NewItems = std::move(PendingItems);
+        PendingItems.Empty();
+    }
+
+    for (LogEntry& Entry : NewItems)
+    {
+        AppendItem(std::move(Entry));
+    }
 }
 
 // 콘솔 창 렌더링
 void FConsole::Draw() {
+    // 창이 닫혀 있어도 Pending이 쌓이지 않도록 먼저 옮김
+    FlushPendingItems();
+
     if (!bWasOpen)
     {
         return;
@@ -267,8 +492,9 @@ void FConsole::Draw() {
 
     // 로그 출력 (필터 적용)
     ImGui::BeginChild("ScrollingRegion", ImVec2(0, -ImGui::GetTextLineHeightWithSpacing()), false, ImGuiWindowFlags_HorizontalScrollbar);
-    for (const auto& [Level, Message] : Items)
+    for (int32 Offset = 0; Offset < Items.Num(); ++Offset)
     {
+        const auto& [Level, Message] = Items[(FirstItem + Offset) % Items.Num()];
         if (!Filter.PassFilter(*Message))
         {
             continue;
@@ -339,6 +565,11 @@ void FConsole::ExecuteCommand(const std::string& Command)
 {
     AddLog(ELogLevel::Display, "Executing command: %s", Command.c_str());
 
+    if (FBenchmarkRegistry::Execute(*this, Command))
+    {
+        return;
+    }
+
     if (Command == "clear")
     {
         Clear();
@@ -350,12 +581,76 @@ void FConsole::ExecuteCommand(const std::string& Command)
         AddLog(ELogLevel::Display, " - help: Shows available commands");
         AddLog(ELogLevel::Display, " - stat fps: Toggle FPS display");
         AddLog(ELogLevel::Display, " - stat memory: Toggle Memory display");
+        AddLog(ELogLevel::Display, " - stat jobs: Toggle Job System worker utilization display");
+        AddLog(ELogLevel::Display, " - stat anim: Toggle evaluated animation components and bones display");
+        AddLog(ELogLevel::Display, " - anim lod on|off: Toggle animation update rate optimization and bone LOD");
         AddLog(ELogLevel::Display, " - stat none: Hide all stat overlays");
+        AddLog(ELogLevel::Display, " - trace start: Start recording CPU scopes for chrome://tracing");
+        AddLog(ELogLevel::Display, " - trace stop [path]: Save the recorded trace (default: Saved/Profiling/Trace.json)");
+        AddLog(ELogLevel::Display, " - name stats: Print FName pool memory usage");
+        AddLog(ELogLevel::Display, " - log list: Show log categories and their levels");
+        AddLog(ELogLevel::Display, " - log <category> display|warning|error: Set the minimum level of a log category");
+        for (const FBenchmarkCommand& Benchmark : FBenchmarkRegistry::GetCommands())
+        {
+            AddLog(ELogLevel::Display, " - %s %s (default: %d)", Benchmark.Name, Benchmark.Usage, Benchmark.DefaultCount);
+        }
     }
     else if (Command.starts_with("stat "))
     {
         Overlay.ToggleStat(Command);
     }
+    else if (Command == "anim lod on" || Command == "anim lod off")
+    {
+        FAnimationLOD::Settings.bEnabled = Command == "anim lod on";
+        AddLog(ELogLevel::Display, "Animation LOD %s", FAnimationLOD::Settings.bEnabled ? "enabled" : "disabled");
+    }
+    else if (Command == "trace start")
+    {
+        FProfilerStatsManager::StartTrace();
+        AddLog(ELogLevel::Display, "Trace started");
+    }
+    else if (Command.starts_with("trace stop"))
+    {
+        std::string FilePath = Command.size() > 11 ? Command.substr(11) : "Saved/Profiling/Trace.json";
+        if (FProfilerStatsManager::StopTrace(FilePath))
+        {
+            AddLog(ELogLevel::Display, "Trace saved: %s", FilePath.c_str());
+        }
+        else
+        {
+            AddLog(ELogLevel::Error, "Failed to save trace: %s", FilePath.c_str());
+        }
+    }
+    else if (Command == "name stats")
+    {
+        LogNamePoolStats(*this, FName::GetNamePoolStats());
+    }
+    else if (Command == "log list")
+    {
+        for (const FLogCategory* Category = FLogCategory::GetFirst(); Category; Category = Category->GetNext())
+        {
+            AddLog(ELogLevel::Display, "%-16s %s", Category->GetName(), GetLogLevelName(Category->GetMinLevel()));
+        }
+        AddLog(ELogLevel::Display, "Dropped: %llu", FLog::GetNumDropped());
+    }
+    else if (Command.starts_with("log "))
+    {
+        char CategoryName[64] = {};
+        char LevelName[16] = {};
+        ELogLevel Level;
+        FLogCategory* Category = nullptr;
+        if (sscanf_s(Command.c_str(), "log %63s %15s", CategoryName, static_cast<unsigned>(sizeof(CategoryName)), LevelName, static_cast<unsigned>(sizeof(LevelName))) == 2
+            && (Category = FLogCategory::Find(CategoryName)) != nullptr
+            && ParseLogLevel(LevelName, Level))
+        {
+            Category->SetMinLevel(Level);
+            AddLog(ELogLevel::Display, "%s: %s", Category->GetName(), GetLogLevelName(Level));
+        }
+        else
+        {
+            AddLog(ELogLevel::Error, "Usage: log <category> display|warning|error (see 'log list')");
+        }
+    }
     else
     {
         AddLog(ELogLevel::Error, "Unknown command: %s", Command.c_str());
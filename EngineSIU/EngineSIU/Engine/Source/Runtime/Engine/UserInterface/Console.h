@@ -1,36 +1,14 @@
 #pragma once
+#include <mutex>
+
 #include "Container/Array.h"
 #include "D3D11RHI/GraphicDevice.h"
 #include "HAL/PlatformType.h"
+#include "Logging/Log.h"
 #include "UObject/NameTypes.h"
 #include "ImGui/imgui.h"
 #include "PropertyEditor/IWindowToggleable.h"
 
-static consteval const char* GetFileName(const char* Path)
-{
-    const char* Name = Path;
-    while (*Path)
-    {
-        if (*Path == '/' || *Path == '\\')
-        {
-            Name = Path + 1;
-        }
-        Path++;
-    }
-    return Name;
-}
-
-#define FILENAME GetFileName(__FILE__)
-#define UE_LOG(Level, Fmt, ...) FConsole::GetInstance().AddLog(Level, "[%s:%d] " Fmt, FILENAME, __LINE__, __VA_ARGS__)
-
-
-enum class ELogLevel : uint8
-{
-    Display,
-    Warning,
-    Error
-};
-
 class FStatOverlay
 {
 public:
@@ -44,6 +22,8 @@ public:
             uint8 bShowMemory : 1;
             uint8 bShowLight : 1;
             uint8 bShowRender : 1;
+            uint8 bShowJobs : 1;
+            uint8 bShowAnim : 1;
         };
         uint8 StatFlags = 0; // 기본적으로 다 끄기
     };
@@ -60,6 +40,7 @@ struct FProfiledScope
 };
 
 class FGPUTimingManager;
+struct FProfilerThreadTree;
 
 class FEngineProfiler
 {
@@ -72,6 +53,9 @@ public:
     void RegisterStatScope(const FString& DisplayName, const FName& CPUStatName, const FName& GPUStatName);
 
 private:
+    // Thread별 Scope Tree의 한 Node와 그 자식들을 Table의 Row로 출력
+    static void RenderScopeNode(const FProfilerThreadTree& Tree, int32 NodeIndex);
+
     FGPUTimingManager* GPUTimingManager = nullptr;
     TArray<FProfiledScope> TrackedScopes;
     bool bShowWindow = true;
@@ -80,7 +64,7 @@ private:
 class FConsole : public IWindowToggleable
 {
 private:
-    FConsole() = default;
+    FConsole();
     virtual ~FConsole() override = default;
 
 public:
@@ -94,6 +78,11 @@ public:
     static FConsole& GetInstance(); // 참조 반환으로 변경
 
     void Clear();
+
+    /**
+     * 콘솔 명령의 응답을 바로 콘솔에 추가합니다. Log Ring과 로그 파일을 거치지 않습니다.
+     * Main Thread에서만 호출하며, 다른 Thread나 파일에 남길 로그는 UE_LOG를 사용합니다.
+     */
     void AddLog(ELogLevel Level, const ANSICHAR* Fmt, ...);
     void AddLog(ELogLevel Level, const WIDECHAR* Fmt, ...);
     void Draw();
@@ -119,7 +108,12 @@ public:
         FString Message;
     };
 
+    /** 콘솔에 보관하는 최대 로그 수, 넘치면 오래된 것부터 덮어씀 */
+    static constexpr int32 MaxItems = 2048;
+
+    // MaxItems 크기의 Ring, 가장 오래된 로그는 Items[FirstItem]
     TArray<LogEntry> Items;
+    int32 FirstItem = 0;
     TArray<FString> History;
     int32 HistoryPos = -1;
     char InputBuf[256] = "";
@@ -136,6 +130,22 @@ public:
     FStatOverlay Overlay;
 
 private:
+    /** Log Sink Thread에서 받은 로그를 Main Thread의 Draw에서 Items로 옮김 */
+    void AddPendingItem(ELogLevel Level, const char* Message, int32 Len);
+    void FlushPendingItems();
+
+    /** Main Thread에서 Items에 바로 추가 */
+    void AddItem(ELogLevel Level, FString&& Message);
+
+    /** Items Ring의 끝에 추가, 가득 차면 가장 오래된 로그를 덮어씀 */
+    void AppendItem(LogEntry&& Entry);
+
+    std::mutex PendingMutex;
+
+    // Items와 같은 MaxItems 크기의 Ring, 가장 오래된 로그는 PendingItems[FirstPendingItem]
+    TArray<LogEntry> PendingItems;
+    int32 FirstPendingItem = 0;
+
     bool bExpand = true;
     UINT Width;
     UINT Height;
@@ -0,0 +1,76 @@
+#include "TickTaskManager.h"
+
+#include "World.h"
+#include "Async/JobSystem.h"
+#include "Components/ActorComponent.h"
+#include "GameFramework/Actor.h"
+
+
+void FTickTaskManager::StartFrame(const UWorld* World, bool bOnlyTickInEditor)
+{
+    const ULevel* Level = World->GetActiveLevel();
+    if (!Level)
+    {
+        return;
+    }
+
+    // Tick 도중 Spawn된 Actor는 다음 틱부터 Tick
+    for (AActor* Actor : Level->Actors)
+    {
+        if (!Actor || (bOnlyTickInEditor && !Actor->IsActorTickInEditor()))
+        {
+            continue;
+        }
+
+        TickActors[Actor->GetTickGroup()].Add(Actor);
+
+        for (UActorComponent* Component : Actor->GetComponents())
+        {
+            if (Component && Component->CanTickOnAnyThread())
+            {
+                AnyThreadComponents[Component->GetTickGroup()].Add(Component);
+            }
+        }
+    }
+}
+
+void FTickTaskManager::RunTickGroup(ETickingGroup Group, float DeltaTime)
+{
+    const TArray<UActorComponent*>& Components = AnyThreadComponents[Group];
+
+    // 같은 그룹의 Actor Tick 전이므로, 여기서 읽은 값은 Worker Thread의 Tick이 끝날 때까지 바뀌지 않음
+    for (UActorComponent* Component : Components)
+    {
+        if (!Component->GetOwner()->IsActorBeingDestroyed())
+        {
+            Component->PrepareTickOnAnyThread();
+        }
+    }
+
+    ParallelFor(Components.Num(), [&Components, DeltaTime](int32 Index)
+    {
+        UActorComponent* Component = Components[Index];
+        if (!Component->GetOwner()->IsActorBeingDestroyed())
+        {
+            Component->TickComponent(DeltaTime);
+        }
+    });
+
+    for (AActor* Actor : TickActors[Group])
+    {
+        // 앞선 Tick에서 제거된 Actor는 제외
+        if (!Actor->IsActorBeingDestroyed())
+        {
+            Actor->Tick(DeltaTime);
+        }
+    }
+}
+
+void FTickTaskManager::EndFrame()
+{
+    for (int32 Group = 0; Group < TG_MAX; ++Group)
+    {
+        TickActors[Group].Empty();
+        AnyThreadComponents[Group].Empty();
+    }
+}
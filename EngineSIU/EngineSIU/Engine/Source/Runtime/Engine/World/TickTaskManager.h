@@ -0,0 +1,33 @@
+#pragma once
+#include "Container/Array.h"
+#include "Engine/EngineTypes.h"
+
+class UWorld;
+class AActor;
+class UActorComponent;
+
+
+/**
+ * World에 있는 Actor와 Component의 Tick을 ETickingGroup 순서대로 실행합니다.
+ *
+ * 각 그룹에서는 먼저 CanTickOnAnyThread인 Component들의 PrepareTickOnAnyThread를 Main Thread에서 호출한 뒤 Job System으로 동시에 Tick하고,
+ * 그 다음 Actor의 Tick을 Main Thread에서 순서대로 실행합니다.
+ * 나머지 Component는 지금처럼 AActor::Tick에서 같이 Tick됩니다.
+ */
+class FTickTaskManager
+{
+public:
+    /**
+     * 이번 틱에 Tick할 Actor와 AnyThread Component를 그룹별로 모읍니다.
+     * @param bOnlyTickInEditor true면 IsActorTickInEditor인 Actor만 Tick
+     */
+    void StartFrame(const UWorld* World, bool bOnlyTickInEditor);
+
+    void RunTickGroup(ETickingGroup Group, float DeltaTime);
+
+    void EndFrame();
+
+private:
+    TArray<AActor*> TickActors[TG_MAX];
+    TArray<UActorComponent*> AnyThreadComponents[TG_MAX];
+};
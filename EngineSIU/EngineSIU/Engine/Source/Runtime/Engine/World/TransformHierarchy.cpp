@@ -0,0 +1,198 @@
+#include "TransformHierarchy.h"
+
+#include "World.h"
+#include "Async/JobSystem.h"
+#include "Components/SceneComponent.h"
+#include "UObject/UObjectIterator.h"
+
+
+FTransformHierarchy::~FTransformHierarchy()
+{
+    Reset();
+}
+
+void FTransformHierarchy::Update(const UWorld* World)
+{
+    if (bStructureDirty)
+    {
+        Rebuild(World);
+    }
+
+    // 이 수보다 적으면 Job을 나누는 비용이 더 큼
+    constexpr int32 MinParallelComponents = 1024;
+    if (Components.Num() < MinParallelComponents || RootIndices.Num() < 2)
+    {
+        UpdateRange(0, Components.Num());
+        return;
+    }
+
+    // 다른 World에 있는 부모는 여러 하위 트리가 공유할 수 있으므로 먼저 갱신
+    for (const int32 RootIndex : RootIndices)
+    {
+        const USceneComponent* Root = Components[RootIndex];
+        if (DirtyFlags[RootIndex] && Root && Root->AttachParent)
+        {
+            Root->AttachParent->ConditionalUpdateComponentToWorld();
+        }
+    }
+
+    // 하위 트리끼리는 서로의 값을 읽지 않으므로 동시에 계산
+    ParallelFor(RootIndices.Num(), [this](int32 Index)
+    {
+        const int32 Begin = RootIndices[Index];
+        const int32 End = Index + 1 < RootIndices.Num() ? RootIndices[Index + 1] : Components.Num();
+        UpdateRange(Begin, End);
+    }, 16);
+}
+
+void FTransformHierarchy::UpdateRange(int32 Begin, int32 End)
+{
+    // 부모가 항상 앞에 있으므로, 앞에서부터 계산하면 부모는 이미 최신 상태입니다.
+    for (int32 Index = Begin; Index < End; ++Index)
+    {
+        if (!DirtyFlags[Index])
+        {
+            continue;
+        }
+        DirtyFlags[Index] = 0;
+
+        const USceneComponent* Component = Components[Index];
+        if (!Component || !Component->bComponentToWorldDirty)
+        {
+            continue;
+        }
+
+        const int32 ParentIndex = ParentIndices[Index];
+        if (ParentIndex == INDEX_NONE)
+        {
+            // 부모가 없거나 다른 World에 있는 경우
+            UpdateEntry(Index);
+            continue;
+        }
+
+        Component->CalculateComponentToWorld(
+            &WorldScaleMatrices[ParentIndex], &WorldRTMatrices[ParentIndex],
+            WorldScaleMatrices[Index], WorldRTMatrices[Index], WorldMatrices[Index], WorldRotations[Index], ComponentToWorlds[Index]
+        );
+        Component->bComponentToWorldDirty = false;
+    }
+}
+
+void FTransformHierarchy::UpdateEntry(int32 Index)
+{
+    const USceneComponent* Component = Components[Index];
+    const USceneComponent* Parent = Component->AttachParent;
+
+    const FMatrix* ParentScaleMatrix = nullptr;
+    const FMatrix* ParentRTMatrix = nullptr;
+    if (Parent)
+    {
+        Parent->ConditionalUpdateComponentToWorld();
+        ParentScaleMatrix = &Parent->GetCachedWorldScaleMatrix();
+        ParentRTMatrix = &Parent->GetCachedWorldRTMatrix();
+    }
+
+    Component->CalculateComponentToWorld(
+        ParentScaleMatrix, ParentRTMatrix,
+        WorldScaleMatrices[Index], WorldRTMatrices[Index], WorldMatrices[Index], WorldRotations[Index], ComponentToWorlds[Index]
+    );
+    Component->bComponentToWorldDirty = false;
+}
+
+void FTransformHierarchy::Unregister(int32 Index)
+{
+    Components[Index] = nullptr;
+    bStructureDirty = true;
+}
+
+void FTransformHierarchy::Rebuild(const UWorld* World)
+{
+    Reset();
+
+    // 루트부터 깊이 우선으로 추가하면 부모가 항상 자식보다 앞에 옵니다.
+    TArray<USceneComponent*> Stack;
+    TArray<int32> StackParentIndices;
+    for (USceneComponent* Root : TObjectRange<USceneComponent>())
+    {
+        if (Root->GetWorld() != World)
+        {
+            continue;
+        }
+
+        const USceneComponent* RootParent = Root->AttachParent;
+        if (RootParent && RootParent->GetWorld() == World)
+        {
+            continue;
+        }
+
+        RootIndices.Add(Components.Num());
+        Stack.Add(Root);
+        StackParentIndices.Add(INDEX_NONE);
+        while (Stack.Num() > 0)
+        {
+            USceneComponent* Component = Stack.Pop();
+            const int32 ParentIndex = StackParentIndices.Pop();
+
+            const int32 Index = Components.Num();
+            Add(Component, ParentIndex);
+
+            for (USceneComponent* Child : Component->AttachChildren)
+            {
+                // AttachChildren에만 남아있고 실제로는 다른 부모를 가진 Component는 제외
+                if (Child && Child->AttachParent == Component && !Child->TransformHierarchy)
+                {
+                    Stack.Add(Child);
+                    StackParentIndices.Add(Index);
+                }
+            }
+        }
+    }
+
+    bStructureDirty = false;
+}
+
+void FTransformHierarchy::Reset()
+{
+    for (int32 Index = 0; Index < Components.Num(); ++Index)
+    {
+        USceneComponent* Component = Components[Index];
+        if (!Component)
+        {
+            continue;
+        }
+
+        // 등록이 해제된 뒤에도 Dirty하지 않은 캐시를 그대로 사용할 수 있도록 돌려줌
+        Component->WorldScaleMatrix = WorldScaleMatrices[Index];
+        Component->WorldRTMatrix = WorldRTMatrices[Index];
+        Component->WorldMatrix = WorldMatrices[Index];
+        Component->WorldRotation = WorldRotations[Index];
+        Component->ComponentToWorld = ComponentToWorlds[Index];
+        Component->TransformHierarchy = nullptr;
+        Component->HierarchyIndex = INDEX_NONE;
+    }
+
+    Components.Empty();
+    ParentIndices.Empty();
+    RootIndices.Empty();
+    DirtyFlags.Empty();
+    WorldScaleMatrices.Empty();
+    WorldRTMatrices.Empty();
+    WorldMatrices.Empty();
+    WorldRotations.Empty();
+    ComponentToWorlds.Empty();
+}
+
+void FTransformHierarchy::Add(USceneComponent* Component, int32 ParentIndex)
+{
+    const int32 Index = Components.Add(Component);
+    ParentIndices.Add(ParentIndex);
+    DirtyFlags.Add(Component->bComponentToWorldDirty ? 1 : 0);
+    WorldScaleMatrices.Add(Component->WorldScaleMatrix);
+    WorldRTMatrices.Add(Component->WorldRTMatrix);
+    WorldMatrices.Add(Component->WorldMatrix);
+    WorldRotations.Add(Component->WorldRotation);
+    ComponentToWorlds.Add(Component->ComponentToWorld);
+
+    Component->TransformHierarchy = this;
+    Component->HierarchyIndex = Index;
+}
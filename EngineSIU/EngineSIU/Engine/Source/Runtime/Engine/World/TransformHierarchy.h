@@ -0,0 +1,90 @@
+#pragma once
+#include "CoreMiscDefines.h"
+#include "Container/Array.h"
+#include "Math/Matrix.h"
+#include "Math/Rotator.h"
+#include "Math/Transform.h"
+
+class UWorld;
+class USceneComponent;
+
+
+/**
+ * World에 있는 모든 USceneComponent의 World Transform을 연속된 배열(SoA)에 저장하는 계층 구조
+ *
+ * Component는 루트부터 깊이 우선 순서로 저장되므로 부모는 항상 자식보다 앞에 있습니다.
+ * Update는 배열을 앞에서부터 한 번만 훑으면서 Dirty한 Component만 부모의 결과를 이용해 다시 계산합니다.
+ * 루트마다 하위 트리가 연속된 구간에 있으므로, Component가 많으면 하위 트리 단위로 나눠 동시에 계산합니다.
+ * 등록된 USceneComponent는 HierarchyIndex로 이 배열의 값을 읽습니다.
+ *
+ * Attach 관계가 바뀌거나 Component가 추가, 제거되면 다음 Update에서 순서를 다시 구성하고,
+ * 그 전까지는 Index 대신 AttachParent를 따라가며 계산합니다.
+ */
+class FTransformHierarchy
+{
+    friend class USceneComponent;
+
+public:
+    FTransformHierarchy() = default;
+    ~FTransformHierarchy();
+
+    FTransformHierarchy(const FTransformHierarchy&) = delete;
+    FTransformHierarchy& operator=(const FTransformHierarchy&) = delete;
+    FTransformHierarchy(FTransformHierarchy&&) = delete;
+    FTransformHierarchy& operator=(FTransformHierarchy&&) = delete;
+
+    /** 다음 Update에서 등록된 Component와 순서를 다시 구성합니다. */
+    void MarkStructureDirty() { bStructureDirty = true; }
+
+    /**
+     * 필요하면 순서를 다시 구성하고, Dirty한 World Transform을 부모부터 순서대로 한 번에 계산합니다.
+     * UWorld::Tick에서 매 틱 호출됩니다.
+     */
+    void Update(const UWorld* World);
+
+    int32 Num() const { return Components.Num(); }
+
+    USceneComponent* GetComponent(int32 Index) const { return Components[Index]; }
+    int32 GetParentIndex(int32 Index) const { return ParentIndices[Index]; }
+
+    /** Update 이후 Dirty하지 않은 Component의 World 행렬 */
+    const FMatrix& GetWorldMatrix(int32 Index) const { return WorldMatrices[Index]; }
+
+private:
+    /** Component의 World Transform이 바뀌었음을 기록합니다. */
+    void MarkDirty(int32 Index) { DirtyFlags[Index] = 1; }
+
+    /** Index의 World Transform을 바로 계산합니다. 구조가 바뀌었을 수 있으므로 부모는 AttachParent로 찾습니다. */
+    void UpdateEntry(int32 Index);
+
+    /** Component가 제거될 때 호출되며, 다음 Update에서 배열을 다시 구성합니다. */
+    void Unregister(int32 Index);
+
+    void Rebuild(const UWorld* World);
+
+    /** [Begin, End) 구간을 앞에서부터 계산합니다. 구간 안의 부모는 항상 자식보다 앞에 있어야 합니다. */
+    void UpdateRange(int32 Begin, int32 End);
+
+    /** 등록된 Component에 배열의 값을 돌려주고 등록을 해제합니다. */
+    void Reset();
+
+    void Add(USceneComponent* Component, int32 ParentIndex);
+
+private:
+    TArray<USceneComponent*> Components;
+    TArray<int32> ParentIndices;
+
+    /** 각 루트의 Index, 다음 루트 전까지가 그 루트의 하위 트리입니다. */
+    TArray<int32> RootIndices;
+
+    /** Component가 Dirty할 수 있는 Index, 실제 여부는 Component의 플래그로 확인합니다. */
+    TArray<uint8> DirtyFlags;
+
+    TArray<FMatrix> WorldScaleMatrices;
+    TArray<FMatrix> WorldRTMatrices;
+    TArray<FMatrix> WorldMatrices;
+    TArray<FRotator> WorldRotations;
+    TArray<FTransform> ComponentToWorlds;
+
+    bool bStructureDirty = true;
+};
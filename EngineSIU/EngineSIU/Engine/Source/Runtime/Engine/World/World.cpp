@@ -1,6 +1,8 @@
 #include "World.h"
 
 #include "CollisionManager.h"
+#include "TickTaskManager.h"
+#include "TransformHierarchy.h"
 #include "Actors/Cube.h"
 #include "Actors/Player.h"
 #include "BaseGizmos/TransformGizmo.h"
@@ -37,6 +39,8 @@ void UWorld::InitializeNewWorld()
     //InitializeLightScene(); // 테스트용 LightScene 비활성화
 
     CollisionManager = new FCollisionManager();
+    TransformHierarchy = new FTransformHierarchy();
+    TickTaskManager = new FTickTaskManager();
 }
 
 void UWorld::InitializeLightScene()
@@ -107,6 +111,8 @@ UObject* UWorld::Duplicate(UObject* InOuter)
     NewWorld->ActiveLevel->InitLevel(NewWorld);
     
     NewWorld->CollisionManager = new FCollisionManager();
+    NewWorld->TransformHierarchy = new FTransformHierarchy();
+    NewWorld->TickTaskManager = new FTickTaskManager();
     
     return NewWorld;
 }
@@ -114,8 +120,8 @@ UObject* UWorld::Duplicate(UObject* InOuter)
 void UWorld::Tick(float DeltaTime)
 {
     TimeSeconds += DeltaTime;
-    
-    // SpawnActor()에 의해 Actor가 생성된 경우, 여기서 BeginPlay 호출
+
+    // SpawnActor()에 의해 Actor가 생성된 경우, 첫 Tick 전에 BeginPlay 호출
     if (WorldType != EWorldType::Editor)
     {
         for (AActor* Actor : PendingBeginPlayActors)
@@ -124,6 +130,34 @@ void UWorld::Tick(float DeltaTime)
         }
         PendingBeginPlayActors.Empty();
     }
+
+    // Editor에서는 Editor Tick이 켜진 Actor만 Tick
+    const bool bOnlyTickInEditor = WorldType == EWorldType::Editor || WorldType == EWorldType::SkeletalViewer;
+    if (TickTaskManager)
+    {
+        TickTaskManager->StartFrame(this, bOnlyTickInEditor);
+        TickTaskManager->RunTickGroup(TG_PrePhysics, DeltaTime);
+    }
+
+    // 지난 틱 이후 움직인 Component들의 World Transform을 부모부터 한 번에 갱신
+    if (TransformHierarchy)
+    {
+        TransformHierarchy->Update(this);
+    }
+
+    // 움직인 Shape들의 Overlap을 한 번에 갱신
+    if (CollisionManager)
+    {
+        CollisionManager->UpdateBroadPhase(this);
+        CollisionManager->UpdateOverlaps(this);
+    }
+
+    if (TickTaskManager)
+    {
+        TickTaskManager->RunTickGroup(TG_PostPhysics, DeltaTime);
+        TickTaskManager->RunTickGroup(TG_PostUpdateWork, DeltaTime);
+        TickTaskManager->EndFrame();
+    }
 }
 
 void UWorld::BeginPlay()
@@ -213,6 +247,18 @@ void UWorld::Release()
         delete CollisionManager;
         CollisionManager = nullptr;
     }
+
+    if (TransformHierarchy)
+    {
+        delete TransformHierarchy;
+        TransformHierarchy = nullptr;
+    }
+
+    if (TickTaskManager)
+    {
+        delete TickTaskManager;
+        TickTaskManager = nullptr;
+    }
     
     GUObjectArray.ProcessPendingDestroyObjects();
 }
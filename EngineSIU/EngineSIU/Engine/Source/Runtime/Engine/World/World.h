@@ -21,6 +21,8 @@ class AActor;
 class UObject;
 class USceneComponent;
 class FCollisionManager;
+class FTransformHierarchy;
+class FTickTaskManager;
 class AGameMode;
 class UTextComponent;
 
@@ -82,6 +84,12 @@ public:
     
     void CheckOverlap(const UPrimitiveComponent* Component, TArray<FOverlapResult>& OutOverlaps) const;
 
+    /** World의 SceneComponent Transform 계층 구조, 사용하지 않는 World에서는 nullptr */
+    FTransformHierarchy* GetTransformHierarchy() const { return TransformHierarchy; }
+
+    /** Actor와 AnyThread Component의 Tick을 실행, 사용하지 않는 World에서는 nullptr */
+    FTickTaskManager* GetTickTaskManager() const { return TickTaskManager; }
+
 public:
     double TimeSeconds;
 
@@ -106,6 +114,10 @@ private:
     UTextComponent* MainTextComponent = nullptr;
 
     FCollisionManager* CollisionManager = nullptr;
+
+    FTransformHierarchy* TransformHierarchy = nullptr;
+
+    FTickTaskManager* TickTaskManager = nullptr;
 };
 
 
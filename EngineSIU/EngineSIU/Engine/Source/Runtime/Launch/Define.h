@@ -31,6 +31,11 @@ struct FMaterialSubset
     FString MaterialName; // Material Name
 };
 
+inline FArchive& operator<<(FArchive& Ar, FMaterialSubset& Subset)
+{
+    return Ar << Subset.IndexStart << Subset.IndexCount << Subset.MaterialIndex << Subset.MaterialName;
+}
+
 struct FStaticMaterial
 {
     class UMaterial* Material;
@@ -101,6 +106,11 @@ struct FTextureInfo
     bool bIsSRGB;
 };
 
+inline FArchive& operator<<(FArchive& Ar, FTextureInfo& TextureInfo)
+{
+    return Ar << TextureInfo.TextureName << TextureInfo.TexturePath << TextureInfo.bIsSRGB;
+}
+
 struct FMaterialInfo
 {
     FString MaterialName;  // newmtl: Material Name.
@@ -127,6 +137,15 @@ struct FMaterialInfo
     TArray<FTextureInfo> TextureInfos;
 };
 
+inline FArchive& operator<<(FArchive& Ar, FMaterialInfo& Info)
+{
+    Ar << Info.MaterialName << Info.TextureFlag << Info.bTransparent;
+    Ar << Info.DiffuseColor << Info.SpecularColor << Info.AmbientColor << Info.EmissiveColor;
+    Ar << Info.Shininess << Info.IOR << Info.Transparency << Info.BumpMultiplier << Info.IlluminanceModel;
+    Ar << Info.Metallic << Info.Roughness;
+    return Ar << Info.TextureInfos;
+}
+
 struct FVertexTexture
 {
     float x, y, z;    // Position
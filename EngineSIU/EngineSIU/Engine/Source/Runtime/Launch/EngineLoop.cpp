@@ -2,6 +2,11 @@
 #include "ImGuiManager.h"
 #include "UnrealClient.h"
 #include "WindowsPlatformTime.h"
+#include "Animation/AnimationLOD.h"
+#include "Async/JobSystem.h"
+#include "Logging/Log.h"
+#include "Misc/Parse.h"
+#include "Stats/ProfilerStatsManager.h"
 #include "D3D11RHI/GraphicDevice.h"
 #include "Engine/EditorEngine.h"
 #include "LevelEditor/SLevelEditor.h"
@@ -44,6 +49,12 @@ int32 FEngineLoop::Init(HINSTANCE hInstance)
 {
     FPlatformTime::InitTiming();
 
+    // 콘솔의 Log Sink를 먼저 등록해서, Sink Thread가 시작되기 전에 쌓인 로그도 콘솔에 보이도록 함
+    FConsole::GetInstance();
+    FLog::Initialize();
+
+    FJobSystem::Get().Initialize();
+
     /* must be initialized before window. */
     WindowInit(hInstance);
 
@@ -101,6 +112,15 @@ int32 FEngineLoop::Init(HINSTANCE hInstance)
 
     UpdateUI();
 
+    // -trace=<Path> [-traceframes=<N>]: 첫 프레임부터 Chrome Trace를 기록하고, N 프레임 뒤에 저장 후 종료
+    TCHAR TracePath[MAX_PATH] = {};
+    if (FParse::Value(GetCommandLineA(), TEXT("-trace="), TracePath, MAX_PATH))
+    {
+        TraceFilePath = TracePath;
+        FParse::Value(GetCommandLineA(), TEXT("-traceframes="), TraceExitFrames);
+        FProfilerStatsManager::StartTrace();
+    }
+
     return 0;
 }
 
@@ -145,7 +165,9 @@ void FEngineLoop::Tick()
 
     while (bIsExit == false)
     {
-        FProfilerStatsManager::BeginFrame();    // Clear previous frame stats
+        FProfilerStatsManager::BeginFrame();    // 이전 프레임의 Scope 이벤트 집계
+        FJobSystem::Get().BeginFrame();         // Worker 사용률 집계
+        FAnimationLOD::BeginFrame();            // 애니메이션 LOD 통계 집계
         if (GPUTimingManager.IsInitialized())
         {
             GPUTimingManager.BeginFrame();      // Start GPU frame timing
@@ -168,6 +190,17 @@ void FEngineLoop::Tick()
 
         const float DeltaTime = static_cast<float>(ElapsedTime / 1000.f);
 
+        // 애니메이션 LOD는 Active Viewport의 카메라를 기준으로 고름
+        const std::shared_ptr<FEditorViewportClient> ActiveViewport = LevelEditor->GetActiveViewportClient();
+        if (ActiveViewport && ActiveViewport->IsPerspective())
+        {
+            FAnimationLOD::SetView(ActiveViewport->GetCameraLocation(), ActiveViewport->GetCameraFOV());
+        }
+        else
+        {
+            FAnimationLOD::ClearView();
+        }
+
         GEngine->Tick(DeltaTime);
         LevelEditor->Tick(DeltaTime);
         Render();
@@ -179,6 +212,9 @@ void FEngineLoop::Tick()
 
         UIMgr->EndFrame();
 
+        // 다른 Thread에서 넘긴 Main Thread 작업 처리
+        FJobSystem::Get().ProcessMainThreadJobs();
+
         // Pending 처리된 오브젝트 제거
         GUObjectArray.ProcessPendingDestroyObjects();
 
@@ -194,6 +230,11 @@ void FEngineLoop::Tick()
             QueryPerformanceCounter(&EndTime);
             ElapsedTime = (static_cast<double>(EndTime.QuadPart - StartTime.QuadPart) * 1000.f / static_cast<double>(Frequency.QuadPart));
         } while (ElapsedTime < TargetFrameTime);
+
+        if (TraceExitFrames > 0 && --TraceExitFrames == 0)
+        {
+            bIsExit = true;
+        }
     }
 }
 
@@ -208,6 +249,11 @@ void FEngineLoop::GetClientSize(uint32& OutWidth, uint32& OutHeight) const
 
 void FEngineLoop::Exit()
 {
+    if (FProfilerStatsManager::IsTracing() && !TraceFilePath.IsEmpty())
+    {
+        FProfilerStatsManager::StopTrace(TraceFilePath);
+    }
+
     LevelEditor->Release();
     UIMgr->Shutdown();
     ResourceManager.Release(&Renderer);
@@ -216,6 +262,9 @@ void FEngineLoop::Exit()
     
     GEngine->Release();
 
+    FJobSystem::Get().Shutdown();
+    FLog::Shutdown();
+
     delete UnrealEditor;
     delete BufferManager;
     delete UIMgr;
@@ -64,6 +64,10 @@ private:
     // @todo Option으로 선택 가능하도록
     int32 TargetFPS = 999;
 
+    // -trace 로 기록 중인 Chrome Trace 파일 경로와, 저장 후 종료까지 남은 프레임 수 (0이면 종료하지 않음)
+    FString TraceFilePath;
+    int32 TraceExitFrames = 0;
+
 public:
     SLevelEditor* GetLevelEditor() const { return LevelEditor; }
     UnrealEd* GetUnrealEditor() const { return UnrealEditor; }
@@ -7,9 +7,11 @@
 #include "Components/CapsuleComponent.h"
 
 #include "Engine/OverlapResult.h"
+#include "GameFramework/Actor.h"
 #include "Math/Quat.h"
 #include "UObject/Casts.h"
 #include "UObject/UObjectIterator.h"
+#include "World/World.h"
 
 /**
  * @brief 점 Point와 선분 SegmentStart-SegmentEnd 사이의 가장 가까운 점을 찾습니다.
@@ -47,77 +49,96 @@ FVector ClosestPointOnLineSegment(const FVector& Point, const FVector& SegmentSt
     return SegmentStart + SegmentDir * static_cast<float>(t);
 }
 
-// 두 선분 (A-B, C-D) 사이의 최단 거리 제곱을 반환하는 함수 (구현 복잡)
+/**
+ * @brief 두 선분 (A-B, C-D) 사이의 최단 거리 제곱을 반환합니다.
+ * 각 선분 위의 가장 가까운 점의 매개변수를 구한 뒤, 범위를 벗어나면 끝점 기준으로 다시 계산합니다.
+ * NarrowPhaseSIMD의 Capsule_Capsule도 같은 방법을 사용하므로, 한쪽을 바꾸면 다른 쪽도 맞춰야 합니다.
+ */
 float SquaredDistBetweenLineSegments(const FVector& A, const FVector& B, const FVector& C, const FVector& D)
 {
-    FVector u = B - A;
-    FVector v = D - C;
-    FVector w = A - C;
-    
-    float a = FVector::DotProduct(u, u);
-    float b = FVector::DotProduct(u, v);
-    float c = FVector::DotProduct(v, v);
-    float d = FVector::DotProduct(u, w);
-    float e = FVector::DotProduct(v, w);
-    float F = a*c - b*b;
-    
-    float sc, tc;
-    
-    // 두 선이 거의 평행한 경우
-    if (F < FLT_EPSILON)
+    const FVector u = B - A;
+    const FVector v = D - C;
+    const FVector w = A - C;
+
+    const float a = FVector::DotProduct(u, u);
+    const float e = FVector::DotProduct(v, v);
+    const float f = FVector::DotProduct(v, w);
+
+    float s = 0.0f;
+    float t = 0.0f;
+
+    if (a <= KINDA_SMALL_NUMBER && e <= KINDA_SMALL_NUMBER)
+    {
+        // 두 선분 모두 점
+    }
+    else if (a <= KINDA_SMALL_NUMBER)
     {
-        sc = 0.0f;
-        tc = (b > c ? d/b : e/c);
+        t = FMath::Clamp(f / e, 0.0f, 1.0f);
     }
     else
     {
-        sc = (b*e - c*d) / F;
-        tc = (a*e - b*d) / F;
+        const float c = FVector::DotProduct(u, w);
+        if (e <= KINDA_SMALL_NUMBER)
+        {
+            s = FMath::Clamp(-c / a, 0.0f, 1.0f);
+        }
+        else
+        {
+            const float b = FVector::DotProduct(u, v);
+            const float Denom = a * e - b * b;
+
+            // 두 선이 거의 평행하면 A에서 시작
+            if (Denom > SMALL_NUMBER)
+            {
+                s = FMath::Clamp((b * f - c * e) / Denom, 0.0f, 1.0f);
+            }
+
+            t = (b * s + f) / e;
+            if (t < 0.0f)
+            {
+                t = 0.0f;
+                s = FMath::Clamp(-c / a, 0.0f, 1.0f);
+            }
+            else if (t > 1.0f)
+            {
+                t = 1.0f;
+                s = FMath::Clamp((b - c) / a, 0.0f, 1.0f);
+            }
+        }
     }
-    
-    // 파라미터 값을 [0,1] 범위로 클램핑
-    sc = FMath::Clamp(sc, 0.0f, 1.0f);
-    tc = FMath::Clamp(tc, 0.0f, 1.0f);
-    
-    // 각 선분에서 가장 가까운 점 계산
-    FVector P = A + u * sc;
-    FVector Q = C + v * tc;
-    
+
     // 두 점 사이의 거리 제곱 반환
+    const FVector P = A + u * s;
+    const FVector Q = C + v * t;
     return (P - Q).SquaredLength();
 }
 
 // 점 P와 OBB 사이의 가장 가까운 점을 찾는 함수
-FVector ClosestPointOnOBB(const FVector& P, const UBoxComponent* Box)
+FVector ClosestPointOnOBB(const FVector& P, const FShapeWorldData& Box)
 {
-    FMatrix WorldToBox = FMatrix::Inverse(Box->GetWorldMatrix()); // 가상 함수: 월드->로컬 변환 행렬
-    FVector P_Local = WorldToBox.TransformPosition(P); // 점을 박스 로컬 공간으로 변환
-
-    // 로컬 공간에서 각 축으로 클램핑
-    FVector BoxExtent = Box->GetBoxExtent();
-    FVector ClosestP_Local;
-    ClosestP_Local.X = std::max(-BoxExtent.X, std::min(P_Local.X, BoxExtent.X));
-    ClosestP_Local.Y = std::max(-BoxExtent.Y, std::min(P_Local.Y, BoxExtent.Y));
-    ClosestP_Local.Z = std::max(-BoxExtent.Z, std::min(P_Local.Z, BoxExtent.Z));
-
-    FMatrix BoxToWorld = Box->GetWorldMatrix(); // 가상 함수: 로컬->월드 변환 행렬
-    
-    return BoxToWorld.TransformPosition(ClosestP_Local); // 월드 좌표로 다시 변환
+    // 박스의 각 축으로 투영한 뒤 클램핑
+    const FVector Relative = P - Box.Center;
+    FVector ClosestP = Box.Center;
+    for (int32 i = 0; i < 3; ++i)
+    {
+        const float Local = FMath::Clamp(FVector::DotProduct(Relative, Box.Axes[i]), -Box.BoxHalfSize[i], Box.BoxHalfSize[i]);
+        ClosestP = ClosestP + Box.Axes[i] * Local;
+    }
+    return ClosestP;
 }
 
 // SAT 검사를 위한 헬퍼 함수: OBB를 특정 축에 투영하여 최소/최대값 반환
-void ProjectOBB(const UBoxComponent* Box, const FVector& Axis, float& OutMin, float& OutMax)
+void ProjectOBB(const FShapeWorldData& Box, const FVector& Axis, float& OutMin, float& OutMax)
 {
-    FVector Axes[3] = { Box->GetForwardVector(), Box->GetRightVector(), Box->GetUpVector() };
-    FVector HalfSize = Box->GetBoxExtent();
+    const FVector& HalfSize = Box.BoxExtent;
 
     // 박스 중심을 축에 투영
-    float CenterProj = FVector::DotProduct(Box->GetComponentLocation(), Axis);
+    float CenterProj = FVector::DotProduct(Box.Center, Axis);
 
     // 박스 각 축 방향의 반경을 현재 축에 투영한 값의 절대값을 모두 더함
-    float RadiusProj = FMath::Abs(FVector::DotProduct(Axes[0] * HalfSize.X, Axis)) +
-                       FMath::Abs(FVector::DotProduct(Axes[1] * HalfSize.Y, Axis)) +
-                       FMath::Abs(FVector::DotProduct(Axes[2] * HalfSize.Z, Axis));
+    float RadiusProj = FMath::Abs(FVector::DotProduct(Box.Axes[0] * HalfSize.X, Axis)) +
+                       FMath::Abs(FVector::DotProduct(Box.Axes[1] * HalfSize.Y, Axis)) +
+                       FMath::Abs(FVector::DotProduct(Box.Axes[2] * HalfSize.Z, Axis));
 
     OutMin = CenterProj - RadiusProj;
     OutMax = CenterProj + RadiusProj;
@@ -130,99 +151,97 @@ bool OverlapOnAxis(float MinA, float MaxA, float MinB, float MaxB)
 }
 
 /**
- * @brief 점 P와 원점에 중심을 둔 AABB 사이의 가장 가까운 점을 찾습니다.
- * @param P 대상 점 (로컬 좌표계)
- * @param Extent AABB의 절반 크기 (Half-dimensions)
- * @return AABB 위의 가장 가까운 점 (로컬 좌표계)
+ * @brief 선분(A-B)과 OBB 사이의 최단 거리 제곱을 계산합니다.
+ *
+ * 박스 로컬 공간에서 선분 위의 점 P(t)와 박스 사이 거리 제곱 f(t)는 볼록한 구간별 이차식이고,
+ * 구간의 경계는 선분이 각 축의 경계면을 지나는 t(최대 6개)입니다.
+ * 경계 t에서 기울기의 부호를 보고 최솟값이 있는 구간을 찾은 뒤, 그 구간의 이차식을 직접 풀어 반복 없이 계산합니다.
+ *
+ * @param A 선분 시작점 (월드 좌표계)
+ * @param B 선분 끝점 (월드 좌표계)
+ * @param Box OBB를 나타내는 박스의 World 공간 정보
+ * @return 선분과 OBB 사이의 최단 거리 제곱. 교차하면 0
  */
-inline FVector ClosestPointOnAABB(const FVector& P, const FVector& Extent)
+float SquaredDistSegmentOBB(const FVector& A, const FVector& B, const FShapeWorldData& Box)
 {
-    return FVector(
-        FMath::Clamp(P.X, -Extent.X, Extent.X),
-        FMath::Clamp(P.Y, -Extent.Y, Extent.Y),
-        FMath::Clamp(P.Z, -Extent.Z, Extent.Z)
-    );
-}
+    const FVector Relative = A - Box.Center;
+    const FVector Direction = B - A;
 
-/**
- * @brief 월드 좌표계의 점 P와 UBoxComponent로 표현된 OBB 사이의 가장 가까운 점을 찾습니다.
- * @param P 대상 점 (월드 좌표계)
- * @param BoxComponent OBB를 나타내는 박스 컴포넌트
- * @return OBB 위의 가장 가까운 점 (월드 좌표계)
- */
-FVector ClosestPointOnOBB_FromComponent(const FVector& P, const UBoxComponent* BoxComponent)
-{
-    if (!BoxComponent)
+    float Origin[3];
+    float Dir[3];
+    float HalfSize[3];
+    for (int32 i = 0; i < 3; ++i)
     {
-        // BoxComponent가 유효하지 않으면 입력 점 P를 그대로 반환하거나, 적절한 오류 처리
-        return P;
+        Origin[i] = FVector::DotProduct(Relative, Box.Axes[i]);
+        Dir[i] = FVector::DotProduct(Direction, Box.Axes[i]);
+        HalfSize[i] = Box.BoxHalfSize[i];
     }
 
-    // 박스의 월드 트랜스폼 가져오기
-    const FMatrix BoxWorldMatrix = BoxComponent->GetWorldMatrix();
-    const FMatrix BoxWorldMatrixInv = FMatrix::Inverse(BoxWorldMatrix);
-
-    // 점 P를 월드 공간에서 박스의 로컬 공간으로 변환
-    const FVector P_Local = BoxWorldMatrixInv.TransformPosition(P);
-
-    // 박스의 스케일을 포함한 Extent 가져오기 (로컬 공간 기준)
-    const FVector BoxExtent = BoxComponent->GetBoxExtent();
-
-    // 로컬 공간에서 가장 가까운 점 찾기 (원점에 중심을 둔 AABB에 대한 연산)
-    const FVector ClosestP_Local = ClosestPointOnAABB(P_Local, BoxExtent);
-
-    // 로컬 공간의 가장 가까운 점을 다시 월드 공간으로 변환하여 반환
-    return BoxWorldMatrix.TransformPosition(ClosestP_Local);
-}
+    auto Excess = [&](int32 Axis, float T)
+    {
+        const float Local = Origin[Axis] + Dir[Axis] * T;
+        return Local - FMath::Clamp(Local, -HalfSize[Axis], HalfSize[Axis]);
+    };
 
-/**
- * @brief 선분(A-B)과 UBoxComponent로 표현된 OBB 사이의 최단 거리 제곱을 계산합니다.
- * 이 함수는 'Alternating Projections'와 유사한 반복적 접근 방식을 사용합니다.
- * 두 볼록 집합 사이의 가장 가까운 점을 찾는 데 사용될 수 있습니다.
- *
- * @param A 선분 시작점 (월드 좌표계)
- * @param B 선분 끝점 (월드 좌표계)
- * @param BoxComponent OBB를 나타내는 박스 컴포넌트
- * @param MaxIterations 최대 반복 횟수
- * @param ToleranceSq 수렴으로 간주할 거리 제곱 허용 오차
- * @return 선분과 OBB 사이의 최단 거리 제곱. 교차하거나 매우 가까우면 0에 가까운 값 반환.
- */
-float SquaredDistSegmentOBB(const FVector& A, const FVector& B, const UBoxComponent* BoxComponent, int32 MaxIterations = 10, double ToleranceSq = 1e-6)
-{
-    // 선분 위의 초기 추정점 (예: 선분 중점 또는 시작점 A)
-    FVector PointOnSegment = A; // 또는 (A + B) * 0.5;
-    FVector PointOnBox;
+    // f'(t) / 2
+    auto Slope = [&](float T)
+    {
+        return Dir[0] * Excess(0, T) + Dir[1] * Excess(1, T) + Dir[2] * Excess(2, T);
+    };
 
-    double LastDistSq = DBL_MAX;
-    
-    for (int32 i = 0; i < MaxIterations; ++i)
+    auto DistSq = [&](float T)
+    {
+        const float X = Excess(0, T);
+        const float Y = Excess(1, T);
+        const float Z = Excess(2, T);
+        return X * X + Y * Y + Z * Z;
+    };
+
+    // 양 끝점과 선분이 각 Slab의 경계면을 지나는 t
+    float Candidates[8] = { 0.0f, 1.0f };
+    for (int32 i = 0; i < 3; ++i)
     {
-        // 1. 현재 선분 위의 점에서 OBB 위의 가장 가까운 점 찾기
-        PointOnBox = ClosestPointOnOBB_FromComponent(PointOnSegment, BoxComponent);
+        const bool bValid = FMath::Abs(Dir[i]) > SMALL_NUMBER;
+        Candidates[2 + i * 2] = bValid ? FMath::Clamp((HalfSize[i] - Origin[i]) / Dir[i], 0.0f, 1.0f) : 0.0f;
+        Candidates[3 + i * 2] = bValid ? FMath::Clamp((-HalfSize[i] - Origin[i]) / Dir[i], 0.0f, 1.0f) : 0.0f;
+    }
 
-        // 2. 현재 OBB 위의 점에서 선분 위의 가장 가까운 점 찾기
-        FVector NewPointOnSegment = ClosestPointOnLineSegment(PointOnBox, A, B);
+    // 기울기가 0 이하인 가장 큰 t와 0 이상인 가장 작은 t 사이에는 경계면이 없으므로 이차식 하나로 표현됩니다.
+    float Lower = 0.0f;
+    float Upper = 1.0f;
+    for (const float T : Candidates)
+    {
+        const float G = Slope(T);
+        if (G <= 0.0f)
+        {
+            Lower = FMath::Max(Lower, T);
+        }
+        if (G >= 0.0f)
+        {
+            Upper = FMath::Min(Upper, T);
+        }
+    }
 
-        // 3. 수렴 확인: 이전 단계의 점과 새 점 사이의 거리 제곱 확인
-        double CurrentDistSq = (PointOnBox - NewPointOnSegment).SquaredLength();
-        double ImprovementSq = FMath::Abs(CurrentDistSq - LastDistSq);
+    const float Low = FMath::Min(Lower, Upper);
+    const float High = FMath::Max(Lower, Upper);
+    const float Mid = (Low + High) * 0.5f;
 
-        // 점이 거의 움직이지 않거나 거리가 더 이상 줄어들지 않으면 수렴으로 간주
-        if ((PointOnSegment - NewPointOnSegment).SquaredLength() < ToleranceSq || ImprovementSq < ToleranceSq * 0.1 ) // 개선 정도도 확인
+    // 구간 중앙에서 박스 밖에 있는 축만 이차식에 기여합니다.
+    float Numerator = 0.0f;
+    float Denominator = 0.0f;
+    for (int32 i = 0; i < 3; ++i)
+    {
+        const float Local = Origin[i] + Dir[i] * Mid;
+        if (Local > HalfSize[i] || Local < -HalfSize[i])
         {
-            PointOnSegment = NewPointOnSegment; // 마지막 위치 업데이트
-            LastDistSq = CurrentDistSq;
-            break;
+            const float Face = Local > HalfSize[i] ? HalfSize[i] : -HalfSize[i];
+            Numerator += (Origin[i] - Face) * Dir[i];
+            Denominator += Dir[i] * Dir[i];
         }
-
-        // 다음 반복을 위해 선분 위의 점 업데이트
-        PointOnSegment = NewPointOnSegment;
-        LastDistSq = CurrentDistSq; // 현재 거리 저장
     }
 
-    // 최종적으로 찾은 가장 가까운 두 점 사이의 거리 제곱 반환
-    // 마지막 반복 후 PointOnBox는 PointOnSegment에 대한 최단점이므로 다시 계산할 필요 없음
-    return static_cast<float>(LastDistSq);
+    const float T = Denominator > SMALL_NUMBER ? FMath::Clamp(-Numerator / Denominator, Low, High) : Low;
+    return FMath::Min(DistSq(T), FMath::Min(DistSq(Low), DistSq(High)));
 }
 
 FCollisionManager::FCollisionManager()
@@ -244,93 +263,418 @@ FCollisionManager::FCollisionManager()
     CollisionMatrix[static_cast<size_t>(EShapeType::Capsule)][static_cast<size_t>(EShapeType::Box)] = &FCollisionManager::Check_Capsule_Box;
     CollisionMatrix[static_cast<size_t>(EShapeType::Capsule)][static_cast<size_t>(EShapeType::Sphere)] = &FCollisionManager::Check_Capsule_Sphere;
     CollisionMatrix[static_cast<size_t>(EShapeType::Capsule)][static_cast<size_t>(EShapeType::Capsule)] = &FCollisionManager::Check_Capsule_Capsule;
+
+    for (size_t i = 0; i < NUM_TYPES; ++i)
+    {
+        for (size_t j = 0; j < NUM_TYPES; ++j)
+        {
+            BatchCollisionMatrix[i][j] = nullptr;
+        }
+    }
+
+    BatchCollisionMatrix[static_cast<size_t>(EShapeType::Box)][static_cast<size_t>(EShapeType::Box)] = &NarrowPhaseSIMD::Box_Box;
+    BatchCollisionMatrix[static_cast<size_t>(EShapeType::Box)][static_cast<size_t>(EShapeType::Sphere)] = &NarrowPhaseSIMD::Box_Sphere;
+    BatchCollisionMatrix[static_cast<size_t>(EShapeType::Box)][static_cast<size_t>(EShapeType::Capsule)] = &NarrowPhaseSIMD::Box_Capsule;
+    BatchCollisionMatrix[static_cast<size_t>(EShapeType::Sphere)][static_cast<size_t>(EShapeType::Sphere)] = &NarrowPhaseSIMD::Sphere_Sphere;
+    BatchCollisionMatrix[static_cast<size_t>(EShapeType::Sphere)][static_cast<size_t>(EShapeType::Capsule)] = &NarrowPhaseSIMD::Sphere_Capsule;
+    BatchCollisionMatrix[static_cast<size_t>(EShapeType::Capsule)][static_cast<size_t>(EShapeType::Capsule)] = &NarrowPhaseSIMD::Capsule_Capsule;
 }
 
-void FCollisionManager::CheckOverlap(const UWorld* World, const UPrimitiveComponent* Component, TArray<FOverlapResult>& OutOverlaps) const
+void FCollisionManager::CheckOverlap(const UWorld* World, const UPrimitiveComponent* Component, TArray<FOverlapResult>& OutOverlaps)
 {
     OutOverlaps.Empty();
     
-    if (!Component || !Component->IsA<UShapeComponent>())
+    if (!Component || !Component->IsA<UShapeComponent>() || Component->GetWorld() != World)
     {
         return;
     }
 
-    const bool bComponentHasValidBox = Component->AABB.IsValidBox();
-    
-    for (const auto Iter : TObjectRange<UShapeComponent>())
+    // 질의하는 Shape는 방금 움직였을 수 있으므로 Proxy를 먼저 갱신
+    const int32 MyProxyId = UpdateShapeProxy(Cast<UShapeComponent>(Component));
+    const FShapeWorldData& MyData = ShapeProxies[MyProxyId].Data;
+
+    BroadPhase.Query(MyData.Bounds, [&](int32 ProxyId)
+    {
+        if (ProxyId == MyProxyId)
+        {
+            return true;
+        }
+
+        const UShapeComponent* Other = Cast<UShapeComponent>(ShapeProxies[ProxyId].Shape.Get());
+        if (!Other || Other->GetWorld() != World)
+        {
+            return true;
+        }
+
+        // 다른 Shape는 UpdateBroadPhase 이후에 움직였을 수 있으므로 현재 Transform으로 다시 계산
+        FShapeWorldData OtherData;
+        CalculateShapeWorldData(Other, OtherData);
+
+        if (IsOverlapped(MyData, OtherData))
+        {
+            FOverlapResult OverlapResult;
+            OverlapResult.Actor = Other->GetOwner();
+            OverlapResult.Component = const_cast<UShapeComponent*>(Other);
+            OverlapResult.bBlockingHit = false;
+            OutOverlaps.Add(OverlapResult);
+        }
+        return true;
+    });
+}
+
+void FCollisionManager::UpdateBroadPhase(const UWorld* World)
+{
+    // 제거되었거나 다른 World로 옮겨간 Shape의 Proxy 정리
+    for (int32 ProxyId = 0; ProxyId < ShapeProxies.Num(); ++ProxyId)
+    {
+        if (!ShapeProxies[ProxyId].Key)
+        {
+            continue;
+        }
+
+        const UObject* Shape = ShapeProxies[ProxyId].Shape.Get();
+        if (!Shape || Shape->GetWorld() != World)
+        {
+            RemoveShapeProxy(ProxyId);
+        }
+    }
+
+    for (const UShapeComponent* Shape : TObjectRange<UShapeComponent>())
+    {
+        if (Shape->GetWorld() == World)
+        {
+            UpdateShapeProxy(Shape);
+        }
+    }
+}
+
+/** Editor에서는 Editor Tick을 받는 Actor의 Shape만 Overlap 이벤트를 발생시킵니다. */
+static bool CanDispatchOverlapEvents(const UWorld* World, const UShapeComponent* Shape)
+{
+    const AActor* Owner = Shape->GetOwner();
+    if (!Owner)
+    {
+        return false;
+    }
+
+    if (World->WorldType == EWorldType::Editor || World->WorldType == EWorldType::SkeletalViewer)
     {
-        if (!Iter || Iter->GetWorld() != World || Iter == Component)
+        return Owner->IsActorTickInEditor();
+    }
+    return true;
+}
+
+namespace
+{
+    /** Pair 검사 중에는 트리를 순회하고 있으므로, 이벤트는 모아두었다가 검사가 끝난 뒤에 보냅니다. */
+    struct FPendingOverlapEvent
+    {
+        UShapeComponent* Instigator;
+        UShapeComponent* Target;
+        bool bBegin;
+    };
+}
+
+void FCollisionManager::UpdateOverlaps(const UWorld* World)
+{
+    // 움직인 Shape 수집
+    TArray<int32> DirtyProxyIds;
+    for (int32 ProxyId = 0; ProxyId < ShapeProxies.Num(); ++ProxyId)
+    {
+        FShapeProxy& Proxy = ShapeProxies[ProxyId];
+        Proxy.bPendingPairs = Proxy.Key && Proxy.bDirty && Proxy.Shape.Get();
+        Proxy.bDirty = false;
+
+        if (Proxy.bPendingPairs)
+        {
+            DirtyProxyIds.Add(ProxyId);
+        }
+    }
+
+    TArray<FPendingOverlapEvent> PendingEvents;
+
+    auto AddEvent = [&](UShapeComponent* A, UShapeComponent* B, bool bBegin)
+    {
+        // Begin/EndComponentOverlap은 양쪽 모두에 적용되므로, 이벤트를 보낼 수 있는 쪽을 Instigator로 사용
+        if (CanDispatchOverlapEvents(World, A))
         {
-            continue;            
+            PendingEvents.Add({ A, B, bBegin });
         }
+        else if (CanDispatchOverlapEvents(World, B))
+        {
+            PendingEvents.Add({ B, A, bBegin });
+        }
+    };
+
+    for (const int32 ProxyId : DirtyProxyIds)
+    {
+        const FShapeWorldData& Data = ShapeProxies[ProxyId].Data;
+        UShapeComponent* Shape = const_cast<UShapeComponent*>(Data.Component);
 
-        bool bCanSkip = true;
-        
-        if (Iter->AABB.IsValidBox() && bComponentHasValidBox)
+        if (!Data.bGenerateOverlapEvents)
         {
-            if (FBoundingBox::CheckOverlap(Component->AABB, Iter->AABB))
+            // Overlap 이벤트를 끈 Shape는 기존 Overlap을 모두 종료
+            for (const FOverlapInfo& Overlap : Shape->GetOverlapInfos())
             {
-                bCanSkip = false;
+                if (UShapeComponent* OtherShape = Cast<UShapeComponent>(Overlap.OverlapInfo.Component))
+                {
+                    AddEvent(Shape, OtherShape, false);
+                }
             }
+            continue;
         }
-        else
+
+        // 중복 없는 Pair 생성: 상대도 움직였다면 Proxy Id가 큰 쪽에서만 검사
+        BroadPhase.Query(Data.Bounds, [&](int32 OtherProxyId)
         {
-            bCanSkip = false;
+            const FShapeProxy& OtherProxy = ShapeProxies[OtherProxyId];
+            if (OtherProxyId == ProxyId || (OtherProxy.bPendingPairs && OtherProxyId > ProxyId))
+            {
+                return true;
+            }
+
+            const FShapeWorldData& OtherData = OtherProxy.Data;
+            if (!OtherData.bGenerateOverlapEvents || !FBoundingBox::CheckOverlap(Data.Bounds, OtherData.Bounds))
+            {
+                return true;
+            }
+
+            // Narrow Phase는 Shape 조합별로 모아서 한 번에 검사
+            const SIZE_T ShapeType = static_cast<SIZE_T>(Data.ShapeType);
+            const SIZE_T OtherShapeType = static_cast<SIZE_T>(OtherData.ShapeType);
+            if (ShapeType >= NUM_TYPES || OtherShapeType >= NUM_TYPES)
+            {
+                return true;
+            }
+
+            if (ShapeType <= OtherShapeType)
+            {
+                CandidatePairs[ShapeType][OtherShapeType].Add({ ProxyId, OtherProxyId });
+            }
+            else
+            {
+                CandidatePairs[OtherShapeType][ShapeType].Add({ OtherProxyId, ProxyId });
+            }
+            return true;
+        });
+
+        // AABB가 더 이상 겹치지 않아 Pair가 만들어지지 않은 기존 Overlap 종료
+        for (const FOverlapInfo& Overlap : Shape->GetOverlapInfos())
+        {
+            UShapeComponent* OtherShape = Cast<UShapeComponent>(Overlap.OverlapInfo.Component);
+            if (!OtherShape)
+            {
+                continue;
+            }
+
+            const int32* OtherProxyId = ShapeToProxy.Find(OtherShape);
+            if (OtherProxyId)
+            {
+                const FShapeWorldData& OtherData = ShapeProxies[*OtherProxyId].Data;
+                if (OtherData.bGenerateOverlapEvents && FBoundingBox::CheckOverlap(Data.Bounds, OtherData.Bounds))
+                {
+                    continue;
+                }
+            }
+            AddEvent(Shape, OtherShape, false);
         }
+    }
 
-        if (!bCanSkip)
+    for (FShapeProxy& Proxy : ShapeProxies)
+    {
+        Proxy.bPendingPairs = false;
+    }
+
+    TArray<const FShapeWorldData*> BatchA;
+    TArray<const FShapeWorldData*> BatchB;
+    TArray<uint8> BatchResults;
+    for (SIZE_T i = 0; i < NUM_TYPES; ++i)
+    {
+        for (SIZE_T j = i; j < NUM_TYPES; ++j)
         {
-            FOverlapResult OverlapResult;
-            if (IsOverlapped(Component, Iter, OverlapResult))
+            TArray<FCandidatePair>& Pairs = CandidatePairs[i][j];
+            if (Pairs.Num() == 0)
+            {
+                continue;
+            }
+
+            BatchA.Empty();
+            BatchB.Empty();
+            for (const FCandidatePair& Pair : Pairs)
+            {
+                BatchA.Add(&ShapeProxies[Pair.ProxyIdA].Data);
+                BatchB.Add(&ShapeProxies[Pair.ProxyIdB].Data);
+            }
+
+            BatchResults.SetNum(Pairs.Num());
+            BatchCollisionMatrix[i][j](BatchA.GetData(), BatchB.GetData(), Pairs.Num(), BatchResults.GetData());
+
+            for (int32 PairIndex = 0; PairIndex < Pairs.Num(); ++PairIndex)
             {
-                OutOverlaps.Add(OverlapResult);
+                UShapeComponent* ShapeA = const_cast<UShapeComponent*>(BatchA[PairIndex]->Component);
+                UShapeComponent* ShapeB = const_cast<UShapeComponent*>(BatchB[PairIndex]->Component);
+
+                const bool bOverlapped = BatchResults[PairIndex] != 0;
+                const bool bWasOverlapped = ShapeA->IsOverlappingComponent(ShapeB);
+                if (bOverlapped != bWasOverlapped)
+                {
+                    AddEvent(ShapeA, ShapeB, bOverlapped);
+                }
             }
+
+            Pairs.Empty();
+        }
+    }
+
+    for (const FPendingOverlapEvent& Event : PendingEvents)
+    {
+        if (Event.bBegin)
+        {
+            Event.Instigator->BeginComponentOverlap(FOverlapInfo(Event.Target), true);
+        }
+        else
+        {
+            Event.Instigator->EndComponentOverlap(FOverlapInfo(Event.Target), true, false);
         }
     }
 }
 
-bool FCollisionManager::IsOverlapped(const UPrimitiveComponent* Component, const UPrimitiveComponent* OtherComponent, FOverlapResult& OutResult) const
+int32 FCollisionManager::UpdateShapeProxy(const UShapeComponent* Shape)
 {
-    if (!Component || !OtherComponent)
+    FShapeWorldData NewData;
+    CalculateShapeWorldData(Shape, NewData);
+
+    if (const int32* ProxyIdPtr = ShapeToProxy.Find(Shape))
     {
-        return false;
+        const int32 ProxyId = *ProxyIdPtr;
+        FShapeProxy& Proxy = ShapeProxies[ProxyId];
+
+        // 이전 Shape가 제거되고 같은 주소에 새 Shape가 생성된 경우에는 Proxy를 새로 만듦
+        if (Proxy.Shape.Get() == Shape)
+        {
+            if (!Proxy.Data.IsSameShape(NewData))
+            {
+                Proxy.bDirty = true;
+                BroadPhase.MoveProxy(ProxyId, NewData.Bounds);
+            }
+            Proxy.Data = NewData;
+            return ProxyId;
+        }
+        RemoveShapeProxy(ProxyId);
     }
-    if (!Component->IsA<UShapeComponent>() || !OtherComponent->IsA<UShapeComponent>())
+
+    const int32 ProxyId = BroadPhase.CreateProxy(NewData.Bounds);
+    if (ProxyId >= ShapeProxies.Num())
     {
-        return false;
+        ShapeProxies.SetNum(ProxyId + 1);
     }
 
-    const UShapeComponent* ShapeA = Cast<UShapeComponent>(Component);
-    const UShapeComponent* ShapeB = Cast<UShapeComponent>(OtherComponent);
+    FShapeProxy& Proxy = ShapeProxies[ProxyId];
+    Proxy.Key = Shape;
+    Proxy.Shape = Shape;
+    Proxy.Data = NewData;
+    ShapeToProxy.Add(Shape, ProxyId);
+
+    return ProxyId;
+}
+
+void FCollisionManager::RemoveShapeProxy(int32 ProxyId)
+{
+    FShapeProxy& Proxy = ShapeProxies[ProxyId];
+    ShapeToProxy.Remove(Proxy.Key);
+    Proxy = FShapeProxy();
 
-    const SIZE_T ShapeTypeA = static_cast<SIZE_T>(ShapeA->GetShapeType());
-    const SIZE_T ShapeTypeB = static_cast<SIZE_T>(ShapeB->GetShapeType());
+    BroadPhase.DestroyProxy(ProxyId);
+}
 
-    const bool bOverlapped = (this->*CollisionMatrix[ShapeTypeA][ShapeTypeB])(ShapeA, ShapeB, OutResult);
-    if (bOverlapped)
+void FCollisionManager::CalculateShapeWorldData(const UShapeComponent* Shape, FShapeWorldData& OutData)
+{
+    OutData.Component = Shape;
+    OutData.ShapeType = Shape->GetShapeType();
+    OutData.bGenerateOverlapEvents = Shape->GetGenerateOverlapEvents();
+
+    OutData.WorldMatrix = Shape->GetWorldMatrix();
+    OutData.Center = OutData.WorldMatrix.GetTranslationVector();
+    OutData.Axes[0] = Shape->GetForwardVector();
+    OutData.Axes[1] = Shape->GetRightVector();
+    OutData.Axes[2] = Shape->GetUpVector();
+
+    switch (OutData.ShapeType)
     {
-        OutResult.Actor = OtherComponent->GetOwner();
-        OutResult.Component = const_cast<UPrimitiveComponent*>(OtherComponent);
-        OutResult.bBlockingHit = false;
-        
-        return true;
+    case EShapeType::Box:
+    {
+        const UBoxComponent* Box = Cast<UBoxComponent>(Shape);
+        OutData.BoxExtent = Box->GetBoxExtent();
+
+        const FVector Scale = OutData.WorldMatrix.GetScaleVector();
+        OutData.BoxHalfSize = OutData.BoxExtent * FVector::GetAbs(Scale);
+
+        // Narrow Phase가 Scale을 적용한 축과 적용하지 않은 축을 모두 사용하므로, 둘 중 큰 범위를 사용
+        const float MaxScale = FMath::Max(1.0f, FMath::Max(FMath::Abs(Scale.X), FMath::Max(FMath::Abs(Scale.Y), FMath::Abs(Scale.Z))));
+
+        FVector HalfSize;
+        for (int32 i = 0; i < 3; ++i)
+        {
+            HalfSize = HalfSize + FVector::GetAbs(OutData.Axes[i] * OutData.BoxExtent[i]);
+        }
+        HalfSize = HalfSize * MaxScale;
+
+        OutData.Bounds = FBoundingBox(OutData.Center - HalfSize, OutData.Center + HalfSize);
+        break;
     }
+    case EShapeType::Sphere:
+    {
+        const USphereComponent* Sphere = Cast<USphereComponent>(Shape);
+        OutData.Radius = Sphere->GetRadius();
 
-    return false;
+        const FVector Radius(OutData.Radius);
+        OutData.Bounds = FBoundingBox(OutData.Center - Radius, OutData.Center + Radius);
+        break;
+    }
+    case EShapeType::Capsule:
+    {
+        const UCapsuleComponent* Capsule = Cast<UCapsuleComponent>(Shape);
+        OutData.Radius = Capsule->GetRadius();
+        Capsule->GetEndPoints(OutData.SegmentStart, OutData.SegmentEnd);
+
+        const FVector Radius(OutData.Radius);
+        OutData.Bounds = FBoundingBox(OutData.SegmentStart.ComponentMin(OutData.SegmentEnd) - Radius, OutData.SegmentStart.ComponentMax(OutData.SegmentEnd) + Radius);
+        break;
+    }
+    default:
+        OutData.Bounds = FBoundingBox(OutData.Center, OutData.Center);
+        break;
+    }
 }
 
-bool FCollisionManager::Check_NotImplemented(const UShapeComponent* A, const UShapeComponent* B, FOverlapResult& OutResult) const
+bool FShapeWorldData::IsSameShape(const FShapeWorldData& Other) const
+{
+    return ShapeType == Other.ShapeType
+        && bGenerateOverlapEvents == Other.bGenerateOverlapEvents
+        && WorldMatrix.Equals(Other.WorldMatrix, 0.f)
+        && BoxExtent == Other.BoxExtent
+        && Radius == Other.Radius
+        && SegmentStart == Other.SegmentStart
+        && SegmentEnd == Other.SegmentEnd;
+}
+
+bool FCollisionManager::IsOverlapped(const FShapeWorldData& A, const FShapeWorldData& B) const
+{
+    const SIZE_T ShapeTypeA = static_cast<SIZE_T>(A.ShapeType);
+    const SIZE_T ShapeTypeB = static_cast<SIZE_T>(B.ShapeType);
+
+    return (this->*CollisionMatrix[ShapeTypeA][ShapeTypeB])(A, B);
+}
+
+bool FCollisionManager::Check_NotImplemented(const FShapeWorldData& A, const FShapeWorldData& B) const
 {
     return false;
 }
 
-bool FCollisionManager::Check_Box_Box(const UShapeComponent* A, const UShapeComponent* B, FOverlapResult& OutResult) const
+bool FCollisionManager::Check_Box_Box(const FShapeWorldData& A, const FShapeWorldData& B) const
 {
-    UBoxComponent* BoxA = Cast<UBoxComponent>(A);
-    UBoxComponent* BoxB = Cast<UBoxComponent>(B);
-    
-    FVector AxesA[3] = { BoxA->GetForwardVector(), BoxA->GetRightVector(), BoxA->GetUpVector() };
-    FVector AxesB[3] = { BoxB->GetForwardVector(), BoxB->GetRightVector(), BoxB->GetUpVector() };
+    const FVector (&AxesA)[3] = A.Axes;
+    const FVector (&AxesB)[3] = B.Axes;
     FVector TestAxes[15]; // 검사할 축 (최대 15개)
 
     int32 AxisIndex = 0;
@@ -365,8 +709,8 @@ bool FCollisionManager::Check_Box_Box(const UShapeComponent* A, const UShapeComp
     for (int32 i = 0; i < AxisIndex; ++i)
     {
         float minA, maxA, minB, maxB;
-        ProjectOBB(BoxA, TestAxes[i], minA, maxA);
-        ProjectOBB(BoxB, TestAxes[i], minB, maxB);
+        ProjectOBB(A, TestAxes[i], minA, maxA);
+        ProjectOBB(B, TestAxes[i], minB, maxB);
 
         if (!OverlapOnAxis(minA, maxA, minB, maxB))
         {
@@ -378,107 +722,90 @@ bool FCollisionManager::Check_Box_Box(const UShapeComponent* A, const UShapeComp
     return true;
 }
 
-bool FCollisionManager::Check_Box_Sphere(const UShapeComponent* A, const UShapeComponent* B, FOverlapResult& OutResult) const
+bool FCollisionManager::Check_Box_Sphere(const FShapeWorldData& A, const FShapeWorldData& B) const
 {
-    UBoxComponent* Box = Cast<UBoxComponent>(A);
-    USphereComponent* Sphere = Cast<USphereComponent>(B);
+    const FShapeWorldData& Box = A;
+    const FShapeWorldData& Sphere = B;
     
     // 스피어 중심 P에서 OBB 위의 가장 가까운 점 Q 찾기
-    FVector ClosestPoint = ClosestPointOnOBB(Sphere->GetComponentLocation(), Box);
+    FVector ClosestPoint = ClosestPointOnOBB(Sphere.Center, Box);
 
     // P와 Q 사이의 거리 제곱 계산
-    FVector Diff = Sphere->GetComponentLocation() - ClosestPoint;
+    FVector Diff = Sphere.Center - ClosestPoint;
     float DistSq = Diff.SquaredLength();
 
     // 거리 제곱이 스피어 반지름 제곱보다 작거나 같으면 충돌
-    float RadiusSq = Sphere->GetRadius() * Sphere->GetRadius();
+    float RadiusSq = Sphere.Radius * Sphere.Radius;
     return DistSq <= RadiusSq;
 }
 
-bool FCollisionManager::Check_Box_Capsule(const UShapeComponent* A, const UShapeComponent* B, FOverlapResult& OutResult) const
+bool FCollisionManager::Check_Box_Capsule(const FShapeWorldData& A, const FShapeWorldData& B) const
 {
-    UBoxComponent* Box = Cast<UBoxComponent>(A);
-    UCapsuleComponent* Capsule = Cast<UCapsuleComponent>(B);
-    
-    FVector StartCap, EndCap;
-    Capsule->GetEndPoints(StartCap, EndCap);
+    const FShapeWorldData& Box = A;
+    const FShapeWorldData& Capsule = B;
 
     // 캡슐 선분과 OBB 사이의 최단 거리 제곱 계산
-    float DistSq = SquaredDistSegmentOBB(StartCap, EndCap, Box);
+    float DistSq = SquaredDistSegmentOBB(Capsule.SegmentStart, Capsule.SegmentEnd, Box);
 
     // 캡슐 반지름 제곱 계산
-    float RadiusSq = Capsule->GetRadius() * Capsule->GetRadius();
+    float RadiusSq = Capsule.Radius * Capsule.Radius;
 
     // 최단 거리 제곱이 캡슐 반지름 제곱보다 작거나 같으면 충돌
     return DistSq <= RadiusSq;
 }
 
-bool FCollisionManager::Check_Sphere_Box(const UShapeComponent* A, const UShapeComponent* B, FOverlapResult& OutResult) const
+bool FCollisionManager::Check_Sphere_Box(const FShapeWorldData& A, const FShapeWorldData& B) const
 {
-    return Check_Box_Sphere(B, A, OutResult);
+    return Check_Box_Sphere(B, A);
 }
 
-bool FCollisionManager::Check_Sphere_Sphere(const UShapeComponent* A, const UShapeComponent* B, FOverlapResult& OutResult) const
+bool FCollisionManager::Check_Sphere_Sphere(const FShapeWorldData& A, const FShapeWorldData& B) const
 {
-    USphereComponent* SphereA = Cast<USphereComponent>(A);
-    USphereComponent* SphereB = Cast<USphereComponent>(B);
-
-    float RadiusSum = SphereA->GetRadius() + SphereB->GetRadius();
+    float RadiusSum = A.Radius + B.Radius;
 
-    FVector Diff = SphereA->GetComponentLocation() - SphereB->GetComponentLocation();
+    FVector Diff = A.Center - B.Center;
     float DistSq = Diff.SquaredLength();
     
     return DistSq <= (RadiusSum * RadiusSum);
 }
 
-bool FCollisionManager::Check_Sphere_Capsule(const UShapeComponent* A, const UShapeComponent* B, FOverlapResult& OutResult) const
+bool FCollisionManager::Check_Sphere_Capsule(const FShapeWorldData& A, const FShapeWorldData& B) const
 {
-    USphereComponent* Sphere = Cast<USphereComponent>(A);
-    UCapsuleComponent* Capsule = Cast<UCapsuleComponent>(B);
+    const FShapeWorldData& Sphere = A;
+    const FShapeWorldData& Capsule = B;
 
-    FVector StartCap, EndCap;
-    Capsule->GetEndPoints(StartCap, EndCap);
-
-    // 스피어 중심(Sp.Location)에서 캡슐 선분(StartCap-EndCap)까지 가장 가까운 점 찾기
-    FVector ClosestPointOnSegment = ClosestPointOnLineSegment(Sphere->GetComponentLocation(), StartCap, EndCap);
+    // 스피어 중심에서 캡슐 선분까지 가장 가까운 점 찾기
+    FVector ClosestPointOnSegment = ClosestPointOnLineSegment(Sphere.Center, Capsule.SegmentStart, Capsule.SegmentEnd);
 
     // 스피어 중심과 가장 가까운 점 사이의 거리 제곱 계산
-    FVector Diff = Sphere->GetComponentLocation() - ClosestPointOnSegment;
+    FVector Diff = Sphere.Center - ClosestPointOnSegment;
     float DistSq = Diff.SquaredLength();
 
     // 캡슐 반지름과 스피어 반지름의 합 계산
-    float TotalRadius = Capsule->GetRadius() + Sphere->GetRadius();
+    float TotalRadius = Capsule.Radius + Sphere.Radius;
     float TotalRadiusSq = TotalRadius * TotalRadius;
 
     // 거리 제곱이 반지름 합 제곱보다 작거나 같으면 충돌
     return DistSq <= TotalRadiusSq;
 }
 
-bool FCollisionManager::Check_Capsule_Box(const UShapeComponent* A, const UShapeComponent* B, FOverlapResult& OutResult) const
+bool FCollisionManager::Check_Capsule_Box(const FShapeWorldData& A, const FShapeWorldData& B) const
 {
-    return Check_Box_Capsule(B, A, OutResult);   
+    return Check_Box_Capsule(B, A);
 }
 
-bool FCollisionManager::Check_Capsule_Sphere(const UShapeComponent* A, const UShapeComponent* B, FOverlapResult& OutResult) const
+bool FCollisionManager::Check_Capsule_Sphere(const FShapeWorldData& A, const FShapeWorldData& B) const
 {
-    return Check_Sphere_Capsule(B, A, OutResult);  
+    return Check_Sphere_Capsule(B, A);
 }
 
-bool FCollisionManager::Check_Capsule_Capsule(const UShapeComponent* A, const UShapeComponent* B, FOverlapResult& OutResult) const
+bool FCollisionManager::Check_Capsule_Capsule(const FShapeWorldData& A, const FShapeWorldData& B) const
 {
-    UCapsuleComponent* CapsuleA = Cast<UCapsuleComponent>(A);
-    UCapsuleComponent* CapsuleB = Cast<UCapsuleComponent>(B);
-    
-    FVector StartA, EndA, StartB, EndB;
-    CapsuleA->GetEndPoints(StartA, EndA);
-    CapsuleB->GetEndPoints(StartB, EndB);
-
-    // 두 선분 (StartA-EndA, StartB-EndB) 사이의 최단 거리 제곱 계산
-    // 주의: SquaredDistBetweenLineSegments 함수는 직접 구현해야 합니다.
-    float DistSq = SquaredDistBetweenLineSegments(StartA, EndA, StartB, EndB);
+    // 두 선분 사이의 최단 거리 제곱 계산
+    float DistSq = SquaredDistBetweenLineSegments(A.SegmentStart, A.SegmentEnd, B.SegmentStart, B.SegmentEnd);
 
     // 두 반지름의 합 계산
-    float TotalRadius = CapsuleA->GetRadius() + CapsuleB->GetRadius();
+    float TotalRadius = A.Radius + B.Radius;
     float TotalRadiusSq = TotalRadius * TotalRadius;
 
     // 최단 거리 제곱이 반지름 합 제곱보다 작거나 같으면 충돌
@@ -1,12 +1,52 @@
 #pragma once
 #include "Components/PrimitiveComponent.h"
 #include "Components/ShapeComponent.h"
+#include "DynamicAABBTree.h"
+#include "NarrowPhaseSIMD.h"
+#include "UObject/WeakObjectPtr.h"
 
 struct FOverlapResult;
 
 class FCollisionManager;
 
-using CollisionFunc = bool(FCollisionManager::*)(const UShapeComponent*, const UShapeComponent*, FOverlapResult&) const;
+/**
+ * Narrow Phase에서 사용하는 Shape의 World 공간 정보
+ * 한 틱에 한 번만 계산하고, 그 틱의 모든 Pair 검사에서 재사용합니다.
+ */
+struct FShapeWorldData
+{
+    const UShapeComponent* Component = nullptr;
+    EShapeType ShapeType = EShapeType::MAX;
+
+    FMatrix WorldMatrix;
+
+    FVector Center;
+
+    /** Forward, Right, Up 순서의 단위 축 */
+    FVector Axes[3];
+
+    /** Box의 Extent */
+    FVector BoxExtent;
+
+    /** World Scale을 적용한 Box의 Extent, Axes 방향의 반 길이 */
+    FVector BoxHalfSize;
+
+    /** Sphere, Capsule의 반지름 */
+    float Radius = 0.f;
+
+    /** Capsule 선분의 양 끝점 */
+    FVector SegmentStart;
+    FVector SegmentEnd;
+
+    FBoundingBox Bounds;
+
+    bool bGenerateOverlapEvents = false;
+
+    /** Transform과 Shape 크기가 모두 같은지 비교합니다. */
+    bool IsSameShape(const FShapeWorldData& Other) const;
+};
+
+using CollisionFunc = bool(FCollisionManager::*)(const FShapeWorldData&, const FShapeWorldData&) const;
 
 class FCollisionManager
 {
@@ -14,24 +54,85 @@ public:
     FCollisionManager();
     ~FCollisionManager() = default;
 
-    void CheckOverlap(const UWorld* World, const UPrimitiveComponent* Component, TArray<FOverlapResult>& OutOverlaps) const;
+    void CheckOverlap(const UWorld* World, const UPrimitiveComponent* Component, TArray<FOverlapResult>& OutOverlaps);
+
+    /**
+     * World에 있는 모든 Shape의 Broad Phase Proxy와 World 공간 정보를 현재 Transform에 맞게 갱신합니다.
+     * 제거된 Shape의 Proxy도 여기서 정리됩니다.
+     */
+    void UpdateBroadPhase(const UWorld* World);
+
+    /**
+     * 이번 틱에 움직인 Shape들로 중복 없는 Pair를 만들고, Shape 조합별로 모아 SIMD Narrow Phase로 한 번에 검사해
+     * Overlap 시작/종료 이벤트를 보냅니다. UpdateBroadPhase 이후에 호출해야 합니다.
+     */
+    void UpdateOverlaps(const UWorld* World);
+
+    /**
+     * CollisionMatrix의 스칼라 Check_* 함수로 두 Shape가 겹치는지 검사합니다.
+     * NarrowPhaseSIMD의 결과와 비교할 때도 사용합니다.
+     */
+    bool IsOverlapped(const FShapeWorldData& A, const FShapeWorldData& B) const;
 
 protected:
-    bool IsOverlapped(const UPrimitiveComponent* Component, const UPrimitiveComponent* OtherComponent, FOverlapResult& OutResult) const;
+    /** Shape의 Proxy를 추가하거나 현재 위치로 갱신하고, Proxy Id를 반환합니다. */
+    int32 UpdateShapeProxy(const UShapeComponent* Shape);
 
+    void RemoveShapeProxy(int32 ProxyId);
+
+    static void CalculateShapeWorldData(const UShapeComponent* Shape, FShapeWorldData& OutData);
+
+    struct FShapeProxy
+    {
+        /** Proxy를 등록할 때의 주소, ShapeToProxy의 Key로만 사용하고 역참조하지 않습니다. */
+        const UShapeComponent* Key = nullptr;
+
+        /** Shape가 제거되었는지 확인하기 위한 약한 참조 */
+        FWeakObjectPtr Shape;
+
+        FShapeWorldData Data;
+
+        /** 마지막 UpdateOverlaps 이후 Transform이나 Shape가 바뀌었는지 여부 */
+        bool bDirty = true;
+
+        /** UpdateOverlaps 도중, 이번 틱에 Pair를 만드는 Shape인지 여부 */
+        bool bPendingPairs = false;
+    };
+
+    /** Broad Phase를 통과한 Pair, ProxyIdA의 ShapeType이 ProxyIdB보다 앞섭니다. */
+    struct FCandidatePair
+    {
+        int32 ProxyIdA;
+        int32 ProxyIdB;
+    };
+
+    FDynamicAABBTree BroadPhase;
+
+    /** Proxy Id를 Index로 사용하는 배열, Proxy가 아닌 Index는 Key가 nullptr입니다. */
+    TArray<FShapeProxy> ShapeProxies;
+
+    TMap<const UShapeComponent*, int32> ShapeToProxy;
+
+protected:
     static constexpr SIZE_T NUM_TYPES = static_cast<SIZE_T>(EShapeType::MAX);
-    
+
     CollisionFunc CollisionMatrix[NUM_TYPES + 1][NUM_TYPES + 1];
 
-    bool Check_NotImplemented(const UShapeComponent* A, const UShapeComponent* B, FOverlapResult& OutResult) const;
-
-    bool Check_Box_Box(const UShapeComponent* A, const UShapeComponent* B, FOverlapResult& OutResult) const;
-    bool Check_Box_Sphere(const UShapeComponent* A, const UShapeComponent* B, FOverlapResult& OutResult) const;
-    bool Check_Box_Capsule(const UShapeComponent* A, const UShapeComponent* B, FOverlapResult& OutResult) const;
-    bool Check_Sphere_Box(const UShapeComponent* A, const UShapeComponent* B, FOverlapResult& OutResult) const;
-    bool Check_Sphere_Sphere(const UShapeComponent* A, const UShapeComponent* B, FOverlapResult& OutResult) const;
-    bool Check_Sphere_Capsule(const UShapeComponent* A, const UShapeComponent* B, FOverlapResult& OutResult) const;
-    bool Check_Capsule_Box(const UShapeComponent* A, const UShapeComponent* B, FOverlapResult& OutResult) const;
-    bool Check_Capsule_Sphere(const UShapeComponent* A, const UShapeComponent* B, FOverlapResult& OutResult) const;
-    bool Check_Capsule_Capsule(const UShapeComponent* A, const UShapeComponent* B, FOverlapResult& OutResult) const;
+    /** [ShapeTypeA][ShapeTypeB], ShapeTypeA <= ShapeTypeB인 조합만 사용합니다. */
+    NarrowPhaseSIMD::FBatchFunc BatchCollisionMatrix[NUM_TYPES][NUM_TYPES];
+
+    /** UpdateOverlaps에서 Shape 조합별로 모은 Pair, 매 틱 할당하지 않도록 재사용합니다. */
+    TArray<FCandidatePair> CandidatePairs[NUM_TYPES][NUM_TYPES];
+
+    bool Check_NotImplemented(const FShapeWorldData& A, const FShapeWorldData& B) const;
+
+    bool Check_Box_Box(const FShapeWorldData& A, const FShapeWorldData& B) const;
+    bool Check_Box_Sphere(const FShapeWorldData& A, const FShapeWorldData& B) const;
+    bool Check_Box_Capsule(const FShapeWorldData& A, const FShapeWorldData& B) const;
+    bool Check_Sphere_Box(const FShapeWorldData& A, const FShapeWorldData& B) const;
+    bool Check_Sphere_Sphere(const FShapeWorldData& A, const FShapeWorldData& B) const;
+    bool Check_Sphere_Capsule(const FShapeWorldData& A, const FShapeWorldData& B) const;
+    bool Check_Capsule_Box(const FShapeWorldData& A, const FShapeWorldData& B) const;
+    bool Check_Capsule_Sphere(const FShapeWorldData& A, const FShapeWorldData& B) const;
+    bool Check_Capsule_Capsule(const FShapeWorldData& A, const FShapeWorldData& B) const;
 };
@@ -0,0 +1,368 @@
+#include "DynamicAABBTree.h"
+
+
+FDynamicAABBTree::FDynamicAABBTree()
+{
+    Nodes.Reserve(16);
+}
+
+int32 FDynamicAABBTree::CreateProxy(const FBoundingBox& Bounds)
+{
+    const int32 ProxyId = AllocateNode();
+    FNode& Node = Nodes[ProxyId];
+
+    const FVector Margin(DefaultMargin);
+    Node.Bounds = FBoundingBox(Bounds.MinLocation - Margin, Bounds.MaxLocation + Margin);
+    Node.Height = 0;
+
+    InsertLeaf(ProxyId);
+    ++ProxyCount;
+
+    return ProxyId;
+}
+
+void FDynamicAABBTree::DestroyProxy(int32 ProxyId)
+{
+    assert(Nodes.IsValidIndex(ProxyId) && Nodes[ProxyId].IsLeaf());
+
+    RemoveLeaf(ProxyId);
+    FreeNode(ProxyId);
+    --ProxyCount;
+}
+
+bool FDynamicAABBTree::MoveProxy(int32 ProxyId, const FBoundingBox& Bounds)
+{
+    assert(Nodes.IsValidIndex(ProxyId) && Nodes[ProxyId].IsLeaf());
+
+    if (Contains(Nodes[ProxyId].Bounds, Bounds))
+    {
+        return false;
+    }
+
+    RemoveLeaf(ProxyId);
+
+    const FVector Margin(DefaultMargin);
+    Nodes[ProxyId].Bounds = FBoundingBox(Bounds.MinLocation - Margin, Bounds.MaxLocation + Margin);
+
+    InsertLeaf(ProxyId);
+    return true;
+}
+
+void FDynamicAABBTree::Empty()
+{
+    Nodes.Empty();
+    RootIndex = INDEX_NONE;
+    FreeListIndex = INDEX_NONE;
+    ProxyCount = 0;
+}
+
+int32 FDynamicAABBTree::AllocateNode()
+{
+    if (FreeListIndex == INDEX_NONE)
+    {
+        return Nodes.Emplace();
+    }
+
+    const int32 NodeIndex = FreeListIndex;
+    FreeListIndex = Nodes[NodeIndex].Parent;
+    Nodes[NodeIndex] = FNode();
+    return NodeIndex;
+}
+
+void FDynamicAABBTree::FreeNode(int32 NodeIndex)
+{
+    FNode& Node = Nodes[NodeIndex];
+    Node.Parent = FreeListIndex;
+    Node.Child1 = INDEX_NONE;
+    Node.Child2 = INDEX_NONE;
+    Node.Height = -1;
+    FreeListIndex = NodeIndex;
+}
+
+void FDynamicAABBTree::InsertLeaf(int32 Leaf)
+{
+    if (RootIndex == INDEX_NONE)
+    {
+        RootIndex = Leaf;
+        Nodes[RootIndex].Parent = INDEX_NONE;
+        return;
+    }
+
+    // 표면적 비용이 가장 적게 늘어나는 형제 Node를 찾습니다.
+    const FBoundingBox LeafBounds = Nodes[Leaf].Bounds;
+    int32 Index = RootIndex;
+    while (!Nodes[Index].IsLeaf())
+    {
+        const FNode& Node = Nodes[Index];
+        const int32 Child1 = Node.Child1;
+        const int32 Child2 = Node.Child2;
+
+        const float Area = GetSurfaceArea(Node.Bounds);
+        const float CombinedArea = GetSurfaceArea(Union(Node.Bounds, LeafBounds));
+
+        // 여기서 새 부모를 만드는 비용
+        const float Cost = 2.0f * CombinedArea;
+
+        // 더 아래로 내려갈 때 상위 Node들이 커지는 비용
+        const float InheritanceCost = 2.0f * (CombinedArea - Area);
+
+        auto GetDescendCost = [&](int32 ChildIndex)
+        {
+            const FNode& Child = Nodes[ChildIndex];
+            const float NewArea = GetSurfaceArea(Union(LeafBounds, Child.Bounds));
+            if (Child.IsLeaf())
+            {
+                return NewArea + InheritanceCost;
+            }
+            return (NewArea - GetSurfaceArea(Child.Bounds)) + InheritanceCost;
+        };
+
+        const float Cost1 = GetDescendCost(Child1);
+        const float Cost2 = GetDescendCost(Child2);
+
+        if (Cost < Cost1 && Cost < Cost2)
+        {
+            break;
+        }
+
+        Index = (Cost1 < Cost2) ? Child1 : Child2;
+    }
+
+    const int32 Sibling = Index;
+
+    // 형제 Node와 Leaf를 묶는 새 부모 Node
+    const int32 OldParent = Nodes[Sibling].Parent;
+    const int32 NewParent = AllocateNode();
+    {
+        FNode& Node = Nodes[NewParent];
+        Node.Parent = OldParent;
+        Node.Bounds = Union(LeafBounds, Nodes[Sibling].Bounds);
+        Node.Height = Nodes[Sibling].Height + 1;
+        Node.Child1 = Sibling;
+        Node.Child2 = Leaf;
+    }
+
+    if (OldParent != INDEX_NONE)
+    {
+        if (Nodes[OldParent].Child1 == Sibling)
+        {
+            Nodes[OldParent].Child1 = NewParent;
+        }
+        else
+        {
+            Nodes[OldParent].Child2 = NewParent;
+        }
+    }
+    else
+    {
+        RootIndex = NewParent;
+    }
+    Nodes[Sibling].Parent = NewParent;
+    Nodes[Leaf].Parent = NewParent;
+
+    // 위로 올라가면서 AABB와 높이를 갱신하고 균형을 맞춥니다.
+    Index = Nodes[Leaf].Parent;
+    while (Index != INDEX_NONE)
+    {
+        Index = Balance(Index);
+
+        FNode& Node = Nodes[Index];
+        const FNode& Child1 = Nodes[Node.Child1];
+        const FNode& Child2 = Nodes[Node.Child2];
+        Node.Height = 1 + FMath::Max(Child1.Height, Child2.Height);
+        Node.Bounds = Union(Child1.Bounds, Child2.Bounds);
+
+        Index = Node.Parent;
+    }
+}
+
+void FDynamicAABBTree::RemoveLeaf(int32 Leaf)
+{
+    if (Leaf == RootIndex)
+    {
+        RootIndex = INDEX_NONE;
+        return;
+    }
+
+    const int32 Parent = Nodes[Leaf].Parent;
+    const int32 GrandParent = Nodes[Parent].Parent;
+    const int32 Sibling = (Nodes[Parent].Child1 == Leaf) ? Nodes[Parent].Child2 : Nodes[Parent].Child1;
+
+    if (GrandParent == INDEX_NONE)
+    {
+        RootIndex = Sibling;
+        Nodes[Sibling].Parent = INDEX_NONE;
+        FreeNode(Parent);
+        return;
+    }
+
+    // 부모 Node를 제거하고 형제 Node를 조부모에 연결합니다.
+    if (Nodes[GrandParent].Child1 == Parent)
+    {
+        Nodes[GrandParent].Child1 = Sibling;
+    }
+    else
+    {
+        Nodes[GrandParent].Child2 = Sibling;
+    }
+    Nodes[Sibling].Parent = GrandParent;
+    FreeNode(Parent);
+
+    int32 Index = GrandParent;
+    while (Index != INDEX_NONE)
+    {
+        Index = Balance(Index);
+
+        FNode& Node = Nodes[Index];
+        const FNode& Child1 = Nodes[Node.Child1];
+        const FNode& Child2 = Nodes[Node.Child2];
+        Node.Bounds = Union(Child1.Bounds, Child2.Bounds);
+        Node.Height = 1 + FMath::Max(Child1.Height, Child2.Height);
+
+        Index = Node.Parent;
+    }
+}
+
+int32 FDynamicAABBTree::Balance(int32 IndexA)
+{
+    //       A
+    //     /   \
+    //    B     C
+    //   / \   / \
+    //  D   E F   G
+    FNode& A = Nodes[IndexA];
+    if (A.IsLeaf() || A.Height < 2)
+    {
+        return IndexA;
+    }
+
+    const int32 IndexB = A.Child1;
+    const int32 IndexC = A.Child2;
+    FNode& B = Nodes[IndexB];
+    FNode& C = Nodes[IndexC];
+
+    const int32 HeightDiff = C.Height - B.Height;
+
+    // C를 위로 올립니다.
+    if (HeightDiff > 1)
+    {
+        const int32 IndexF = C.Child1;
+        const int32 IndexG = C.Child2;
+        FNode& F = Nodes[IndexF];
+        FNode& G = Nodes[IndexG];
+
+        C.Child1 = IndexA;
+        C.Parent = A.Parent;
+        A.Parent = IndexC;
+
+        if (C.Parent != INDEX_NONE)
+        {
+            if (Nodes[C.Parent].Child1 == IndexA)
+            {
+                Nodes[C.Parent].Child1 = IndexC;
+            }
+            else
+            {
+                Nodes[C.Parent].Child2 = IndexC;
+            }
+        }
+        else
+        {
+            RootIndex = IndexC;
+        }
+
+        if (F.Height > G.Height)
+        {
+            C.Child2 = IndexF;
+            A.Child2 = IndexG;
+            G.Parent = IndexA;
+            A.Bounds = Union(B.Bounds, G.Bounds);
+            C.Bounds = Union(A.Bounds, F.Bounds);
+            A.Height = 1 + FMath::Max(B.Height, G.Height);
+            C.Height = 1 + FMath::Max(A.Height, F.Height);
+        }
+        else
+        {
+            C.Child2 = IndexG;
+            A.Child2 = IndexF;
+            F.Parent = IndexA;
+            A.Bounds = Union(B.Bounds, F.Bounds);
+            C.Bounds = Union(A.Bounds, G.Bounds);
+            A.Height = 1 + FMath::Max(B.Height, F.Height);
+            C.Height = 1 + FMath::Max(A.Height, G.Height);
+        }
+
+        return IndexC;
+    }
+
+    // B를 위로 올립니다.
+    if (HeightDiff < -1)
+    {
+        const int32 IndexD = B.Child1;
+        const int32 IndexE = B.Child2;
+        FNode& D = Nodes[IndexD];
+        FNode& E = Nodes[IndexE];
+
+        B.Child1 = IndexA;
+        B.Parent = A.Parent;
+        A.Parent = IndexB;
+
+        if (B.Parent != INDEX_NONE)
+        {
+            if (Nodes[B.Parent].Child1 == IndexA)
+            {
+                Nodes[B.Parent].Child1 = IndexB;
+            }
+            else
+            {
+                Nodes[B.Parent].Child2 = IndexB;
+            }
+        }
+        else
+        {
+            RootIndex = IndexB;
+        }
+
+        if (D.Height > E.Height)
+        {
+            B.Child2 = IndexD;
+            A.Child1 = IndexE;
+            E.Parent = IndexA;
+            A.Bounds = Union(C.Bounds, E.Bounds);
+            B.Bounds = Union(A.Bounds, D.Bounds);
+            A.Height = 1 + FMath::Max(C.Height, E.Height);
+            B.Height = 1 + FMath::Max(A.Height, D.Height);
+        }
+        else
+        {
+            B.Child2 = IndexE;
+            A.Child1 = IndexD;
+            D.Parent = IndexA;
+            A.Bounds = Union(C.Bounds, D.Bounds);
+            B.Bounds = Union(A.Bounds, E.Bounds);
+            A.Height = 1 + FMath::Max(C.Height, D.Height);
+            B.Height = 1 + FMath::Max(A.Height, E.Height);
+        }
+
+        return IndexB;
+    }
+
+    return IndexA;
+}
+
+FBoundingBox FDynamicAABBTree::Union(const FBoundingBox& A, const FBoundingBox& B)
+{
+    return FBoundingBox(A.MinLocation.ComponentMin(B.MinLocation), A.MaxLocation.ComponentMax(B.MaxLocation));
+}
+
+float FDynamicAABBTree::GetSurfaceArea(const FBoundingBox& Bounds)
+{
+    const FVector Size = Bounds.MaxLocation - Bounds.MinLocation;
+    return 2.0f * (Size.X * Size.Y + Size.Y * Size.Z + Size.Z * Size.X);
+}
+
+bool FDynamicAABBTree::Contains(const FBoundingBox& Outer, const FBoundingBox& Inner)
+{
+    return Outer.MinLocation.X <= Inner.MinLocation.X && Outer.MinLocation.Y <= Inner.MinLocation.Y && Outer.MinLocation.Z <= Inner.MinLocation.Z
+        && Inner.MaxLocation.X <= Outer.MaxLocation.X && Inner.MaxLocation.Y <= Outer.MaxLocation.Y && Inner.MaxLocation.Z <= Outer.MaxLocation.Z;
+}
@@ -0,0 +1,130 @@
+#pragma once
+#include <cassert>
+
+#include "Define.h"
+#include "CoreMiscDefines.h"
+#include "Container/Array.h"
+
+
+/**
+ * Broad Phase에 사용하는 동적 AABB 트리
+ *
+ * Leaf는 실제 AABB보다 Margin만큼 넓힌 Fat AABB를 저장하므로, 작은 이동에서는 트리를 다시 구성하지 않습니다.
+ * Node는 배열에 저장되고, 비워진 Node는 Free List로 재사용되어 Proxy Id가 이동하지 않습니다.
+ */
+class FDynamicAABBTree
+{
+public:
+    /** Fat AABB를 만들 때 각 축으로 넓히는 값 */
+    static constexpr float DefaultMargin = 0.1f;
+
+public:
+    FDynamicAABBTree();
+
+    /**
+     * 새 Leaf를 추가합니다.
+     * @param Bounds 실제 AABB
+     * @return Proxy Id, Proxy가 제거될 때까지 바뀌지 않습니다.
+     */
+    int32 CreateProxy(const FBoundingBox& Bounds);
+
+    /** Proxy를 제거합니다. */
+    void DestroyProxy(int32 ProxyId);
+
+    /**
+     * Proxy의 AABB를 갱신합니다.
+     * 새 AABB가 기존 Fat AABB 안에 있으면 아무것도 하지 않습니다.
+     * @return 트리에 다시 삽입되었으면 true
+     */
+    bool MoveProxy(int32 ProxyId, const FBoundingBox& Bounds);
+
+    const FBoundingBox& GetFatBounds(int32 ProxyId) const { return Nodes[ProxyId].Bounds; }
+
+    int32 GetProxyCount() const { return ProxyCount; }
+    int32 GetHeight() const { return RootIndex == INDEX_NONE ? 0 : Nodes[RootIndex].Height; }
+
+    /**
+     * Bounds와 겹치는 모든 Leaf에 대해 Callback(ProxyId)을 호출합니다.
+     * Callback이 false를 반환하면 순회를 중단합니다.
+     */
+    template <typename CallbackType>
+    void Query(const FBoundingBox& Bounds, CallbackType&& Callback) const;
+
+    /** 모든 Node를 제거합니다. */
+    void Empty();
+
+private:
+    struct FNode
+    {
+        FBoundingBox Bounds;
+
+        int32 Parent = INDEX_NONE;  // Free List에 있을 때는 다음 빈 Node의 Index
+        int32 Child1 = INDEX_NONE;
+        int32 Child2 = INDEX_NONE;
+
+        /** Leaf는 0, 빈 Node는 -1 */
+        int32 Height = -1;
+
+        bool IsLeaf() const { return Child1 == INDEX_NONE; }
+    };
+
+    int32 AllocateNode();
+    void FreeNode(int32 NodeIndex);
+
+    void InsertLeaf(int32 Leaf);
+    void RemoveLeaf(int32 Leaf);
+
+    /** NodeIndex를 기준으로 회전하여 높이 차이를 1 이하로 맞추고, 새 서브트리의 루트를 반환합니다. */
+    int32 Balance(int32 NodeIndex);
+
+    static FBoundingBox Union(const FBoundingBox& A, const FBoundingBox& B);
+    static float GetSurfaceArea(const FBoundingBox& Bounds);
+    static bool Contains(const FBoundingBox& Outer, const FBoundingBox& Inner);
+
+private:
+    TArray<FNode> Nodes;
+
+    int32 RootIndex = INDEX_NONE;
+    int32 FreeListIndex = INDEX_NONE;
+    int32 ProxyCount = 0;
+};
+
+
+template <typename CallbackType>
+void FDynamicAABBTree::Query(const FBoundingBox& Bounds, CallbackType&& Callback) const
+{
+    if (RootIndex == INDEX_NONE)
+    {
+        return;
+    }
+
+    // 균형 잡힌 트리의 높이는 log2(N) 수준이므로 고정 크기 스택으로 충분합니다.
+    constexpr int32 MaxStackSize = 256;
+    int32 Stack[MaxStackSize];
+    int32 StackSize = 0;
+    Stack[StackSize++] = RootIndex;
+
+    while (StackSize > 0)
+    {
+        const int32 NodeIndex = Stack[--StackSize];
+        const FNode& Node = Nodes[NodeIndex];
+        if (!FBoundingBox::CheckOverlap(Node.Bounds, Bounds))
+        {
+            continue;
+        }
+
+        if (Node.IsLeaf())
+        {
+            if (!Callback(NodeIndex))
+            {
+                return;
+            }
+        }
+        else
+        {
+            assert(StackSize + 2 <= MaxStackSize);
+            Stack[StackSize++] = Node.Child1;
+            Stack[StackSize++] = Node.Child2;
+        }
+    }
+}
@@ -0,0 +1,156 @@
+#include <cmath>
+#include <random>
+
+#include "DynamicAABBTree.h"
+#include "Container/Map.h"
+#include "Container/Set.h"
+#include "Misc/Benchmark.h"
+#include "UserInterface/Console.h"
+
+namespace
+{
+    /**
+     * 움직이는 Proxy Count개로 FDynamicAABBTree와 전체 쌍 검사(이전 구현)의 Broad Phase 시간을 비교합니다.
+     * 매 프레임 모든 Proxy를 조금씩 움직인 뒤 MoveProxy와 Query를 측정하고,
+     * 전체 쌍 검사는 O(N^2)이라 일부 Query만 실행해서 Query당 시간을 구합니다.
+     * 전체 쌍 검사가 찾은 겹침을 트리가 모두 찾았는지도 확인합니다.
+     */
+    void RunBroadPhaseBenchmark(const FBenchmarkContext& Context)
+    {
+        constexpr int32 NumFrames = 10;
+        constexpr float HalfExtent = 0.5f;
+        constexpr float MaxSpeed = 0.05f;
+        const int32 NumProxies = Context.Count;
+
+        std::mt19937 Random(static_cast<uint32>(NumProxies));
+        // Proxy당 평균 겹침 수가 NumProxies와 상관없이 비슷하도록 공간의 부피를 Proxy 수에 비례시킴
+        const float WorldExtent = std::cbrt(static_cast<float>(NumProxies)) * 2.0f;
+        std::uniform_real_distribution<float> PositionDist(-WorldExtent, WorldExtent);
+        std::uniform_real_distribution<float> VelocityDist(-MaxSpeed, MaxSpeed);
+
+        TArray<FVector> Positions;
+        TArray<FVector> Velocities;
+        TArray<FBoundingBox> Bounds;
+        Positions.SetNum(NumProxies);
+        Velocities.SetNum(NumProxies);
+        Bounds.SetNum(NumProxies);
+
+        auto MakeBounds = [](const FVector& Position)
+        {
+            const FVector Extent(HalfExtent, HalfExtent, HalfExtent);
+            return FBoundingBox(Position - Extent, Position + Extent);
+        };
+
+        for (int32 Index = 0; Index < NumProxies; ++Index)
+        {
+            Positions[Index] = FVector(PositionDist(Random), PositionDist(Random), PositionDist(Random));
+            Velocities[Index] = FVector(VelocityDist(Random), VelocityDist(Random), VelocityDist(Random));
+            Bounds[Index] = MakeBounds(Positions[Index]);
+        }
+
+        FDynamicAABBTree Tree;
+        TArray<int32> ProxyIds;
+        ProxyIds.SetNum(NumProxies);
+
+        Context.Measure("Tree build", NumProxies, [&]
+        {
+            for (int32 Index = 0; Index < NumProxies; ++Index)
+            {
+                ProxyIds[Index] = Tree.CreateProxy(Bounds[Index]);
+            }
+        }, "proxy");
+
+        // ProxyId -> Proxy Index
+        TMap<int32, int32> ProxyIndices;
+        ProxyIndices.Reserve(NumProxies);
+        for (int32 Index = 0; Index < NumProxies; ++Index)
+        {
+            ProxyIndices.Add(ProxyIds[Index], Index);
+        }
+
+        double MoveMs = 0.0;
+        double QueryMs = 0.0;
+        int32 NumReinserted = 0;
+        uint64 NumTreePairs = 0;
+        for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+        {
+            for (int32 Index = 0; Index < NumProxies; ++Index)
+            {
+                Positions[Index] += Velocities[Index];
+                Bounds[Index] = MakeBounds(Positions[Index]);
+            }
+
+            MoveMs += MeasureMilliseconds([&]
+            {
+                for (int32 Index = 0; Index < NumProxies; ++Index)
+                {
+                    NumReinserted += Tree.MoveProxy(ProxyIds[Index], Bounds[Index]) ? 1 : 0;
+                }
+            });
+            QueryMs += MeasureMilliseconds([&]
+            {
+                for (int32 Index = 0; Index < NumProxies; ++Index)
+                {
+                    Tree.Query(Bounds[Index], [&NumTreePairs](int32) { ++NumTreePairs; return true; });
+                }
+            });
+        }
+
+        // 마지막 프레임 위치에서 일부 Proxy만 전체 쌍 검사
+        const int32 NumBruteForceQueries = FMath::Min(NumProxies, 1000);
+        const int32 Stride = FMath::Max(NumProxies / NumBruteForceQueries, 1);
+        uint64 NumBruteForcePairs = 0;
+        int32 NumMissed = 0;
+        TArray<int32> Overlaps;
+
+        double BruteForceMs = 0.0;
+        for (int32 Query = 0; Query < NumBruteForceQueries; ++Query)
+        {
+            const int32 QueryIndex = Query * Stride;
+
+            Overlaps.Empty();
+            BruteForceMs += MeasureMilliseconds([&]
+            {
+                for (int32 Index = 0; Index < NumProxies; ++Index)
+                {
+                    if (FBoundingBox::CheckOverlap(Bounds[QueryIndex], Bounds[Index]))
+                    {
+                        Overlaps.Add(Index);
+                    }
+                }
+            });
+            NumBruteForcePairs += Overlaps.Num();
+
+            // 트리는 Fat AABB로 찾으므로 전체 쌍 검사 결과를 모두 포함해야 함
+            TSet<int32> TreeOverlaps;
+            Tree.Query(Bounds[QueryIndex], [&](int32 ProxyId)
+            {
+                TreeOverlaps.Add(ProxyIndices[ProxyId]);
+                return true;
+            });
+            for (const int32 Index : Overlaps)
+            {
+                NumMissed += TreeOverlaps.Contains(Index) ? 0 : 1;
+            }
+        }
+
+        const int32 NumQueries = NumProxies * NumFrames;
+        Context.Report("Tree move", MoveMs, NumQueries, "proxy");
+        Context.Report("Tree query", QueryMs, NumQueries, "query");
+        Context.Report("Brute force query", BruteForceMs, NumBruteForceQueries, "query");
+        Context.Console.AddLog(
+            ELogLevel::Display, "%.1f%% reinserted, %.1f tree candidates and %.1f overlaps per query",
+            NumReinserted * 100.0 / NumQueries, static_cast<double>(NumTreePairs) / NumQueries,
+            static_cast<double>(NumBruteForcePairs) / NumBruteForceQueries
+        );
+        Context.Console.AddLog(
+            NumMissed == 0 ? ELogLevel::Display : ELogLevel::Error,
+            "Broad phase bench: %d proxies, %d frames, tree height %d, %d overlaps missed by the tree",
+            NumProxies, NumFrames, Tree.GetHeight(), NumMissed
+        );
+    }
+
+    FAutoRegisterBenchmark BroadPhaseBenchmark(
+        "broadphase bench", "[proxies]: Compare the dynamic AABB tree against brute force with moving proxies", 50000, &RunBroadPhaseBenchmark
+    );
+}
@@ -0,0 +1,383 @@
+#include "NarrowPhaseSIMD.h"
+
+#include "CollisionManager.h"
+#include "Math/MathSSE.h"
+
+using namespace SSE;
+
+namespace
+{
+    /** Lane마다 다른 Vector를 X, Y, Z 레지스터로 나눠 담은 SoA Vector */
+    struct FVectorSoA
+    {
+        VectorRegister4Float X;
+        VectorRegister4Float Y;
+        VectorRegister4Float Z;
+    };
+
+    FORCEINLINE FVectorSoA operator+(const FVectorSoA& A, const FVectorSoA& B)
+    {
+        return { VectorAdd(A.X, B.X), VectorAdd(A.Y, B.Y), VectorAdd(A.Z, B.Z) };
+    }
+
+    FORCEINLINE FVectorSoA operator-(const FVectorSoA& A, const FVectorSoA& B)
+    {
+        return { VectorSubtract(A.X, B.X), VectorSubtract(A.Y, B.Y), VectorSubtract(A.Z, B.Z) };
+    }
+
+    FORCEINLINE FVectorSoA operator*(const FVectorSoA& A, const VectorRegister4Float& Scale)
+    {
+        return { VectorMultiply(A.X, Scale), VectorMultiply(A.Y, Scale), VectorMultiply(A.Z, Scale) };
+    }
+
+    FORCEINLINE VectorRegister4Float Dot(const FVectorSoA& A, const FVectorSoA& B)
+    {
+        return VectorMultiplyAdd(A.X, B.X, VectorMultiplyAdd(A.Y, B.Y, VectorMultiply(A.Z, B.Z)));
+    }
+
+    FORCEINLINE VectorRegister4Float GatherFloat(const FShapeWorldData* const* Lanes, float FShapeWorldData::* Member)
+    {
+        return VectorSet(Lanes[0]->*Member, Lanes[1]->*Member, Lanes[2]->*Member, Lanes[3]->*Member);
+    }
+
+    FORCEINLINE FVectorSoA GatherVector(const FVector& V0, const FVector& V1, const FVector& V2, const FVector& V3)
+    {
+        return {
+            VectorSet(V0.X, V1.X, V2.X, V3.X),
+            VectorSet(V0.Y, V1.Y, V2.Y, V3.Y),
+            VectorSet(V0.Z, V1.Z, V2.Z, V3.Z),
+        };
+    }
+
+    FORCEINLINE FVectorSoA GatherVector(const FShapeWorldData* const* Lanes, FVector FShapeWorldData::* Member)
+    {
+        return GatherVector(Lanes[0]->*Member, Lanes[1]->*Member, Lanes[2]->*Member, Lanes[3]->*Member);
+    }
+
+    FORCEINLINE FVectorSoA GatherAxis(const FShapeWorldData* const* Lanes, int32 AxisIndex)
+    {
+        return GatherVector(Lanes[0]->Axes[AxisIndex], Lanes[1]->Axes[AxisIndex], Lanes[2]->Axes[AxisIndex], Lanes[3]->Axes[AxisIndex]);
+    }
+
+    /** 선분 Start-End 위에서 Point와 가장 가까운 점, 스칼라 ClosestPointOnLineSegment와 같은 규칙을 따릅니다. */
+    FORCEINLINE FVectorSoA ClosestPointOnSegment(const FVectorSoA& Point, const FVectorSoA& Start, const FVectorSoA& End)
+    {
+        const VectorRegister4Float Zero = VectorZero();
+        const VectorRegister4Float One = VectorSetFloat1(1.0f);
+
+        const FVectorSoA Dir = End - Start;
+        const VectorRegister4Float LengthSq = Dot(Dir, Dir);
+        const VectorRegister4Float bDegenerate = VectorCompareLT(LengthSq, VectorSetFloat1(KINDA_SMALL_NUMBER));
+
+        VectorRegister4Float T = VectorDivide(Dot(Point - Start, Dir), VectorSelect(bDegenerate, One, LengthSq));
+        T = VectorSelect(bDegenerate, Zero, VectorClamp(T, Zero, One));
+        return Start + Dir * T;
+    }
+
+    /** 두 선분 P1-Q1, P2-Q2 사이의 최단 거리 제곱, 스칼라 SquaredDistBetweenLineSegments의 분기를 Select로 바꾼 것입니다. */
+    VectorRegister4Float SquaredDistSegmentSegment(const FVectorSoA& P1, const FVectorSoA& Q1, const FVectorSoA& P2, const FVectorSoA& Q2)
+    {
+        const VectorRegister4Float Zero = VectorZero();
+        const VectorRegister4Float One = VectorSetFloat1(1.0f);
+        const VectorRegister4Float Epsilon = VectorSetFloat1(KINDA_SMALL_NUMBER);
+
+        const FVectorSoA D1 = Q1 - P1;
+        const FVectorSoA D2 = Q2 - P2;
+        const FVectorSoA R = P1 - P2;
+
+        const VectorRegister4Float A = Dot(D1, D1);
+        const VectorRegister4Float E = Dot(D2, D2);
+        const VectorRegister4Float F = Dot(D2, R);
+        const VectorRegister4Float C = Dot(D1, R);
+        const VectorRegister4Float B = Dot(D1, D2);
+
+        const VectorRegister4Float bPointA = VectorCompareLE(A, Epsilon);
+        const VectorRegister4Float bPointB = VectorCompareLE(E, Epsilon);
+        const VectorRegister4Float SafeA = VectorSelect(bPointA, One, A);
+        const VectorRegister4Float SafeE = VectorSelect(bPointB, One, E);
+
+        // 두 선분 모두 길이가 있는 일반적인 경우
+        const VectorRegister4Float Denom = VectorSubtract(VectorMultiply(A, E), VectorMultiply(B, B));
+        const VectorRegister4Float bParallel = VectorCompareLE(Denom, VectorSetFloat1(SMALL_NUMBER));
+        VectorRegister4Float S = VectorDivide(VectorSubtract(VectorMultiply(B, F), VectorMultiply(C, E)), VectorSelect(bParallel, One, Denom));
+        S = VectorSelect(bParallel, Zero, VectorClamp(S, Zero, One));
+
+        VectorRegister4Float T = VectorDivide(VectorMultiplyAdd(B, S, F), SafeE);
+        const VectorRegister4Float SAtStart = VectorClamp(VectorDivide(VectorNegate(C), SafeA), Zero, One);
+        const VectorRegister4Float SAtEnd = VectorClamp(VectorDivide(VectorSubtract(B, C), SafeA), Zero, One);
+        const VectorRegister4Float bBelow = VectorCompareLT(T, Zero);
+        const VectorRegister4Float bAbove = VectorCompareGT(T, One);
+        S = VectorSelect(bBelow, SAtStart, VectorSelect(bAbove, SAtEnd, S));
+        T = VectorClamp(T, Zero, One);
+
+        // 두 번째 선분이 점인 경우
+        S = VectorSelect(bPointB, SAtStart, S);
+        T = VectorSelect(bPointB, Zero, T);
+
+        // 첫 번째 선분이 점인 경우
+        S = VectorSelect(bPointA, Zero, S);
+        T = VectorSelect(bPointA, VectorSelect(bPointB, Zero, VectorClamp(VectorDivide(F, SafeE), Zero, One)), T);
+
+        const FVectorSoA Diff = (P1 + D1 * S) - (P2 + D2 * T);
+        return Dot(Diff, Diff);
+    }
+
+    /** Box 로컬 공간의 점 Local과 [-HalfSize, HalfSize] 사이 거리를 축마다 구한 값, 안에 있으면 0 */
+    FORCEINLINE VectorRegister4Float AxisExcess(const VectorRegister4Float& Local, const VectorRegister4Float& HalfSize)
+    {
+        return VectorSubtract(Local, VectorClamp(Local, VectorNegate(HalfSize), HalfSize));
+    }
+
+    /**
+     * Box 로컬 공간의 선분 Origin + t * Dir (t ∈ [0, 1])과 Box 사이의 최단 거리 제곱
+     * 스칼라 SquaredDistSegmentOBB와 같은 방법으로 계산합니다.
+     */
+    VectorRegister4Float SquaredDistSegmentBox(const VectorRegister4Float (&Origin)[3], const VectorRegister4Float (&Dir)[3], const VectorRegister4Float (&HalfSize)[3])
+    {
+        const VectorRegister4Float Zero = VectorZero();
+        const VectorRegister4Float One = VectorSetFloat1(1.0f);
+
+        auto Slope = [&](const VectorRegister4Float& T)
+        {
+            VectorRegister4Float Result = Zero;
+            for (int32 i = 0; i < 3; ++i)
+            {
+                Result = VectorMultiplyAdd(Dir[i], AxisExcess(VectorMultiplyAdd(Dir[i], T, Origin[i]), HalfSize[i]), Result);
+            }
+            return Result;
+        };
+
+        auto DistSq = [&](const VectorRegister4Float& T)
+        {
+            VectorRegister4Float Result = Zero;
+            for (int32 i = 0; i < 3; ++i)
+            {
+                const VectorRegister4Float Excess = AxisExcess(VectorMultiplyAdd(Dir[i], T, Origin[i]), HalfSize[i]);
+                Result = VectorMultiplyAdd(Excess, Excess, Result);
+            }
+            return Result;
+        };
+
+        // 양 끝점과 선분이 각 Slab의 경계면을 지나는 t
+        VectorRegister4Float Candidates[8] = { Zero, One };
+        for (int32 i = 0; i < 3; ++i)
+        {
+            const VectorRegister4Float bValid = VectorCompareGT(VectorAbs(Dir[i]), VectorSetFloat1(SMALL_NUMBER));
+            const VectorRegister4Float SafeDir = VectorSelect(bValid, Dir[i], One);
+            const VectorRegister4Float T0 = VectorDivide(VectorSubtract(HalfSize[i], Origin[i]), SafeDir);
+            const VectorRegister4Float T1 = VectorDivide(VectorSubtract(VectorNegate(HalfSize[i]), Origin[i]), SafeDir);
+            Candidates[2 + i * 2] = VectorSelect(bValid, VectorClamp(T0, Zero, One), Zero);
+            Candidates[3 + i * 2] = VectorSelect(bValid, VectorClamp(T1, Zero, One), Zero);
+        }
+
+        // 기울기가 0 이하인 가장 큰 t와 0 이상인 가장 작은 t 사이에는 경계면이 없으므로 이차식 하나로 표현됩니다.
+        VectorRegister4Float Lower = Zero;
+        VectorRegister4Float Upper = One;
+        for (const VectorRegister4Float& T : Candidates)
+        {
+            const VectorRegister4Float G = Slope(T);
+            Lower = VectorMax(Lower, VectorSelect(VectorCompareLE(G, Zero), T, Zero));
+            Upper = VectorMin(Upper, VectorSelect(VectorCompareGE(G, Zero), T, One));
+        }
+
+        const VectorRegister4Float Low = VectorMin(Lower, Upper);
+        const VectorRegister4Float High = VectorMax(Lower, Upper);
+        const VectorRegister4Float Mid = VectorMultiply(VectorAdd(Low, High), VectorSetFloat1(0.5f));
+
+        // 구간 중앙에서 Box 밖에 있는 축만 이차식에 기여합니다.
+        VectorRegister4Float Numerator = Zero;
+        VectorRegister4Float Denominator = Zero;
+        for (int32 i = 0; i < 3; ++i)
+        {
+            const VectorRegister4Float Local = VectorMultiplyAdd(Dir[i], Mid, Origin[i]);
+            const VectorRegister4Float bAbove = VectorCompareGT(Local, HalfSize[i]);
+            const VectorRegister4Float bBelow = VectorCompareLT(Local, VectorNegate(HalfSize[i]));
+            const VectorRegister4Float bOutside = VectorBitwiseOr(bAbove, bBelow);
+
+            const VectorRegister4Float Face = VectorSelect(bAbove, HalfSize[i], VectorNegate(HalfSize[i]));
+            const VectorRegister4Float Offset = VectorSubtract(Origin[i], Face);
+            Numerator = VectorAdd(Numerator, VectorBitwiseAnd(bOutside, VectorMultiply(Offset, Dir[i])));
+            Denominator = VectorAdd(Denominator, VectorBitwiseAnd(bOutside, VectorMultiply(Dir[i], Dir[i])));
+        }
+
+        const VectorRegister4Float bFlat = VectorCompareLE(Denominator, VectorSetFloat1(SMALL_NUMBER));
+        VectorRegister4Float T = VectorDivide(VectorNegate(Numerator), VectorSelect(bFlat, One, Denominator));
+        T = VectorSelect(bFlat, Low, VectorClamp(T, Low, High));
+
+        return VectorMin(DistSq(T), VectorMin(DistSq(Low), DistSq(High)));
+    }
+
+    /** 4쌍씩 Lane에 채워 Kernel을 실행합니다. 남는 Lane은 마지막 Pair를 반복해서 채웁니다. */
+    template <typename KernelType>
+    void RunBatch(const FShapeWorldData* const* A, const FShapeWorldData* const* B, int32 NumPairs, uint8* OutOverlapped, KernelType&& Kernel)
+    {
+        for (int32 Start = 0; Start < NumPairs; Start += NarrowPhaseSIMD::LaneCount)
+        {
+            const int32 NumLanes = FMath::Min(NarrowPhaseSIMD::LaneCount, NumPairs - Start);
+
+            const FShapeWorldData* LanesA[NarrowPhaseSIMD::LaneCount];
+            const FShapeWorldData* LanesB[NarrowPhaseSIMD::LaneCount];
+            for (int32 Lane = 0; Lane < NarrowPhaseSIMD::LaneCount; ++Lane)
+            {
+                const int32 Index = Start + FMath::Min(Lane, NumLanes - 1);
+                LanesA[Lane] = A[Index];
+                LanesB[Lane] = B[Index];
+            }
+
+            const int32 Mask = VectorMaskBits(Kernel(LanesA, LanesB));
+            for (int32 Lane = 0; Lane < NumLanes; ++Lane)
+            {
+                OutOverlapped[Start + Lane] = static_cast<uint8>((Mask >> Lane) & 1);
+            }
+        }
+    }
+}
+
+void NarrowPhaseSIMD::Box_Box(const FShapeWorldData* const* A, const FShapeWorldData* const* B, int32 NumPairs, uint8* OutOverlapped)
+{
+    RunBatch(A, B, NumPairs, OutOverlapped, [](const FShapeWorldData* const* BoxA, const FShapeWorldData* const* BoxB)
+    {
+        const FVectorSoA AxesA[3] = { GatherAxis(BoxA, 0), GatherAxis(BoxA, 1), GatherAxis(BoxA, 2) };
+        const FVectorSoA AxesB[3] = { GatherAxis(BoxB, 0), GatherAxis(BoxB, 1), GatherAxis(BoxB, 2) };
+        const FVectorSoA ExtentA = GatherVector(BoxA, &FShapeWorldData::BoxExtent);
+        const FVectorSoA ExtentB = GatherVector(BoxB, &FShapeWorldData::BoxExtent);
+        const VectorRegister4Float EA[3] = { ExtentA.X, ExtentA.Y, ExtentA.Z };
+        const VectorRegister4Float EB[3] = { ExtentB.X, ExtentB.Y, ExtentB.Z };
+
+        // B의 축을 A의 축 기준으로 나타낸 회전 행렬
+        VectorRegister4Float R[3][3];
+        VectorRegister4Float AbsR[3][3];
+        for (int32 i = 0; i < 3; ++i)
+        {
+            for (int32 j = 0; j < 3; ++j)
+            {
+                R[i][j] = Dot(AxesA[i], AxesB[j]);
+                AbsR[i][j] = VectorAbs(R[i][j]);
+            }
+        }
+
+        // 중심 사이의 Vector를 A의 축 기준으로 나타낸 값
+        const FVectorSoA Delta = GatherVector(BoxB, &FShapeWorldData::Center) - GatherVector(BoxA, &FShapeWorldData::Center);
+        const VectorRegister4Float T[3] = { Dot(Delta, AxesA[0]), Dot(Delta, AxesA[1]), Dot(Delta, AxesA[2]) };
+
+        VectorRegister4Float Overlapped = VectorCompareLE(VectorZero(), VectorSetFloat1(1.0f));
+
+        // Box A의 3개 축
+        for (int32 i = 0; i < 3; ++i)
+        {
+            const VectorRegister4Float RadiusB = VectorMultiplyAdd(EB[0], AbsR[i][0], VectorMultiplyAdd(EB[1], AbsR[i][1], VectorMultiply(EB[2], AbsR[i][2])));
+            Overlapped = VectorBitwiseAnd(Overlapped, VectorCompareLE(VectorAbs(T[i]), VectorAdd(EA[i], RadiusB)));
+        }
+
+        // Box B의 3개 축
+        for (int32 j = 0; j < 3; ++j)
+        {
+            const VectorRegister4Float RadiusA = VectorMultiplyAdd(EA[0], AbsR[0][j], VectorMultiplyAdd(EA[1], AbsR[1][j], VectorMultiply(EA[2], AbsR[2][j])));
+            const VectorRegister4Float Distance = VectorAbs(VectorMultiplyAdd(T[0], R[0][j], VectorMultiplyAdd(T[1], R[1][j], VectorMultiply(T[2], R[2][j]))));
+            Overlapped = VectorBitwiseAnd(Overlapped, VectorCompareLE(Distance, VectorAdd(RadiusA, EB[j])));
+        }
+
+        // Box A의 축과 Box B의 축 간의 외적 9개, 평행한 축은 스칼라 버전처럼 검사하지 않습니다.
+        const VectorRegister4Float ParallelThreshold = VectorSetFloat1(1e-6f);
+        for (int32 i = 0; i < 3; ++i)
+        {
+            const int32 I1 = (i + 1) % 3;
+            const int32 I2 = (i + 2) % 3;
+            for (int32 j = 0; j < 3; ++j)
+            {
+                const int32 J1 = (j + 1) % 3;
+                const int32 J2 = (j + 2) % 3;
+
+                const VectorRegister4Float RadiusA = VectorMultiplyAdd(EA[I1], AbsR[I2][j], VectorMultiply(EA[I2], AbsR[I1][j]));
+                const VectorRegister4Float RadiusB = VectorMultiplyAdd(EB[J1], AbsR[i][J2], VectorMultiply(EB[J2], AbsR[i][J1]));
+                const VectorRegister4Float Distance = VectorAbs(VectorSubtract(VectorMultiply(T[I2], R[I1][j]), VectorMultiply(T[I1], R[I2][j])));
+
+                const VectorRegister4Float CrossSq = VectorSubtract(VectorSetFloat1(1.0f), VectorMultiply(R[i][j], R[i][j]));
+                const VectorRegister4Float bParallel = VectorCompareLE(CrossSq, ParallelThreshold);
+                const VectorRegister4Float bAxisOverlapped = VectorCompareLE(Distance, VectorAdd(RadiusA, RadiusB));
+                Overlapped = VectorBitwiseAnd(Overlapped, VectorBitwiseOr(bParallel, bAxisOverlapped));
+            }
+        }
+
+        return Overlapped;
+    });
+}
+
+void NarrowPhaseSIMD::Box_Sphere(const FShapeWorldData* const* A, const FShapeWorldData* const* B, int32 NumPairs, uint8* OutOverlapped)
+{
+    RunBatch(A, B, NumPairs, OutOverlapped, [](const FShapeWorldData* const* Box, const FShapeWorldData* const* Sphere)
+    {
+        const FVectorSoA Relative = GatherVector(Sphere, &FShapeWorldData::Center) - GatherVector(Box, &FShapeWorldData::Center);
+        const FVectorSoA HalfSize = GatherVector(Box, &FShapeWorldData::BoxHalfSize);
+        const VectorRegister4Float HalfSizes[3] = { HalfSize.X, HalfSize.Y, HalfSize.Z };
+
+        VectorRegister4Float DistSq = VectorZero();
+        for (int32 i = 0; i < 3; ++i)
+        {
+            const VectorRegister4Float Excess = AxisExcess(Dot(Relative, GatherAxis(Box, i)), HalfSizes[i]);
+            DistSq = VectorMultiplyAdd(Excess, Excess, DistSq);
+        }
+
+        const VectorRegister4Float Radius = GatherFloat(Sphere, &FShapeWorldData::Radius);
+        return VectorCompareLE(DistSq, VectorMultiply(Radius, Radius));
+    });
+}
+
+void NarrowPhaseSIMD::Box_Capsule(const FShapeWorldData* const* A, const FShapeWorldData* const* B, int32 NumPairs, uint8* OutOverlapped)
+{
+    RunBatch(A, B, NumPairs, OutOverlapped, [](const FShapeWorldData* const* Box, const FShapeWorldData* const* Capsule)
+    {
+        const FVectorSoA Start = GatherVector(Capsule, &FShapeWorldData::SegmentStart);
+        const FVectorSoA Relative = Start - GatherVector(Box, &FShapeWorldData::Center);
+        const FVectorSoA Direction = GatherVector(Capsule, &FShapeWorldData::SegmentEnd) - Start;
+        const FVectorSoA HalfSize = GatherVector(Box, &FShapeWorldData::BoxHalfSize);
+
+        VectorRegister4Float Origin[3];
+        VectorRegister4Float Dir[3];
+        for (int32 i = 0; i < 3; ++i)
+        {
+            const FVectorSoA Axis = GatherAxis(Box, i);
+            Origin[i] = Dot(Relative, Axis);
+            Dir[i] = Dot(Direction, Axis);
+        }
+
+        const VectorRegister4Float DistSq = SquaredDistSegmentBox(Origin, Dir, { HalfSize.X, HalfSize.Y, HalfSize.Z });
+        const VectorRegister4Float Radius = GatherFloat(Capsule, &FShapeWorldData::Radius);
+        return VectorCompareLE(DistSq, VectorMultiply(Radius, Radius));
+    });
+}
+
+void NarrowPhaseSIMD::Sphere_Sphere(const FShapeWorldData* const* A, const FShapeWorldData* const* B, int32 NumPairs, uint8* OutOverlapped)
+{
+    RunBatch(A, B, NumPairs, OutOverlapped, [](const FShapeWorldData* const* SphereA, const FShapeWorldData* const* SphereB)
+    {
+        const FVectorSoA Diff = GatherVector(SphereA, &FShapeWorldData::Center) - GatherVector(SphereB, &FShapeWorldData::Center);
+        const VectorRegister4Float RadiusSum = VectorAdd(GatherFloat(SphereA, &FShapeWorldData::Radius), GatherFloat(SphereB, &FShapeWorldData::Radius));
+        return VectorCompareLE(Dot(Diff, Diff), VectorMultiply(RadiusSum, RadiusSum));
+    });
+}
+
+void NarrowPhaseSIMD::Sphere_Capsule(const FShapeWorldData* const* A, const FShapeWorldData* const* B, int32 NumPairs, uint8* OutOverlapped)
+{
+    RunBatch(A, B, NumPairs, OutOverlapped, [](const FShapeWorldData* const* Sphere, const FShapeWorldData* const* Capsule)
+    {
+        const FVectorSoA Center = GatherVector(Sphere, &FShapeWorldData::Center);
+        const FVectorSoA Closest = ClosestPointOnSegment(Center, GatherVector(Capsule, &FShapeWorldData::SegmentStart), GatherVector(Capsule, &FShapeWorldData::SegmentEnd));
+        const FVectorSoA Diff = Center - Closest;
+        const VectorRegister4Float RadiusSum = VectorAdd(GatherFloat(Sphere, &FShapeWorldData::Radius), GatherFloat(Capsule, &FShapeWorldData::Radius));
+        return VectorCompareLE(Dot(Diff, Diff), VectorMultiply(RadiusSum, RadiusSum));
+    });
+}
+
+void NarrowPhaseSIMD::Capsule_Capsule(const FShapeWorldData* const* A, const FShapeWorldData* const* B, int32 NumPairs, uint8* OutOverlapped)
+{
+    RunBatch(A, B, NumPairs, OutOverlapped, [](const FShapeWorldData* const* CapsuleA, const FShapeWorldData* const* CapsuleB)
+    {
+        const VectorRegister4Float DistSq = SquaredDistSegmentSegment(
+            GatherVector(CapsuleA, &FShapeWorldData::SegmentStart), GatherVector(CapsuleA, &FShapeWorldData::SegmentEnd),
+            GatherVector(CapsuleB, &FShapeWorldData::SegmentStart), GatherVector(CapsuleB, &FShapeWorldData::SegmentEnd)
+        );
+        const VectorRegister4Float RadiusSum = VectorAdd(GatherFloat(CapsuleA, &FShapeWorldData::Radius), GatherFloat(CapsuleB, &FShapeWorldData::Radius));
+        return VectorCompareLE(DistSq, VectorMultiply(RadiusSum, RadiusSum));
+    });
+}
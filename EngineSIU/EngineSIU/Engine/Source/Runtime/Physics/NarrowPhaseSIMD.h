@@ -0,0 +1,26 @@
+#pragma once
+#include "HAL/PlatformType.h"
+
+struct FShapeWorldData;
+
+
+/**
+ * 같은 Shape 조합의 Pair들을 SSE 레지스터 하나에 4쌍씩 SoA로 모아 한 번에 검사하는 Narrow Phase
+ *
+ * 모든 함수는 A[i]와 B[i]가 겹치면 OutOverlapped[i]에 1, 아니면 0을 기록합니다.
+ * A는 항상 Box, Sphere, Capsule 순서에서 앞선 Shape여야 합니다.
+ */
+namespace NarrowPhaseSIMD
+{
+    /** 한 번에 검사하는 Pair의 수 */
+    constexpr int32 LaneCount = 4;
+
+    using FBatchFunc = void(*)(const FShapeWorldData* const* A, const FShapeWorldData* const* B, int32 NumPairs, uint8* OutOverlapped);
+
+    void Box_Box(const FShapeWorldData* const* A, const FShapeWorldData* const* B, int32 NumPairs, uint8* OutOverlapped);
+    void Box_Sphere(const FShapeWorldData* const* A, const FShapeWorldData* const* B, int32 NumPairs, uint8* OutOverlapped);
+    void Box_Capsule(const FShapeWorldData* const* A, const FShapeWorldData* const* B, int32 NumPairs, uint8* OutOverlapped);
+    void Sphere_Sphere(const FShapeWorldData* const* A, const FShapeWorldData* const* B, int32 NumPairs, uint8* OutOverlapped);
+    void Sphere_Capsule(const FShapeWorldData* const* A, const FShapeWorldData* const* B, int32 NumPairs, uint8* OutOverlapped);
+    void Capsule_Capsule(const FShapeWorldData* const* A, const FShapeWorldData* const* B, int32 NumPairs, uint8* OutOverlapped);
+}
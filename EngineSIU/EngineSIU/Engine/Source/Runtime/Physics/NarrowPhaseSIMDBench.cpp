@@ -0,0 +1,156 @@
+#include <random>
+
+#include "CollisionManager.h"
+#include "NarrowPhaseSIMD.h"
+#include "Math/Quat.h"
+#include "Misc/Benchmark.h"
+#include "UserInterface/Console.h"
+
+namespace
+{
+    /**
+     * 임의의 Shape Pair Count개를 조합별로 만들어 NarrowPhaseSIMD와 스칼라 Check_* 함수의 결과와 시간을 비교합니다.
+     * 겹치는 Pair가 충분히 나오도록 Shape를 좁은 공간에 배치합니다.
+     */
+    void RunNarrowPhaseBenchmark(const FBenchmarkContext& Context)
+    {
+        const int32 NumPairs = Context.Count;
+
+        std::mt19937 Random(static_cast<uint32>(NumPairs));
+        std::uniform_real_distribution<float> UnitDist(-1.0f, 1.0f);
+        std::uniform_real_distribution<float> SizeDist(0.2f, 1.5f);
+        std::uniform_real_distribution<float> ScaleDist(0.5f, 2.0f);
+        std::uniform_real_distribution<float> AngleDist(0.0f, 2.0f * PI);
+
+        auto RandomVector = [&](float Scale)
+        {
+            return FVector(UnitDist(Random), UnitDist(Random), UnitDist(Random)) * Scale;
+        };
+
+        auto MakeShape = [&](EShapeType ShapeType)
+        {
+            FShapeWorldData Data;
+            Data.ShapeType = ShapeType;
+            Data.bGenerateOverlapEvents = true;
+            Data.Center = RandomVector(2.0f);
+
+            FVector Axis = RandomVector(1.0f).GetSafeNormal();
+            if (Axis.IsNearlyZero())
+            {
+                Axis = FVector::UpVector;
+            }
+            const FQuat Rotation(Axis, AngleDist(Random));
+            Data.Axes[0] = Rotation.RotateVector(FVector::ForwardVector);
+            Data.Axes[1] = Rotation.RotateVector(FVector::RightVector);
+            Data.Axes[2] = Rotation.RotateVector(FVector::UpVector);
+
+            switch (ShapeType)
+            {
+            case EShapeType::Box:
+                Data.BoxExtent = FVector(SizeDist(Random), SizeDist(Random), SizeDist(Random));
+                Data.BoxHalfSize = Data.BoxExtent * ScaleDist(Random);
+                break;
+            case EShapeType::Sphere:
+                Data.Radius = SizeDist(Random);
+                break;
+            case EShapeType::Capsule:
+            {
+                Data.Radius = SizeDist(Random);
+                const FVector HalfSegment = Data.Axes[2] * SizeDist(Random);
+                Data.SegmentStart = Data.Center - HalfSegment;
+                Data.SegmentEnd = Data.Center + HalfSegment;
+                break;
+            }
+            default:
+                break;
+            }
+            return Data;
+        };
+
+        const FCollisionManager CollisionManager;
+
+        struct FPairType
+        {
+            const char* Name;
+            EShapeType ShapeTypeA;
+            EShapeType ShapeTypeB;
+            NarrowPhaseSIMD::FBatchFunc BatchFunc;
+        };
+        const FPairType PairTypes[] = {
+            { "Box_Box", EShapeType::Box, EShapeType::Box, &NarrowPhaseSIMD::Box_Box },
+            { "Box_Sphere", EShapeType::Box, EShapeType::Sphere, &NarrowPhaseSIMD::Box_Sphere },
+            { "Box_Capsule", EShapeType::Box, EShapeType::Capsule, &NarrowPhaseSIMD::Box_Capsule },
+            { "Sphere_Sphere", EShapeType::Sphere, EShapeType::Sphere, &NarrowPhaseSIMD::Sphere_Sphere },
+            { "Sphere_Capsule", EShapeType::Sphere, EShapeType::Capsule, &NarrowPhaseSIMD::Sphere_Capsule },
+            { "Capsule_Capsule", EShapeType::Capsule, EShapeType::Capsule, &NarrowPhaseSIMD::Capsule_Capsule },
+        };
+
+        int32 TotalMismatches = 0;
+        for (const FPairType& PairType : PairTypes)
+        {
+            TArray<FShapeWorldData> ShapesA;
+            TArray<FShapeWorldData> ShapesB;
+            ShapesA.Reserve(NumPairs);
+            ShapesB.Reserve(NumPairs);
+            for (int32 Index = 0; Index < NumPairs; ++Index)
+            {
+                ShapesA.Add(MakeShape(PairType.ShapeTypeA));
+                ShapesB.Add(MakeShape(PairType.ShapeTypeB));
+            }
+
+            // UpdateOverlaps처럼 Pair를 포인터 배열로 모아서 전달
+            TArray<const FShapeWorldData*> PairA;
+            TArray<const FShapeWorldData*> PairB;
+            PairA.SetNum(NumPairs);
+            PairB.SetNum(NumPairs);
+            for (int32 Index = 0; Index < NumPairs; ++Index)
+            {
+                PairA[Index] = &ShapesA[Index];
+                PairB[Index] = &ShapesB[Index];
+            }
+
+            TArray<uint8> ScalarResults;
+            TArray<uint8> SIMDResults;
+            ScalarResults.SetNum(NumPairs);
+            SIMDResults.SetNum(NumPairs);
+
+            const std::string ScalarLabel = std::string(PairType.Name) + " scalar";
+            Context.Measure(ScalarLabel.c_str(), NumPairs, [&]
+            {
+                for (int32 Index = 0; Index < NumPairs; ++Index)
+                {
+                    ScalarResults[Index] = CollisionManager.IsOverlapped(ShapesA[Index], ShapesB[Index]) ? 1 : 0;
+                }
+            }, "pair");
+
+            const std::string SIMDLabel = std::string(PairType.Name) + " SSE";
+            Context.Measure(SIMDLabel.c_str(), NumPairs, [&]
+            {
+                PairType.BatchFunc(PairA.GetData(), PairB.GetData(), NumPairs, SIMDResults.GetData());
+            }, "pair");
+
+            int32 NumOverlapped = 0;
+            int32 NumMismatches = 0;
+            for (int32 Index = 0; Index < NumPairs; ++Index)
+            {
+                NumOverlapped += ScalarResults[Index];
+                NumMismatches += (ScalarResults[Index] != SIMDResults[Index]) ? 1 : 0;
+            }
+            TotalMismatches += NumMismatches;
+
+            Context.Console.AddLog(
+                NumMismatches == 0 ? ELogLevel::Display : ELogLevel::Error,
+                "%-16s %.1f%% overlapped, %d mismatches", PairType.Name, NumOverlapped * 100.0 / NumPairs, NumMismatches
+            );
+        }
+
+        Context.Console.AddLog(
+            TotalMismatches == 0 ? ELogLevel::Display : ELogLevel::Error,
+            "Narrow phase bench: %d pairs per shape pair, %d mismatches", NumPairs, TotalMismatches
+        );
+    }
+
+    FAutoRegisterBenchmark NarrowPhaseBenchmark(
+        "narrowphase bench", "[pairs]: Compare SSE narrow phase results and time against the scalar Check_* functions", 100000, &RunNarrowPhaseBenchmark
+    );
+}
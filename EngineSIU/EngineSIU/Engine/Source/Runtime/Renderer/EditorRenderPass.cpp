@@ -352,10 +352,10 @@ void FEditorRenderPass::LazyLoad()
     FStaticMeshRenderData* RenderData = FObjManager::GetStaticMesh(L"Assets/GizmoTranslationZ.obj")->GetRenderData();
 
     FVertexInfo VertexInfo;
-    BufferManager->CreateVertexBuffer(RenderData->ObjectName, RenderData->Vertices, VertexInfo);
+    BufferManager->CreateVertexBuffer(RenderData->ObjectName, RenderData->GetVertexData(), RenderData->GetNumVertices(), VertexInfo);
 
     FIndexInfo IndexInfo;
-    BufferManager->CreateIndexBuffer(RenderData->ObjectName, RenderData->Indices, IndexInfo);
+    BufferManager->CreateIndexBuffer(RenderData->ObjectName, RenderData->GetIndexData(), RenderData->GetNumIndices(), IndexInfo);
     
     Resources.Primitives.Arrow.VertexInfo.VertexBuffer = VertexInfo.VertexBuffer;
     Resources.Primitives.Arrow.VertexInfo.NumVertices = VertexInfo.NumVertices;
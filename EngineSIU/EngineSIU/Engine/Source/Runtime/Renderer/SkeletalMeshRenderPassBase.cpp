@@ -219,39 +219,13 @@ void FSkeletalMeshRenderPassBase::UpdateBone(const USkeletalMeshComponent* Skele
     //const TArray<FTransform>& BindPose = RefSkeleton.RawRefBonePose; // 로컬
     //const TArray<FTransform>& CurrentPose = SkeletalMeshComponent->BoneTransforms; // 로컬
     //const TArray<FMatrix>& InverseBindPoseMatrices = RefSkeleton.InverseBindPoseMatrices; // 글로벌
-    const int32 BoneNum = RefSkeleton.RawRefBoneInfo.Num();
-
-    // 현재 애니메이션 본 행렬 계산
-    TArray<FMatrix> CurrentGlobalBoneMatrices;
-    SkeletalMeshComponent->GetCurrentGlobalBoneMatrices(CurrentGlobalBoneMatrices);
-    // CurrentGlobalBoneMatrices.SetNum(BoneNum);
-    //
-    // for (int32 BoneIndex = 0; BoneIndex < BoneNum; ++BoneIndex)
-    // {
-    //     // 현재 본의 로컬 변환
-    //     FTransform CurrentLocalTransform = CurrentPose[BoneIndex];
-    //     FMatrix LocalMatrix = CurrentLocalTransform.ToMatrixWithScale(); // FTransform -> FMatrix
-    //     
-    //     // 부모 본의 영향을 적용하여 월드 변환 구성
-    //     int32 ParentIndex = RefSkeleton.RawRefBoneInfo[BoneIndex].ParentIndex;
-    //     if (ParentIndex != INDEX_NONE)
-    //     {
-    //         // 로컬 변환에 부모 월드 변환 적용
-    //         LocalMatrix = LocalMatrix * CurrentGlobalBoneMatrices[ParentIndex];
-    //     }
-    //     
-    //     // 결과 행렬 저장
-    //     CurrentGlobalBoneMatrices[BoneIndex] = LocalMatrix;
-    // }
-    
-    // 최종 스키닝 행렬 계산
-    TArray<FMatrix> FinalBoneMatrices;
-    FinalBoneMatrices.SetNum(BoneNum);
-    
-    for (int32 BoneIndex = 0; BoneIndex < BoneNum; ++BoneIndex)
+    const int32 BoneNum = FMath::Min(RefSkeleton.RawRefBoneInfo.Num(), MaxBoneNum);
+
+    // 최종 스키닝 행렬, Tick에서 Component별로 계산해둔 결과를 사용
+    const TArray<FMatrix>& SkinningMatrices = SkeletalMeshComponent->GetSkinningMatrices();
+    if (SkinningMatrices.Num() < BoneNum)
     {
-        FinalBoneMatrices[BoneIndex] = RefSkeleton.InverseBindPoseMatrices[BoneIndex] * CurrentGlobalBoneMatrices[BoneIndex];
-        FinalBoneMatrices[BoneIndex] = FMatrix::Transpose(FinalBoneMatrices[BoneIndex]);
+        return;
     }
     
     // Update
@@ -263,7 +237,12 @@ void FSkeletalMeshRenderPassBase::UpdateBone(const USkeletalMeshComponent* Skele
         return;
     }
     
-    ZeroMemory(MappedResource.pData, sizeof(FMatrix) * MaxBoneNum);
-    memcpy(MappedResource.pData, FinalBoneMatrices.GetData(), sizeof(FMatrix) * BoneNum);
+    // Shader는 열 우선이므로 전치해서 복사하고, 사용하지 않는 뒤쪽만 0으로 채움
+    FMatrix* MappedBoneMatrices = static_cast<FMatrix*>(MappedResource.pData);
+    for (int32 BoneIndex = 0; BoneIndex < BoneNum; ++BoneIndex)
+    {
+        MappedBoneMatrices[BoneIndex] = FMatrix::Transpose(SkinningMatrices[BoneIndex]);
+    }
+    ZeroMemory(MappedBoneMatrices + BoneNum, sizeof(FMatrix) * (MaxBoneNum - BoneNum));
     Graphics->DeviceContext->Unmap(BoneBuffer, 0); 
 }
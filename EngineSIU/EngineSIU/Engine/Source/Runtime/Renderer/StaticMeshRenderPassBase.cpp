@@ -100,12 +100,12 @@ void FStaticMeshRenderPassBase::RenderPrimitive(FStaticMeshRenderData* RenderDat
     UINT Offset = 0;
 
     FVertexInfo VertexInfo;
-    BufferManager->CreateVertexBuffer(RenderData->ObjectName, RenderData->Vertices, VertexInfo);
+    BufferManager->CreateVertexBuffer(RenderData->ObjectName, RenderData->GetVertexData(), RenderData->GetNumVertices(), VertexInfo);
 
     Graphics->DeviceContext->IASetVertexBuffers(0, 1, &VertexInfo.VertexBuffer, &Stride, &Offset);
 
     FIndexInfo IndexInfo;
-    BufferManager->CreateIndexBuffer(RenderData->ObjectName, RenderData->Indices, IndexInfo);
+    BufferManager->CreateIndexBuffer(RenderData->ObjectName, RenderData->GetIndexData(), RenderData->GetNumIndices(), IndexInfo);
     if (IndexInfo.IndexBuffer)
     {
         Graphics->DeviceContext->IASetIndexBuffer(IndexInfo.IndexBuffer, DXGI_FORMAT_R32_UINT, 0);
@@ -113,7 +113,7 @@ void FStaticMeshRenderPassBase::RenderPrimitive(FStaticMeshRenderData* RenderDat
 
     if (RenderData->MaterialSubsets.Num() == 0)
     {
-        Graphics->DeviceContext->DrawIndexed(RenderData->Indices.Num(), 0, 0);
+        Graphics->DeviceContext->DrawIndexed(RenderData->GetNumIndices(), 0, 0);
         return;
     }
 
@@ -1,6 +1,8 @@
 ﻿#pragma once
 #include <fstream>
+#include <type_traits>
 
+#include "Container/Array.h"
 #include "Container/String.h"
 
 struct Serializer
@@ -18,11 +20,8 @@ struct Serializer
     {
         uint32 Length = 0;
         Stream.read(reinterpret_cast<char*>(&Length), sizeof(Length));
-        char* Buffer = new char[Length + 1];
-        Stream.read(Buffer, Length);
-        Buffer[Length] = '\0';
-        InString = Buffer;
-        delete[] Buffer;
+        InString.Resize(static_cast<int32>(Length));
+        Stream.read(GetData(InString), Length);
     }
 
     /* Write FWString */
@@ -38,10 +37,33 @@ struct Serializer
     {
         uint32 Length = 0;
         Stream.read(reinterpret_cast<char*>(&Length), sizeof(Length));
-        wchar_t* Buffer = new wchar_t[Length + 1];
-        Stream.read(reinterpret_cast<char*>(Buffer), Length * sizeof(wchar_t));
-        Buffer[Length] = L'\0';
-        InString = Buffer;
-        delete[] Buffer;
+        InString.resize(Length);
+        Stream.read(reinterpret_cast<char*>(InString.data()), Length * sizeof(wchar_t));
+    }
+
+    /* Write TArray (개수 + 원소를 그대로 복사) */
+    template <typename T>
+        requires std::is_trivially_copyable_v<T>
+    static void WriteArray(std::ofstream& Stream, const TArray<T>& InArray)
+    {
+        uint32 Count = InArray.Num();
+        Stream.write(reinterpret_cast<const char*>(&Count), sizeof(Count));
+        Stream.write(reinterpret_cast<const char*>(InArray.GetData()), Count * sizeof(T));
+    }
+
+    /* Read TArray */
+    template <typename T>
+        requires std::is_trivially_copyable_v<T>
+    static bool ReadArray(std::ifstream& Stream, TArray<T>& OutArray)
+    {
+        uint32 Count = 0;
+        Stream.read(reinterpret_cast<char*>(&Count), sizeof(Count));
+        if (!Stream)
+        {
+            return false;
+        }
+        OutArray.SetNum(Count);
+        Stream.read(reinterpret_cast<char*>(OutArray.GetData()), Count * sizeof(T));
+        return static_cast<bool>(Stream);
     }
 };
@@ -43,6 +43,12 @@ public:
     template<typename T>
     HRESULT CreateIndexBuffer(const FWString& KeyName, const TArray<T>& indices, FIndexInfo& OutIndexInfo, D3D11_USAGE Usage = D3D11_USAGE_DEFAULT, UINT CpuAccessFlags = 0);
 
+    // TArray에 담기지 않은 데이터(Memory-map된 파일 등)에서 바로 생성 - FWString
+    template<typename T>
+    HRESULT CreateVertexBuffer(const FWString& KeyName, const T* vertices, uint32 NumVertices, FVertexInfo& OutVertexInfo, D3D11_USAGE Usage = D3D11_USAGE_DEFAULT, UINT CpuAccessFlags = 0);
+    template<typename T>
+    HRESULT CreateIndexBuffer(const FWString& KeyName, const T* indices, uint32 NumIndices, FIndexInfo& OutIndexInfo, D3D11_USAGE Usage = D3D11_USAGE_DEFAULT, UINT CpuAccessFlags = 0);
+
     template<typename T>
     HRESULT CreateDynamicVertexBuffer(const FString& KeyName, const TArray<T>& vertices, FVertexInfo& OutVertexInfo);
 
@@ -181,6 +187,12 @@ HRESULT FDXDBufferManager::CreateVertexBuffer(const FString& KeyName, const TArr
 template<typename T>
 HRESULT FDXDBufferManager::CreateVertexBufferInternal(const FWString& KeyName, const TArray<T>& vertices, FVertexInfo& OutVertexInfo,
     D3D11_USAGE usage, UINT cpuAccessFlags)
+{
+    return CreateVertexBuffer(KeyName, vertices.GetData(), static_cast<uint32>(vertices.Num()), OutVertexInfo, usage, cpuAccessFlags);
+}
+
+template<typename T>
+HRESULT FDXDBufferManager::CreateVertexBuffer(const FWString& KeyName, const T* vertices, uint32 NumVertices, FVertexInfo& OutVertexInfo, D3D11_USAGE Usage, UINT CpuAccessFlags)
 {
     if (!KeyName.empty() && TextAtlasVertexBufferPool.Contains(KeyName))
     {
@@ -189,20 +201,20 @@ HRESULT FDXDBufferManager::CreateVertexBufferInternal(const FWString& KeyName, c
     }
     uint32_t Stride = sizeof(T);
     D3D11_BUFFER_DESC bufferDesc = {};
-    bufferDesc.Usage = usage;
-    bufferDesc.ByteWidth = Stride * vertices.Num();
+    bufferDesc.Usage = Usage;
+    bufferDesc.ByteWidth = Stride * NumVertices;
     bufferDesc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
-    bufferDesc.CPUAccessFlags = cpuAccessFlags;
+    bufferDesc.CPUAccessFlags = CpuAccessFlags;
 
     D3D11_SUBRESOURCE_DATA initData = {};
-    initData.pSysMem = vertices.GetData();
+    initData.pSysMem = vertices;
 
     ID3D11Buffer* NewBuffer = nullptr;
     HRESULT hr = DXDevice->CreateBuffer(&bufferDesc, &initData, &NewBuffer);
     if (FAILED(hr))
         return hr;
 
-    OutVertexInfo.NumVertices = static_cast<uint32>(vertices.Num());
+    OutVertexInfo.NumVertices = NumVertices;
     OutVertexInfo.VertexBuffer = NewBuffer;
     OutVertexInfo.Stride = Stride;
     TextAtlasVertexBufferPool.Add(KeyName, OutVertexInfo);
@@ -213,6 +225,12 @@ HRESULT FDXDBufferManager::CreateVertexBufferInternal(const FWString& KeyName, c
 // FWString 전용 인덱스 버퍼 생성
 template<typename T>
 HRESULT FDXDBufferManager::CreateIndexBuffer(const FWString& KeyName, const TArray<T>& indices, FIndexInfo& OutIndexInfo, D3D11_USAGE Usage, UINT CpuAccessFlags)
+{
+    return CreateIndexBuffer(KeyName, indices.GetData(), static_cast<uint32>(indices.Num()), OutIndexInfo, Usage, CpuAccessFlags);
+}
+
+template<typename T>
+HRESULT FDXDBufferManager::CreateIndexBuffer(const FWString& KeyName, const T* indices, uint32 NumIndices, FIndexInfo& OutIndexInfo, D3D11_USAGE Usage, UINT CpuAccessFlags)
 {
     if (!KeyName.empty() && TextAtlasIndexBufferPool.Contains(KeyName))
     {
@@ -222,21 +240,21 @@ HRESULT FDXDBufferManager::CreateIndexBuffer(const FWString& KeyName, const TArr
 
     D3D11_BUFFER_DESC indexBufferDesc = {};
     indexBufferDesc.Usage = Usage;
-    indexBufferDesc.ByteWidth = indices.Num() * sizeof(uint32);
+    indexBufferDesc.ByteWidth = NumIndices * sizeof(uint32);
     indexBufferDesc.BindFlags = D3D11_BIND_INDEX_BUFFER;
     indexBufferDesc.CPUAccessFlags = CpuAccessFlags;
 
     D3D11_SUBRESOURCE_DATA indexInitData = {};
-    indexInitData.pSysMem = indices.GetData();
+    indexInitData.pSysMem = indices;
 
     ID3D11Buffer* NewBuffer = nullptr;
     HRESULT hr = DXDevice->CreateBuffer(&indexBufferDesc, &indexInitData, &NewBuffer);
     if (FAILED(hr))
         return hr;
 
-    OutIndexInfo.NumIndices = static_cast<uint32>(indices.Num());
+    OutIndexInfo.NumIndices = NumIndices;
     OutIndexInfo.IndexBuffer = NewBuffer;
-    TextAtlasIndexBufferPool.Add(KeyName, FIndexInfo(static_cast<uint32>(indices.Num()), NewBuffer));
+    TextAtlasIndexBufferPool.Add(KeyName, FIndexInfo(NumIndices, NewBuffer));
 
     return S_OK;
 }
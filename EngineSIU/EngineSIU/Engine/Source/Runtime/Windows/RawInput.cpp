@@ -122,5 +122,9 @@ std::string FRawInput::GetLastErrorString()
 void FRawInput::LogRawInput(ELogLevel Level, const std::string& Message)
 {
     OutputDebugStringA(("[RawInput] " + Message + "\n").c_str());
-    UE_LOG(Level, "[RawInput] %s", Message.c_str());
+    // Level이 상수가 아니라서 UE_LOG의 컴파일 시간 필터를 쓸 수 없음
+    if (LogTemp.IsEnabled(Level))
+    {
+        FLog::Log(LogTemp, Level, "[RawInput] %s", Message.c_str());
+    }
 }
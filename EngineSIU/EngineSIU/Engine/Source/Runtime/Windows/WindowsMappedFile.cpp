@@ -0,0 +1,63 @@
+﻿#include "WindowsMappedFile.h"
+
+
+FWindowsMappedFile::~FWindowsMappedFile()
+{
+    Close();
+}
+
+bool FWindowsMappedFile::Open(const FWString& FilePath)
+{
+    Close();
+
+    FileHandle = CreateFileW(FilePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (FileHandle == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    LARGE_INTEGER FileSize;
+    if (!GetFileSizeEx(FileHandle, &FileSize) || FileSize.QuadPart == 0)
+    {
+        // 크기가 0인 파일은 Mapping을 만들 수 없음
+        Close();
+        return false;
+    }
+
+    MappingHandle = CreateFileMappingW(FileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!MappingHandle)
+    {
+        Close();
+        return false;
+    }
+
+    Data = static_cast<const uint8*>(MapViewOfFile(MappingHandle, FILE_MAP_READ, 0, 0, 0));
+    if (!Data)
+    {
+        Close();
+        return false;
+    }
+
+    Size = static_cast<uint64>(FileSize.QuadPart);
+    return true;
+}
+
+void FWindowsMappedFile::Close()
+{
+    if (Data)
+    {
+        UnmapViewOfFile(Data);
+        Data = nullptr;
+    }
+    if (MappingHandle)
+    {
+        CloseHandle(MappingHandle);
+        MappingHandle = nullptr;
+    }
+    if (FileHandle != INVALID_HANDLE_VALUE)
+    {
+        CloseHandle(FileHandle);
+        FileHandle = INVALID_HANDLE_VALUE;
+    }
+    Size = 0;
+}
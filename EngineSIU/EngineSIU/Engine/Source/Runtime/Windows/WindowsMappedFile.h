@@ -0,0 +1,34 @@
+﻿#pragma once
+#include "HAL/PlatformType.h"
+
+
+/**
+ * 파일을 읽기 전용으로 Memory-map합니다.
+ * 데이터는 처음 접근할 때 OS가 Page 단위로 읽으며, Close하거나 소멸될 때까지 유효합니다.
+ */
+class FWindowsMappedFile
+{
+public:
+    FWindowsMappedFile() = default;
+    ~FWindowsMappedFile();
+
+    FWindowsMappedFile(const FWindowsMappedFile&) = delete;
+    FWindowsMappedFile& operator=(const FWindowsMappedFile&) = delete;
+
+    bool Open(const FWString& FilePath);
+    void Close();
+
+    bool IsOpen() const { return Data != nullptr; }
+
+    const uint8* GetData() const { return Data; }
+    uint64 GetSize() const { return Size; }
+
+private:
+    HANDLE FileHandle = INVALID_HANDLE_VALUE;
+    HANDLE MappingHandle = nullptr;
+
+    const uint8* Data = nullptr;
+    uint64 Size = 0;
+};
+
+typedef FWindowsMappedFile FMappedFile;